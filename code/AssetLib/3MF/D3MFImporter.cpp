@@ -50,9 +50,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/StringUtils.h>
 #include <assimp/XmlParser.h>
 #include <assimp/ZipArchiveIOSystem.h>
+#include <assimp/config.h>
 #include <assimp/importerdesc.h>
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
+#include <assimp/Importer.hpp>
 #include <assimp/IOSystem.hpp>
 #include <assimp/fast_atof.h>
 
@@ -94,8 +96,8 @@ bool D3MFImporter::CanRead(const std::string &filename, IOSystem *pIOHandler, bo
     return true;
 }
 
-void D3MFImporter::SetupProperties(const Importer*) {
-    // empty
+void D3MFImporter::SetupProperties(const Importer *pImp) {
+    mStreamXml = pImp->GetPropertyInteger(AI_CONFIG_IMPORT_XML_STREAMING, 0) != 0;
 }
 
 const aiImporterDesc *D3MFImporter::GetInfo() const {
@@ -106,8 +108,8 @@ void D3MFImporter::InternReadFile(const std::string &filename, aiScene *pScene,
     D3MFOpcPackage opcPackage(pIOHandler, filename);
 
     XmlParser xmlParser;
-    if (xmlParser.parse(opcPackage.RootStream())) {
-        XmlSerializer xmlSerializer(xmlParser);
+    XmlSerializer xmlSerializer(xmlParser);
+    if (xmlSerializer.ParseXml(opcPackage.RootStream(), mStreamXml)) {
         xmlSerializer.ImportXml(pScene);
 
         const std::vector<aiTexture*> &tex =  opcPackage.GetEmbeddedTextures();
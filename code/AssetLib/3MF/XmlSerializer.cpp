@@ -42,6 +42,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "D3MFOpcPackage.h"
 #include "3MFXmlTags.h"
 #include "3MFTypes.h"
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/MemoryIOWrapper.h>
+#include <assimp/XmlStreamReader.h>
 #include <assimp/scene.h>
 
 #include <utility>
@@ -66,23 +69,6 @@ bool validateColorString(const std::string color) {
     return true;
 }
 
-aiFace ReadTriangle(XmlNode &node, int &texId0, int &texId1, int &texId2) {
-    aiFace face;
-
-    face.mNumIndices = 3;
-    face.mIndices = new unsigned int[face.mNumIndices];
-    face.mIndices[0] = static_cast<unsigned int>(std::atoi(node.attribute(XmlTag::v1).as_string()));
-    face.mIndices[1] = static_cast<unsigned int>(std::atoi(node.attribute(XmlTag::v2).as_string()));
-    face.mIndices[2] = static_cast<unsigned int>(std::atoi(node.attribute(XmlTag::v3).as_string()));
-
-    texId0 = texId1 = texId2 = IdNotSet;
-    XmlParser::getIntAttribute(node, XmlTag::p1, texId0);
-    XmlParser::getIntAttribute(node, XmlTag::p2, texId1);
-    XmlParser::getIntAttribute(node, XmlTag::p3, texId2);
-
-    return face;
-}
-
 aiVector3D ReadVertex(XmlNode &node) {
     aiVector3D vertex;
     vertex.x = ai_strtof(node.attribute(XmlTag::x).as_string(), nullptr);
@@ -92,6 +78,22 @@ aiVector3D ReadVertex(XmlNode &node) {
     return vertex;
 }
 
+// the value of an attribute of the current element, empty if the attribute is missing
+std::string getStreamAttribute(const XmlStreamReader &reader, const char *name) {
+    std::string value;
+    reader.getStdStrAttribute(name, value);
+    return value;
+}
+
+aiVector3D ReadVertex(const XmlStreamReader &reader) {
+    aiVector3D vertex;
+    vertex.x = ai_strtof(getStreamAttribute(reader, XmlTag::x).c_str(), nullptr);
+    vertex.y = ai_strtof(getStreamAttribute(reader, XmlTag::y).c_str(), nullptr);
+    vertex.z = ai_strtof(getStreamAttribute(reader, XmlTag::z).c_str(), nullptr);
+
+    return vertex;
+}
+
 bool getNodeAttribute(const XmlNode &node, const std::string &attribute, std::string &value) {
     pugi::xml_attribute objectAttribute = node.attribute(attribute.c_str());
     if (!objectAttribute.empty()) {
@@ -197,6 +199,44 @@ void assignDiffuseColor(XmlNode &node, aiMaterial *mat) {
     }
 }
 
+MeshGeometry::Triangle ReadTriangle(XmlNode &node) {
+    MeshGeometry::Triangle triangle;
+    triangle.mIndices[0] = static_cast<unsigned int>(std::atoi(node.attribute(XmlTag::v1).as_string()));
+    triangle.mIndices[1] = static_cast<unsigned int>(std::atoi(node.attribute(XmlTag::v2).as_string()));
+    triangle.mIndices[2] = static_cast<unsigned int>(std::atoi(node.attribute(XmlTag::v3).as_string()));
+
+    triangle.mPindex[0] = triangle.mPindex[1] = triangle.mPindex[2] = IdNotSet;
+    XmlParser::getIntAttribute(node, XmlTag::p1, triangle.mPindex[0]);
+    XmlParser::getIntAttribute(node, XmlTag::p2, triangle.mPindex[1]);
+    XmlParser::getIntAttribute(node, XmlTag::p3, triangle.mPindex[2]);
+
+    triangle.mPid = IdNotSet;
+    triangle.mHasPid = getNodeAttribute(node, D3MF::XmlTag::pid, triangle.mPid);
+
+    return triangle;
+}
+
+MeshGeometry::Triangle ReadTriangle(const XmlStreamReader &reader) {
+    MeshGeometry::Triangle triangle;
+    triangle.mIndices[0] = static_cast<unsigned int>(std::atoi(getStreamAttribute(reader, XmlTag::v1).c_str()));
+    triangle.mIndices[1] = static_cast<unsigned int>(std::atoi(getStreamAttribute(reader, XmlTag::v2).c_str()));
+    triangle.mIndices[2] = static_cast<unsigned int>(std::atoi(getStreamAttribute(reader, XmlTag::v3).c_str()));
+
+    triangle.mPindex[0] = triangle.mPindex[1] = triangle.mPindex[2] = IdNotSet;
+    reader.getIntAttribute(XmlTag::p1, triangle.mPindex[0]);
+    reader.getIntAttribute(XmlTag::p2, triangle.mPindex[1]);
+    reader.getIntAttribute(XmlTag::p3, triangle.mPindex[2]);
+
+    std::string pid;
+    triangle.mPid = IdNotSet;
+    triangle.mHasPid = reader.getStdStrAttribute(D3MF::XmlTag::pid, pid);
+    if (triangle.mHasPid) {
+        triangle.mPid = std::atoi(pid.c_str());
+    }
+
+    return triangle;
+}
+
 } // namespace
 
 XmlSerializer::XmlSerializer(XmlParser &xmlParser) :
@@ -212,11 +252,77 @@ XmlSerializer::~XmlSerializer() {
     }
 }
 
+bool XmlSerializer::ParseXml(IOStream *stream, bool streaming) {
+    if (streaming) {
+        XmlStreamReader reader(stream);
+        if (reader.isSupportedEncoding()) {
+            return ReadStreamed(reader);
+        }
+        stream->Seek(0, aiOrigin_SET);
+    }
+
+    return mXmlParser.parse(stream);
+}
+
+bool XmlSerializer::ReadStreamed(XmlStreamReader &reader) {
+    // The meshes hold the bulk of the data, they are read from the stream. The rest of the
+    // file is collected and put into the document tree, with empty <mesh> elements.
+    std::string remainder;
+    reader.setCapture(&remainder);
+    while (reader.next() != XmlStreamReader::EndOfDocument) {
+        if (reader.getEvent() != XmlStreamReader::StartElement || reader.getDepth() != 4 || reader.getName() != XmlTag::mesh) {
+            continue;
+        }
+        const std::vector<std::string> &path = reader.getPath();
+        if (path[0] != XmlTag::model || path[1] != XmlTag::resources || path[2] != XmlTag::object) {
+            continue;
+        }
+
+        const bool empty = reader.isEmptyElement();
+        reader.setCapture(nullptr);
+        mStreamedMeshes.emplace_back();
+        ReadMeshGeometry(reader, mStreamedMeshes.back());
+        if (!empty) {
+            remainder += "</";
+            remainder += XmlTag::mesh;
+            remainder += ">";
+        }
+        reader.setCapture(&remainder);
+    }
+    reader.setCapture(nullptr);
+    ASSIMP_LOG_DEBUG("3MF: read ", mStreamedMeshes.size(), " meshes with the XmlStreamReader");
+
+    MemoryIOStream remainderStream(reinterpret_cast<const uint8_t *>(remainder.data()), remainder.size());
+    return mXmlParser.parse(&remainderStream);
+}
+
+void XmlSerializer::AssignStreamedMeshes() {
+    // the streamed meshes belong to the <mesh> elements in document order
+    size_t index = 0;
+    XmlNode root = mXmlParser.getRootNode();
+    for (XmlNode model : root.children(XmlTag::model)) {
+        for (XmlNode resources : model.children(XmlTag::resources)) {
+            for (XmlNode object : resources.children(XmlTag::object)) {
+                for (XmlNode mesh : object.children(XmlTag::mesh)) {
+                    if (index == mStreamedMeshes.size()) {
+                        return;
+                    }
+                    mStreamedMeshIndex[mesh] = index++;
+                }
+            }
+        }
+    }
+}
+
 void XmlSerializer::ImportXml(aiScene *scene) {
     if (nullptr == scene) {
         return;
     }
 
+    if (!mStreamedMeshes.empty()) {
+        AssignStreamedMeshes();
+    }
+
     scene->mRootNode = new aiNode(XmlTag::RootTag);
     XmlNode node = mXmlParser.getRootNode().child(XmlTag::model);
     if (node.empty()) {
@@ -409,17 +515,77 @@ aiMesh *XmlSerializer::ReadMesh(XmlNode &node) {
         return nullptr;
     }
 
+    MeshGeometry geometry;
+    auto it = mStreamedMeshIndex.find(node);
+    if (it != mStreamedMeshIndex.end()) {
+        // the geometry isn't needed anymore when the mesh has been created
+        geometry.mVertices.swap(mStreamedMeshes[it->second].mVertices);
+        geometry.mTriangles.swap(mStreamedMeshes[it->second].mTriangles);
+    } else {
+        ReadMeshGeometry(node, geometry);
+    }
+
     aiMesh *mesh = new aiMesh();
+    ImportVertices(geometry, mesh);
+    ImportTriangles(geometry, mesh);
+
+    return mesh;
+}
+
+void XmlSerializer::ReadMeshGeometry(XmlNode &node, MeshGeometry &geometry) {
     for (XmlNode &currentNode : node.children()) {
         const std::string currentName = currentNode.name();
         if (currentName == XmlTag::vertices) {
-            ImportVertices(currentNode, mesh);
+            geometry.mVertices.clear();
+            for (XmlNode &currentSubNode : currentNode.children()) {
+                const std::string subNodeName = currentSubNode.name();
+                if (subNodeName == XmlTag::vertex) {
+                    geometry.mVertices.push_back(ReadVertex(currentSubNode));
+                }
+            }
         } else if (currentName == XmlTag::triangles) {
-            ImportTriangles(currentNode, mesh);
+            geometry.mTriangles.clear();
+            for (XmlNode &currentSubNode : currentNode.children()) {
+                const std::string subNodeName = currentSubNode.name();
+                if (subNodeName == XmlTag::triangle) {
+                    geometry.mTriangles.push_back(ReadTriangle(currentSubNode));
+                }
+            }
         }
     }
+}
 
-    return mesh;
+void XmlSerializer::ReadMeshGeometry(XmlStreamReader &reader, MeshGeometry &geometry) {
+    const size_t depth = reader.getDepth();
+    while (reader.next() != XmlStreamReader::EndElement || reader.getDepth() != depth) {
+        if (reader.getEvent() != XmlStreamReader::StartElement) {
+            continue;
+        }
+
+        const size_t childDepth = reader.getDepth();
+        const std::string &currentName = reader.getName();
+        if (currentName == XmlTag::vertices || currentName == XmlTag::triangles) {
+            const bool isVertices = currentName == XmlTag::vertices;
+            if (isVertices) {
+                geometry.mVertices.clear();
+            } else {
+                geometry.mTriangles.clear();
+            }
+            while (reader.next() != XmlStreamReader::EndElement || reader.getDepth() != childDepth) {
+                if (reader.getEvent() != XmlStreamReader::StartElement) {
+                    continue;
+                }
+                if (isVertices && reader.getName() == XmlTag::vertex) {
+                    geometry.mVertices.push_back(ReadVertex(reader));
+                } else if (!isVertices && reader.getName() == XmlTag::triangle) {
+                    geometry.mTriangles.push_back(ReadTriangle(reader));
+                }
+                reader.skipElement();
+            }
+        } else {
+            reader.skipElement();
+        }
+    }
 }
 
 void XmlSerializer::ReadMetadata(XmlNode &node) {
@@ -436,104 +602,97 @@ void XmlSerializer::ReadMetadata(XmlNode &node) {
     mMetaData.push_back(entry);
 }
 
-void XmlSerializer::ImportVertices(XmlNode &node, aiMesh *mesh) {
+void XmlSerializer::ImportVertices(const MeshGeometry &geometry, aiMesh *mesh) {
     ai_assert(nullptr != mesh);
 
-    std::vector<aiVector3D> vertices;
-    for (XmlNode &currentNode : node.children()) {
-        const std::string currentName = currentNode.name();
-        if (currentName == XmlTag::vertex) {
-            vertices.push_back(ReadVertex(currentNode));
-        }
-    }
-
+    const std::vector<aiVector3D> &vertices = geometry.mVertices;
     mesh->mNumVertices = static_cast<unsigned int>(vertices.size());
     mesh->mVertices = new aiVector3D[mesh->mNumVertices];
     std::copy(vertices.begin(), vertices.end(), mesh->mVertices);
 }
 
-void XmlSerializer::ImportTriangles(XmlNode &node, aiMesh *mesh) {
+void XmlSerializer::ImportTriangles(const MeshGeometry &geometry, aiMesh *mesh) {
     std::vector<aiFace> faces;
-    for (XmlNode &currentNode : node.children()) {
-        const std::string currentName = currentNode.name();
-        if (currentName == XmlTag::triangle) {
-            int pid = IdNotSet;
-            bool hasPid = getNodeAttribute(currentNode, D3MF::XmlTag::pid, pid);
-
-            int pindex[3];
-            aiFace face = ReadTriangle(currentNode, pindex[0], pindex[1], pindex[2]);
-            if (hasPid && (pindex[0] != IdNotSet || pindex[1] != IdNotSet || pindex[2] != IdNotSet)) {
-                auto it = mResourcesDictionnary.find(pid);
-                if (it != mResourcesDictionnary.end()) {
-                    if (it->second->getType() == ResourceType::RT_BaseMaterials) {
-                        BaseMaterials *baseMaterials = static_cast<BaseMaterials *>(it->second);
-
-                        auto update_material = [&](int idx) {
-                            if (pindex[idx] != IdNotSet) {
-                                mesh->mMaterialIndex = baseMaterials->mMaterialIndex[pindex[idx]];
-                            }
-                        };
-
-                        update_material(0);
-                        update_material(1);
-                        update_material(2);
+    faces.reserve(geometry.mTriangles.size());
+    for (const MeshGeometry::Triangle &triangle : geometry.mTriangles) {
+        const int pid = triangle.mPid;
+        const int *pindex = triangle.mPindex;
+
+        aiFace face;
+        face.mNumIndices = 3;
+        face.mIndices = new unsigned int[face.mNumIndices];
+        std::copy(triangle.mIndices, triangle.mIndices + 3, face.mIndices);
+        if (triangle.mHasPid && (pindex[0] != IdNotSet || pindex[1] != IdNotSet || pindex[2] != IdNotSet)) {
+            auto it = mResourcesDictionnary.find(pid);
+            if (it != mResourcesDictionnary.end()) {
+                if (it->second->getType() == ResourceType::RT_BaseMaterials) {
+                    BaseMaterials *baseMaterials = static_cast<BaseMaterials *>(it->second);
+
+                    auto update_material = [&](int idx) {
+                        if (pindex[idx] != IdNotSet) {
+                            mesh->mMaterialIndex = baseMaterials->mMaterialIndex[pindex[idx]];
+                        }
+                    };
+
+                    update_material(0);
+                    update_material(1);
+                    update_material(2);
+
+                } else if (it->second->getType() == ResourceType::RT_Texture2DGroup) {
+                    // Load texture coordinates into mesh, when any
+                    Texture2DGroup *group = static_cast<Texture2DGroup *>(it->second); // fix bug
+                    if (mesh->mTextureCoords[0] == nullptr) {
+                        mesh->mNumUVComponents[0] = 2;
+                        for (unsigned int i = 1; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+                            mesh->mNumUVComponents[i] = 0;
+                        }
 
-                    } else if (it->second->getType() == ResourceType::RT_Texture2DGroup) {
-                        // Load texture coordinates into mesh, when any
-                        Texture2DGroup *group = static_cast<Texture2DGroup *>(it->second); // fix bug
-                        if (mesh->mTextureCoords[0] == nullptr) {
-                            mesh->mNumUVComponents[0] = 2;
-                            for (unsigned int i = 1; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
-                                mesh->mNumUVComponents[i] = 0;
+                        const std::string name = ai_to_string(group->mTexId);
+                        for (size_t i = 0; i < mMaterials.size(); ++i) {
+                            if (name == mMaterials[i]->GetName().C_Str()) {
+                                mesh->mMaterialIndex = static_cast<unsigned int>(i);
                             }
+                        }
+                        mesh->mTextureCoords[0] = new aiVector3D[mesh->mNumVertices];
+                        for (unsigned int vertex_index = 0; vertex_index < mesh->mNumVertices; vertex_index++) {
+                            mesh->mTextureCoords[0][vertex_index].z = IdNotSet;//mark not set
+                        }
+                    }
 
-                            const std::string name = ai_to_string(group->mTexId);
-                            for (size_t i = 0; i < mMaterials.size(); ++i) {
-                                if (name == mMaterials[i]->GetName().C_Str()) {
-                                    mesh->mMaterialIndex = static_cast<unsigned int>(i);
-                                }
-                            }
-                            mesh->mTextureCoords[0] = new aiVector3D[mesh->mNumVertices];
-                            for (unsigned int vertex_index = 0; vertex_index < mesh->mNumVertices; vertex_index++) {
-                                mesh->mTextureCoords[0][vertex_index].z = IdNotSet;//mark not set
-                            }
+                    auto update_texture = [&](int idx) {
+                        if (pindex[idx] != IdNotSet) {
+                            size_t vertex_index = face.mIndices[idx];
+                            mesh->mTextureCoords[0][vertex_index] =
+                                    aiVector3D(group->mTex2dCoords[pindex[idx]].x, group->mTex2dCoords[pindex[idx]].y, 0.0f);
                         }
+                    };
 
-                        auto update_texture = [&](int idx) {
-                            if (pindex[idx] != IdNotSet) {
-                                size_t vertex_index = face.mIndices[idx];
-                                mesh->mTextureCoords[0][vertex_index] =
-                                        aiVector3D(group->mTex2dCoords[pindex[idx]].x, group->mTex2dCoords[pindex[idx]].y, 0.0f);
-                            }
-                        };
+                    update_texture(0);
+                    update_texture(1);
+                    update_texture(2);
 
-                        update_texture(0);
-                        update_texture(1);
-                        update_texture(2);
+                } else if (it->second->getType() == ResourceType::RT_ColorGroup) {
+                    // Load vertex color into mesh, when any
+                    ColorGroup *group = static_cast<ColorGroup *>(it->second);
+                    if (mesh->mColors[0] == nullptr) {
+                        mesh->mColors[0] = new aiColor4D[mesh->mNumVertices];
+                    }
 
-                    } else if (it->second->getType() == ResourceType::RT_ColorGroup) {
-                        // Load vertex color into mesh, when any
-                        ColorGroup *group = static_cast<ColorGroup *>(it->second);
-                        if (mesh->mColors[0] == nullptr) {
-                            mesh->mColors[0] = new aiColor4D[mesh->mNumVertices];
+                    auto update_color = [&](int idx) {
+                        if (pindex[idx] != IdNotSet) {
+                            size_t vertex_index = face.mIndices[idx];
+                            mesh->mColors[0][vertex_index] = group->mColors[pindex[idx]];
                         }
+                    };
 
-                        auto update_color = [&](int idx) {
-                            if (pindex[idx] != IdNotSet) {
-                                size_t vertex_index = face.mIndices[idx];
-                                mesh->mColors[0][vertex_index] = group->mColors[pindex[idx]];
-                            }
-                        };
-
-                        update_color(0);
-                        update_color(1);
-                        update_color(2);
-                    }
+                    update_color(0);
+                    update_color(1);
+                    update_color(2);
                 }
             }
-
-            faces.push_back(face);
         }
+
+        faces.push_back(face);
     }
 
     mesh->mNumFaces = static_cast<unsigned int>(faces.size());
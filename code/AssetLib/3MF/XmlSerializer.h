@@ -50,6 +50,9 @@ struct aiMesh;
 struct aiMaterial;
 
 namespace Assimp {
+
+class XmlStreamReader;
+
 namespace D3MF {
 
 class Resource;
@@ -59,20 +62,44 @@ class Texture2DGroup;
 class EmbeddedTexture;
 class ColorGroup;
 
+/// @brief The contents of a <mesh> element, the properties are resolved when the aiMesh is created.
+struct MeshGeometry {
+    struct Triangle {
+        unsigned int mIndices[3];
+        int mPid;
+        int mPindex[3];
+        bool mHasPid;
+    };
+
+    std::vector<aiVector3D> mVertices;
+    std::vector<Triangle> mTriangles;
+};
+
 /// @brief his class implements ther 3mf serialization.
 class XmlSerializer final {
 public:
     explicit XmlSerializer(XmlParser &xmlParser);
     ~XmlSerializer();
+
+    /// @brief Parses the model file. With streaming enabled the meshes are read directly
+    ///        from the stream and only the rest of the file is put into the document tree.
+    /// @param stream       The stream of the model file.
+    /// @param streaming    true to read the meshes with the XmlStreamReader.
+    /// @return true, if the file was parsed successfully.
+    bool ParseXml(IOStream *stream, bool streaming);
     void ImportXml(aiScene *scene);
 
 private:
     void addObjectToNode(aiNode *parent, Object *obj, aiMatrix4x4 nodeTransform);
     void ReadObject(XmlNode &node);
+    bool ReadStreamed(XmlStreamReader &reader);
+    void AssignStreamedMeshes();
     aiMesh *ReadMesh(XmlNode &node);
+    void ReadMeshGeometry(XmlNode &node, MeshGeometry &geometry);
+    void ReadMeshGeometry(XmlStreamReader &reader, MeshGeometry &geometry);
     void ReadMetadata(XmlNode &node);
-    void ImportVertices(XmlNode &node, aiMesh *mesh);
-    void ImportTriangles(XmlNode &node, aiMesh *mesh);
+    void ImportVertices(const MeshGeometry &geometry, aiMesh *mesh);
+    void ImportTriangles(const MeshGeometry &geometry, aiMesh *mesh);
     void ReadBaseMaterials(XmlNode &node);
     void ReadEmbeddecTexture(XmlNode &node);
     void StoreEmbeddedTexture(EmbeddedTexture *tex);
@@ -94,6 +121,8 @@ private:
     std::map<unsigned int, Resource *> mResourcesDictionnary;
     unsigned int mMeshCount;
     XmlParser &mXmlParser;
+    std::vector<MeshGeometry> mStreamedMeshes;
+    std::map<XmlNode, size_t> mStreamedMeshIndex;
 };
 
 } // namespace D3MF
@@ -16,11 +16,11 @@ Licensed under a 3-clause BSD license. See the LICENSE file for more information
 #include <assimp/IOSystem.hpp>
 #include <assimp/Importer.hpp>
 #include <assimp/Exceptional.h>
+#include <assimp/BufferedTextWriter.h>
 
 #include <cassert>
 #include <limits>
 #include <memory>
-#include <sstream>
 
 #define CURRENT_FORMAT_VERSION 100
 
@@ -44,24 +44,20 @@ public:
         Flag_SkipWhitespaces = 0x4
     };
 
+    // the output is streamed into out, numbers are formatted independent of the user's current locale
     JSONWriter(Assimp::IOStream &out, unsigned int flags = 0u) :
-            out(out), indent (""), newline("\n"), space(" "), buff (), first(false), flags(flags) {
-        // make sure that all formatting happens using the standard, C locale and not the user's current locale
-        buff.imbue(std::locale("C"));
+            indent (""), newline("\n"), space(" "), buff (&out), first(false), flags(flags) {
         if (flags & Flag_SkipWhitespaces) {
             newline = "";
             space = "";
         }
     }
 
-    ~JSONWriter() {
-        Flush();
-    }
+    // pending output is discarded, call Flush() once the document is complete
+    ~JSONWriter() = default;
 
     void Flush() {
-        const std::string s = buff.str();
-        out.Write(s.c_str(), s.length(), 1);
-        buff.clear();
+        buff.flush();
     }
 
     void PushIndent() {
@@ -75,7 +71,7 @@ public:
     void Key(const std::string &name) {
         AddIndentation();
         Delimit();
-        buff << '\"' + name + "\":" << space;
+        buff << '\"' << name << "\":" << space;
     }
 
     template <typename Literal>
@@ -168,30 +164,26 @@ public:
 
 private:
     template <typename Literal>
-    std::stringstream &LiteralToString(std::stringstream &stream, const Literal &s) {
+    BufferedTextWriter &LiteralToString(BufferedTextWriter &stream, const Literal &s) {
         stream << s;
         return stream;
     }
 
-    std::stringstream &LiteralToString(std::stringstream &stream, const aiString &s) {
-        std::string t;
-
+    BufferedTextWriter &LiteralToString(BufferedTextWriter &stream, const aiString &s) {
         // escape backslashes and single quotes, both would render the JSON invalid if left as is
-        t.reserve(s.length);
+        stream << '\"';
         for (size_t i = 0; i < s.length; ++i) {
             if (s.data[i] == '\\' || s.data[i] == '\'' || s.data[i] == '\"') {
-                t.push_back('\\');
+                stream << '\\';
             }
 
-            t.push_back(s.data[i]);
+            stream << s.data[i];
         }
-        stream << "\"";
-        stream << t;
-        stream << "\"";
+        stream << '\"';
         return stream;
     }
 
-    std::stringstream &LiteralToString(std::stringstream &stream, float f) {
+    BufferedTextWriter &LiteralToString(BufferedTextWriter &stream, float f) {
         if (!std::numeric_limits<float>::is_iec559) {
             // on a non IEEE-754 platform, we make no assumptions about the representation or existence
             // of special floating-point numbers.
@@ -230,11 +222,10 @@ private:
     }
 
 private:
-    Assimp::IOStream &out;
     std::string indent;
     std::string newline;
     std::string space;
-    std::stringstream buff;
+    BufferedTextWriter buff;
     bool first;
 
     unsigned int flags;
@@ -809,6 +800,7 @@ void ExportAssimp2Json(const char *file, Assimp::IOSystem *io, const aiScene *sc
         }
         JSONWriter s(*str, flags);
         Write(s, *scenecopy_tmp);
+        s.Flush();
 
     } catch (...) {
         aiFreeScene(scenecopy_tmp);
@@ -47,6 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/ai_assert.h>
 #include <assimp/material.h>
+#include <assimp/BufferedTextWriter.h>
 
 #include <array>
 #include <map>
@@ -67,8 +68,8 @@ class IOSystem;
 /// comfort when implementing it.
 class ColladaExporter final {
 public:
-    /// Constructor for a specific scene to export
-    ColladaExporter(const aiScene *pScene, IOSystem *pIOSystem, const std::string &path, const std::string &file);
+    /// Constructor for a specific scene to export, writes it to the given stream
+    ColladaExporter(const aiScene *pScene, IOSystem *pIOSystem, IOStream *pStream, const std::string &path, const std::string &file);
 
     /// Destructor
     virtual ~ColladaExporter() = default;
@@ -182,8 +183,8 @@ private:
     std::array<IndexIdMap, static_cast<size_t>(AiObjectType::Count)> mObjectNameMap; // Cache of encoded names
 
 public:
-    /// Stringstream to write all output into
-    std::stringstream mOutput;
+    /// Buffered writer for the output file
+    BufferedTextWriter mOutput;
 
     /// The IOSystem for output
     IOSystem *mIOSystem;
@@ -57,6 +57,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/Importer.hpp>
 
+#include <algorithm>
 #include <numeric>
 
 namespace Assimp {
@@ -105,6 +106,8 @@ ColladaLoader::ColladaLoader() :
         ignoreUpDirection(false),
         ignoreUnitSize(false),
         useColladaName(false),
+        numParseThreads(1),
+        streamXml(false),
         mNodeNameCounter(0) {
     // empty
 }
@@ -129,6 +132,8 @@ void ColladaLoader::SetupProperties(const Importer *pImp) {
     ignoreUpDirection = pImp->GetPropertyInteger(AI_CONFIG_IMPORT_COLLADA_IGNORE_UP_DIRECTION, 0) != 0;
     ignoreUnitSize = pImp->GetPropertyInteger(AI_CONFIG_IMPORT_COLLADA_IGNORE_UNIT_SIZE, 0) != 0;
     useColladaName = pImp->GetPropertyInteger(AI_CONFIG_IMPORT_COLLADA_USE_COLLADA_NAMES, 0) != 0;
+    numParseThreads = static_cast<unsigned int>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_COLLADA_PARSE_THREADS, 1)));
+    streamXml = pImp->GetPropertyInteger(AI_CONFIG_IMPORT_XML_STREAMING, 0) != 0;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -154,7 +159,7 @@ void ColladaLoader::InternReadFile(const std::string &pFile, aiScene *pScene, IO
     mAnims.clear();
 
     // parse the input file
-    ColladaParser parser(pIOHandler, pFile);
+    ColladaParser parser(pIOHandler, pFile, numParseThreads, streamXml);
 
     if (!parser.mRootNode) {
         throw DeadlyImportError("Collada: File came out empty. Something is wrong here.");
@@ -232,6 +232,12 @@ private:
     bool ignoreUnitSize;
     bool useColladaName;
 
+    /** Number of threads for decoding data arrays, see AI_CONFIG_IMPORT_COLLADA_PARSE_THREADS */
+    unsigned int numParseThreads;
+
+    /** Read the geometry from the stream, see AI_CONFIG_IMPORT_XML_STREAMING */
+    bool streamXml;
+
     /** Used by FindNameForNode() to generate unique node names */
     unsigned int mNodeNameCounter;
 };
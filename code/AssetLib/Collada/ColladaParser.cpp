@@ -46,14 +46,19 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ASSIMP_BUILD_NO_COLLADA_IMPORTER
 
 #include "ColladaParser.h"
+#include "Common/ThreadPool.h"
+#include <assimp/MemoryIOWrapper.h>
 #include <assimp/ParsingUtils.h>
 #include <assimp/StringUtils.h>
+#include <assimp/XmlStreamReader.h>
 #include <assimp/ZipArchiveIOSystem.h>
 #include <assimp/commonMetaData.h>
 #include <assimp/fast_atof.h>
 #include <assimp/light.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/IOSystem.hpp>
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <utility>
 
@@ -409,10 +414,61 @@ static void ReadCamera(XmlNode &node, Camera &camera) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Determines the primitive type from the name of an index data element
+static PrimitiveType GetPrimitiveType(const std::string &elementName) {
+    if (elementName == "lines")
+        return Prim_Lines;
+    if (elementName == "linestrips")
+        return Prim_LineStrip;
+    if (elementName == "polygons")
+        return Prim_Polygon;
+    if (elementName == "polylist")
+        return Prim_Polylist;
+    if (elementName == "triangles")
+        return Prim_Triangles;
+    if (elementName == "trifans")
+        return Prim_TriFans;
+    if (elementName == "tristrips")
+        return Prim_TriStrips;
+    return Prim_Invalid;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reads the number of indices for each polygon of a <polylist>
+static void ReadVCount(const std::string &v, size_t numPrimitives, std::vector<size_t> &vcount) {
+    const char *content = v.c_str();
+    const char *end = content + v.size();
+
+    vcount.reserve(numPrimitives);
+    SkipSpacesAndLineEnd(&content, end);
+    unsigned int block[256];
+    size_t a = 0;
+    while (a < numPrimitives) {
+        const size_t numRead = strtoul10_array(content, end, block, std::min<size_t>(numPrimitives - a, 256));
+        if (numRead == 0) {
+            break;
+        }
+        vcount.insert(vcount.end(), block, block + numRead);
+        a += numRead;
+    }
+    SkipSpacesAndLineEnd(&content, end);
+    for (; a < numPrimitives; a++) {
+        if (*content == 0) {
+            throw DeadlyImportError("Expected more values while reading <vcount> contents.");
+        }
+        // read a number
+        vcount.push_back((size_t)strtoul10(content, &content));
+        // skip whitespace after it
+        SkipSpacesAndLineEnd(&content, end);
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
-ColladaParser::ColladaParser(IOSystem *pIOHandler, const std::string &pFile) :
+ColladaParser::ColladaParser(IOSystem *pIOHandler, const std::string &pFile, unsigned int numThreads, bool streaming) :
         mFileName(pFile),
+        mThreadPool(numThreads != 1 ? new ThreadPool(numThreads) : nullptr),
         mRootNode(nullptr),
         mUnitSize(1.0f),
         mUpDirection(UP_Y),
@@ -450,7 +506,7 @@ ColladaParser::ColladaParser(IOSystem *pIOHandler, const std::string &pFile) :
     }
 
     // generate a XML reader for it
-    if (!mXmlParser.parse(daeFile.get())) {
+    if (!(streaming && ReadStreamed(daeFile.get())) && !mXmlParser.parse(daeFile.get())) {
         throw DeadlyImportError("Unable to read file, malformed XML");
     }
     // start reading
@@ -557,6 +613,38 @@ void ColladaParser::UriDecodePath(aiString &ss) {
     ss.length = static_cast<ai_uint32>(out - ss.data);
 }
 
+// ------------------------------------------------------------------------------------------------
+// Reads the file with the stream reader. The geometry library, which holds the bulk of the data,
+// is read directly from the stream. Everything else is collected into a much smaller text which
+// is parsed by the XmlParser afterwards, the geometry library is left empty there.
+bool ColladaParser::ReadStreamed(IOStream *stream) {
+    XmlStreamReader reader(stream);
+    if (!reader.isSupportedEncoding()) {
+        stream->Seek(0, aiOrigin_SET);
+        return false;
+    }
+
+    std::string remainder;
+    reader.setCapture(&remainder);
+    while (reader.next() != XmlStreamReader::EndOfDocument) {
+        if (reader.getEvent() == XmlStreamReader::StartElement && reader.getDepth() == 2 && !reader.isEmptyElement() &&
+                reader.getName() == "library_geometries" && reader.getPath().front() == "COLLADA") {
+            reader.setCapture(nullptr);
+            ReadGeometryLibrary(reader);
+            remainder += "</library_geometries>";
+            reader.setCapture(&remainder);
+        }
+    }
+    reader.setCapture(nullptr);
+    ASSIMP_LOG_DEBUG("Collada: read the geometry library with the XmlStreamReader, ", remainder.size(), " bytes left for the document tree");
+
+    MemoryIOStream remainderStream(reinterpret_cast<const uint8_t *>(remainder.data()), remainder.size());
+    if (!mXmlParser.parse(&remainderStream)) {
+        throw DeadlyImportError("Unable to read file, malformed XML");
+    }
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Reads the contents of the file
 void ColladaParser::ReadContents(XmlNode &node) {
@@ -1380,6 +1468,31 @@ void ColladaParser::ReadGeometryLibrary(XmlNode &node) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Reads the geometry library contents from the stream
+void ColladaParser::ReadGeometryLibrary(XmlStreamReader &reader) {
+    const size_t depth = reader.getDepth();
+    while (reader.next() != XmlStreamReader::EndElement || reader.getDepth() != depth) {
+        if (reader.getEvent() != XmlStreamReader::StartElement) {
+            continue;
+        }
+        if (reader.getName() == "geometry") {
+            std::string id;
+            reader.getStdStrAttribute("id", id);
+            if (mMeshLibrary.find(id) == mMeshLibrary.cend()) {
+                std::unique_ptr<Mesh> mesh(new Mesh(id));
+
+                reader.getStdStrAttribute("name", mesh->mName);
+
+                ReadGeometry(reader, *mesh);
+                mMeshLibrary.insert({ id, mesh.release() });
+                continue;
+            }
+        }
+        reader.skipElement();
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 // Reads a geometry from the geometry library.
 void ColladaParser::ReadGeometry(XmlNode &node, Collada::Mesh &pMesh) {
@@ -1395,6 +1508,22 @@ void ColladaParser::ReadGeometry(XmlNode &node, Collada::Mesh &pMesh) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Reads a geometry from the stream
+void ColladaParser::ReadGeometry(XmlStreamReader &reader, Collada::Mesh &pMesh) {
+    const size_t depth = reader.getDepth();
+    while (reader.next() != XmlStreamReader::EndElement || reader.getDepth() != depth) {
+        if (reader.getEvent() != XmlStreamReader::StartElement) {
+            continue;
+        }
+        if (reader.getName() == "mesh") {
+            ReadMesh(reader, pMesh);
+        } else {
+            reader.skipElement();
+        }
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 // Reads a mesh from the geometry library
 void ColladaParser::ReadMesh(XmlNode &node, Mesh &pMesh) {
@@ -1410,14 +1539,33 @@ void ColladaParser::ReadMesh(XmlNode &node, Mesh &pMesh) {
             ReadSource(currentNode);
         } else if (currentName == "vertices") {
             ReadVertexData(currentNode, pMesh);
-        } else if (currentName == "triangles" || currentName == "lines" || currentName == "linestrips" ||
-                   currentName == "polygons" || currentName == "polylist" || currentName == "trifans" ||
-                   currentName == "tristrips") {
+        } else if (GetPrimitiveType(currentName) != Prim_Invalid) {
             ReadIndexData(currentNode, pMesh);
         }
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Reads a mesh from the stream. All descendants are looked at, like the XmlNodeIterator does it.
+void ColladaParser::ReadMesh(XmlStreamReader &reader, Mesh &pMesh) {
+    pugi::xml_document doc;
+    const size_t depth = reader.getDepth();
+    while (reader.next() != XmlStreamReader::EndElement || reader.getDepth() != depth) {
+        if (reader.getEvent() != XmlStreamReader::StartElement) {
+            continue;
+        }
+        const std::string &currentName = reader.getName();
+        if (currentName == "source") {
+            ReadSource(reader);
+        } else if (currentName == "vertices") {
+            XmlNode node = reader.readSubtree(doc);
+            ReadVertexData(node, pMesh);
+        } else if (GetPrimitiveType(currentName) != Prim_Invalid) {
+            ReadIndexData(reader, pMesh);
+        }
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 // Reads a source element
 void ColladaParser::ReadSource(XmlNode &node) {
@@ -1442,6 +1590,152 @@ void ColladaParser::ReadSource(XmlNode &node) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Reads a source element from the stream
+void ColladaParser::ReadSource(XmlStreamReader &reader) {
+    std::string sourceID;
+    reader.getStdStrAttribute("id", sourceID);
+
+    pugi::xml_document doc;
+    bool accessorRead = false;
+    const size_t depth = reader.getDepth();
+    while (reader.next() != XmlStreamReader::EndElement || reader.getDepth() != depth) {
+        if (reader.getEvent() != XmlStreamReader::StartElement) {
+            continue;
+        }
+        const std::string &currentName = reader.getName();
+        if (currentName == "float_array" || currentName == "IDREF_array" || currentName == "Name_array") {
+            ReadDataArray(reader);
+        } else if (currentName == "technique_common") {
+            accessorRead = false;
+        } else if (currentName == "accessor" && !accessorRead && reader.getPath()[reader.getDepth() - 2] == "technique_common") {
+            // only the first accessor of the technique counts
+            accessorRead = true;
+            XmlNode node = reader.readSubtree(doc);
+            ReadAccessor(node, sourceID);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+namespace {
+
+// Data arrays with less text than this are always decoded on the calling thread
+constexpr size_t ParallelArrayMinSize = 1 << 18;
+// Minimum amount of text for a single work item
+constexpr size_t ParallelArrayChunkSize = 1 << 16;
+
+// A whitespace-aligned piece of the text of a data array
+struct TextChunk {
+    const char *begin;
+    const char *end;
+    size_t first; // index of the first value in the chunk
+    size_t count; // number of whitespace separated tokens in the chunk
+};
+
+// Splits [begin, end) into chunks of whole tokens and counts the tokens of each chunk in parallel.
+// Returns the total number of tokens.
+size_t SplitIntoChunks(ThreadPool &pool, const char *begin, const char *end, std::vector<TextChunk> &chunks) {
+    const size_t length = static_cast<size_t>(end - begin);
+    const size_t numChunks = std::max<size_t>(1, std::min<size_t>(pool.GetNumThreads() * 4, length / ParallelArrayChunkSize));
+    chunks.resize(numChunks);
+    const char *pos = begin;
+    for (size_t i = 0; i < numChunks; ++i) {
+        chunks[i].begin = pos;
+        pos = (i + 1 == numChunks) ? end : std::max(pos, begin + length * (i + 1) / numChunks);
+        while (pos != end && !IsSpaceOrNewLine(*pos)) {
+            ++pos;
+        }
+        chunks[i].end = pos;
+    }
+
+    pool.ParallelFor(numChunks, [&chunks](size_t i) {
+        TextChunk &chunk = chunks[i];
+        chunk.count = 0;
+        bool inToken = false;
+        for (const char *c = chunk.begin; c != chunk.end; ++c) {
+            const bool isToken = !IsSpaceOrNewLine(*c);
+            chunk.count += (isToken && !inToken) ? 1 : 0;
+            inToken = isToken;
+        }
+    });
+
+    size_t total = 0;
+    for (TextChunk &chunk : chunks) {
+        chunk.first = total;
+        total += chunk.count;
+    }
+    return total;
+}
+
+// True if a value has been read up to the end of its token. Otherwise the token
+// count of the chunks doesn't match the number of values and the text needs to be
+// decoded sequentially.
+inline bool IsTokenEnd(const char *c, const char *end) {
+    return c == end || IsSpaceOrNewLine(*c);
+}
+
+// Decodes the first count values of a float_array in parallel. Returns false if the
+// text doesn't hold enough plain values, out is undefined then.
+bool ReadRealsParallel(ThreadPool &pool, const char *begin, const char *end, ai_real *out, size_t count) {
+    std::vector<TextChunk> chunks;
+    if (SplitIntoChunks(pool, begin, end, chunks) < count) {
+        return false;
+    }
+
+    std::atomic<bool> regular(true);
+    pool.ParallelFor(chunks.size(), [&](size_t i) {
+        const TextChunk &chunk = chunks[i];
+        if (chunk.first >= count) {
+            return;
+        }
+        const size_t numValues = std::min(chunk.count, count - chunk.first);
+        ai_real *values = out + chunk.first;
+        const char *c = chunk.begin;
+        for (size_t a = fast_atoreal_array(c, chunk.end, values, numValues); a < numValues; ++a) {
+            SkipSpacesAndLineEnd(&c, chunk.end);
+            c = fast_atoreal_move(c, values[a]);
+            if (!IsTokenEnd(c, chunk.end)) {
+                regular = false;
+                return;
+            }
+        }
+    });
+    return regular;
+}
+
+// Decodes all indices of a <p> element in parallel. Returns false if the text
+// needs to be decoded sequentially.
+bool ReadIndicesParallel(ThreadPool &pool, const char *begin, const char *end, std::vector<size_t> &indices) {
+    std::vector<TextChunk> chunks;
+    indices.resize(SplitIntoChunks(pool, begin, end, chunks));
+
+    std::atomic<bool> regular(true);
+    pool.ParallelFor(chunks.size(), [&](size_t i) {
+        const TextChunk &chunk = chunks[i];
+        size_t *values = indices.data() + chunk.first;
+        unsigned int block[256];
+        const char *c = chunk.begin;
+        for (size_t a = 0; a < chunk.count;) {
+            const size_t numRead = strtoul10_array(c, chunk.end, block, std::min<size_t>(chunk.count - a, 256));
+            std::copy(block, block + numRead, values + a);
+            a += numRead;
+            if (a < chunk.count && numRead < 256) {
+                // Hack: (thom) Some exporters put negative indices sometimes. We just try to carry on anyways.
+                SkipSpacesAndLineEnd(&c, chunk.end);
+                values[a++] = size_t(std::max(0, strtol10(c, &c)));
+                if (!IsTokenEnd(c, chunk.end)) {
+                    regular = false;
+                    return;
+                }
+            }
+        }
+    });
+    return regular;
+}
+
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 // Reads a data array holding a number of floats, and stores it in the global library
 void ColladaParser::ReadDataArray(XmlNode &node) {
@@ -1455,6 +1749,29 @@ void ColladaParser::ReadDataArray(XmlNode &node) {
     XmlParser::getUIntAttribute(node, "count", count);
     std::string v;
     XmlParser::getValueAsString(node, v);
+    ReadDataArrayValues(id, isStringArray, count, v);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reads a data array from the stream, only the text of the current array is held in memory
+void ColladaParser::ReadDataArray(XmlStreamReader &reader) {
+    const std::string &name = reader.getName();
+    bool isStringArray = (name == "IDREF_array" || name == "Name_array");
+
+    // read attributes
+    std::string id;
+    reader.getStdStrAttribute("id", id);
+    unsigned int count = 0;
+    reader.getUIntAttribute("count", count);
+    std::string v;
+    reader.readElementText(v);
+    ReadDataArrayValues(id, isStringArray, count, v);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Decodes the text of a data array and stores it in the global library
+void ColladaParser::ReadDataArrayValues(const std::string &id, bool isStringArray, unsigned int count, const std::string &text) {
+    std::string v = text;
     v = ai_trim(v);
     const char *content = v.c_str();
     const char *end = content + v.size();
@@ -1485,17 +1802,25 @@ void ColladaParser::ReadDataArray(XmlNode &node) {
                 SkipSpacesAndLineEnd(&content, end);
             }
         } else {
-            data.mValues.reserve(count);
+            data.mValues.resize(count);
 
-            for (unsigned int a = 0; a < count; a++) {
+            // large arrays are split up between the threads of the pool
+            if (mThreadPool && static_cast<size_t>(end - content) >= ParallelArrayMinSize &&
+                    ReadRealsParallel(*mThreadPool, content, end, data.mValues.data(), count)) {
+                ASSIMP_LOG_DEBUG("Collada: decoded ", count, " array values in parallel on ", mThreadPool->GetNumThreads(), " threads");
+                return;
+            }
+
+            // plain numbers are read in one go, the loop below picks up whatever is left
+            unsigned int a = static_cast<unsigned int>(fast_atoreal_array(content, end, data.mValues.data(), count));
+            SkipSpacesAndLineEnd(&content, end);
+            for (; a < count; a++) {
                 if (*content == 0) {
                     throw DeadlyImportError("Expected more values while reading float_array contents.");
                 }
 
                 // read a number
-                ai_real value;
-                content = fast_atoreal_move(content, value);
-                data.mValues.push_back(value);
+                content = fast_atoreal_move(content, data.mValues[a]);
                 // skip whitespace after it
                 SkipSpacesAndLineEnd(&content, end);
             }
@@ -1629,22 +1954,7 @@ void ColladaParser::ReadIndexData(XmlNode &node, Mesh &pMesh) {
 
     // distinguish between polys and triangles
     std::string elementName = node.name();
-    PrimitiveType primType = Prim_Invalid;
-    if (elementName == "lines")
-        primType = Prim_Lines;
-    else if (elementName == "linestrips")
-        primType = Prim_LineStrip;
-    else if (elementName == "polygons")
-        primType = Prim_Polygon;
-    else if (elementName == "polylist")
-        primType = Prim_Polylist;
-    else if (elementName == "triangles")
-        primType = Prim_Triangles;
-    else if (elementName == "trifans")
-        primType = Prim_TriFans;
-    else if (elementName == "tristrips")
-        primType = Prim_TriStrips;
-
+    PrimitiveType primType = GetPrimitiveType(elementName);
     ai_assert(primType != Prim_Invalid);
 
     // also a number of <input> elements, but in addition a <p> primitive collection and probably index counts for all primitives
@@ -1661,26 +1971,15 @@ void ColladaParser::ReadIndexData(XmlNode &node, Mesh &pMesh) {
                     // case <polylist> - specifies the number of indices for each polygon
                     std::string v;
                     XmlParser::getValueAsString(currentNode, v);
-                    const char *content = v.c_str();
-                    const char *end = content + v.size();
-
-                    vcount.reserve(numPrimitives);
-                    SkipSpacesAndLineEnd(&content, end);
-                    for (unsigned int a = 0; a < numPrimitives; a++) {
-                        if (*content == 0) {
-                            throw DeadlyImportError("Expected more values while reading <vcount> contents.");
-                        }
-                        // read a number
-                        vcount.push_back((size_t)strtoul10(content, &content));
-                        // skip whitespace after it
-                        SkipSpacesAndLineEnd(&content, end);
-                    }
+                    ReadVCount(v, numPrimitives, vcount);
                 }
             }
         } else if (currentName == "p") {
             if (!currentNode.empty()) {
                 // now here the actual fun starts - these are the indices to construct the mesh data from
-                actualPrimitives += ReadPrimitives(currentNode, pMesh, perIndexData, numPrimitives, vcount, primType);
+                std::string v;
+                XmlParser::getValueAsString(currentNode, v);
+                actualPrimitives += ReadPrimitives(v, pMesh, perIndexData, numPrimitives, vcount, primType);
             }
         } else if (currentName == "extra") {
             // skip
@@ -1703,6 +2002,58 @@ void ColladaParser::ReadIndexData(XmlNode &node, Mesh &pMesh) {
     pMesh.mSubMeshes.push_back(subgroup);
 }
 
+// ------------------------------------------------------------------------------------------------
+// Reads input declarations of per-index mesh data from the stream. The index lists are decoded
+// one at a time and dropped afterwards.
+void ColladaParser::ReadIndexData(XmlStreamReader &reader, Mesh &pMesh) {
+    std::vector<size_t> vcount;
+    std::vector<InputChannel> perIndexData;
+
+    unsigned int numPrimitives = 0;
+    reader.getUIntAttribute("count", numPrimitives);
+    size_t actualPrimitives = 0;
+    SubMesh subgroup;
+    reader.getStdStrAttribute("material", subgroup.mMaterial);
+
+    const std::string elementName = reader.getName();
+    PrimitiveType primType = GetPrimitiveType(elementName);
+    ai_assert(primType != Prim_Invalid);
+
+    pugi::xml_document doc;
+    std::string v;
+    const size_t depth = reader.getDepth();
+    while (reader.next() != XmlStreamReader::EndElement || reader.getDepth() != depth) {
+        if (reader.getEvent() != XmlStreamReader::StartElement) {
+            continue;
+        }
+        const std::string &currentName = reader.getName();
+        if (currentName == "input") {
+            XmlNode node = reader.readSubtree(doc);
+            ReadInputChannel(node, perIndexData);
+        } else if (currentName == "vcount") {
+            reader.readElementText(v);
+            if (numPrimitives) {
+                ReadVCount(v, numPrimitives, vcount);
+            }
+        } else if (currentName == "p") {
+            reader.readElementText(v);
+            actualPrimitives += ReadPrimitives(v, pMesh, perIndexData, numPrimitives, vcount, primType);
+        } else if (currentName != "extra" && currentName != "ph") {
+            throw DeadlyImportError("Unexpected sub element <", currentName, "> in tag <", elementName, ">");
+        }
+    }
+
+#ifdef ASSIMP_BUILD_DEBUG
+    if (primType != Prim_TriFans && primType != Prim_TriStrips && primType != Prim_LineStrip &&
+            primType != Prim_Lines) {
+        ai_assert(actualPrimitives == numPrimitives);
+    }
+#endif
+
+    subgroup.mNumFaces = actualPrimitives;
+    pMesh.mSubMeshes.push_back(subgroup);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Reads a single input channel element and stores it in the given array, if valid
 void ColladaParser::ReadInputChannel(XmlNode &node, std::vector<InputChannel> &poChannels) {
@@ -1740,7 +2091,7 @@ void ColladaParser::ReadInputChannel(XmlNode &node, std::vector<InputChannel> &p
 
 // ------------------------------------------------------------------------------------------------
 // Reads a <p> primitive index list and assembles the mesh data into the given mesh
-size_t ColladaParser::ReadPrimitives(XmlNode &node, Mesh &pMesh, std::vector<InputChannel> &pPerIndexChannels,
+size_t ColladaParser::ReadPrimitives(const std::string &pText, Mesh &pMesh, std::vector<InputChannel> &pPerIndexChannels,
         size_t pNumPrimitives, const std::vector<size_t> &pVCount, PrimitiveType pPrimType) {
     // determine number of indices coming per vertex
     // find the offset index for all per-vertex channels
@@ -1778,19 +2129,34 @@ size_t ColladaParser::ReadPrimitives(XmlNode &node, Mesh &pMesh, std::vector<Inp
 
     // It is possible to not contain any indices
     if (pNumPrimitives > 0) {
-        std::string v;
-        XmlParser::getValueAsString(node, v);
-        const char *content = v.c_str();
-        const char *end = content + v.size();
-
-        SkipSpacesAndLineEnd(&content, end);
-        while (*content != 0) {
-            // read a value.
-            // Hack: (thom) Some exporters put negative indices sometimes. We just try to carry on anyways.
-            int value = std::max(0, strtol10(content, &content));
-            indices.push_back(size_t(value));
-            // skip whitespace after it
+        const char *content = pText.c_str();
+        const char *end = content + pText.size();
+
+        // large index lists are split up between the threads of the pool
+        const bool parallel = mThreadPool && static_cast<size_t>(end - content) >= ParallelArrayMinSize &&
+                              ReadIndicesParallel(*mThreadPool, content, end, indices);
+        if (parallel) {
+            ASSIMP_LOG_DEBUG("Collada: decoded ", indices.size(), " indices in parallel on ", mThreadPool->GetNumThreads(), " threads");
+        } else {
+            indices.clear();
+            unsigned int block[256];
             SkipSpacesAndLineEnd(&content, end);
+            while (*content != 0) {
+                // plain indices are read in blocks
+                const size_t numRead = strtoul10_array(content, end, block, 256);
+                indices.insert(indices.end(), block, block + numRead);
+                SkipSpacesAndLineEnd(&content, end);
+                if (numRead == 256 || *content == 0) {
+                    continue;
+                }
+
+                // read a value.
+                // Hack: (thom) Some exporters put negative indices sometimes. We just try to carry on anyways.
+                int value = std::max(0, strtol10(content, &content));
+                indices.push_back(size_t(value));
+                // skip whitespace after it
+                SkipSpacesAndLineEnd(&content, end);
+            }
         }
     }
 
@@ -52,9 +52,12 @@
 #include <assimp/XmlParser.h>
 
 #include <map>
+#include <memory>
 
 namespace Assimp {
 
+class ThreadPool;
+class XmlStreamReader;
 class ZipArchiveIOSystem;
 
 // ------------------------------------------------------------------------------------------
@@ -71,7 +74,9 @@ public:
     using StringMetaData = std::map<std::string, aiString>;
 
     /// Constructor from XML file.
-    ColladaParser(IOSystem *pIOHandler, const std::string &pFile);
+    /// numThreads is the number of threads for decoding large data arrays, 0 for all hardware threads.
+    /// With streaming enabled the geometry library is read directly from the file instead of a document tree.
+    ColladaParser(IOSystem *pIOHandler, const std::string &pFile, unsigned int numThreads = 1, bool streaming = false);
 
     /// Destructor
     ~ColladaParser();
@@ -79,6 +84,10 @@ public:
     /// Attempts to read the ZAE manifest and returns the DAE to open
     static std::string ReadZaeManifest(ZipArchiveIOSystem &zip_archive);
 
+    /// Reads the geometry library from the stream and everything else into the document tree,
+    /// returns false if the encoding of the file isn't supported by the stream reader
+    bool ReadStreamed(IOStream *stream);
+
     /// Reads the contents of the file
     void ReadContents(XmlNode &node);
 
@@ -150,20 +159,28 @@ public:
 
     /// Reads the geometry library contents
     void ReadGeometryLibrary(XmlNode &node);
+    void ReadGeometryLibrary(XmlStreamReader &reader);
 
     /// Reads a geometry from the geometry library.
     void ReadGeometry(XmlNode &node, Collada::Mesh &pMesh);
+    void ReadGeometry(XmlStreamReader &reader, Collada::Mesh &pMesh);
 
     /// Reads a mesh from the geometry library
     void ReadMesh(XmlNode &node, Collada::Mesh &pMesh);
+    void ReadMesh(XmlStreamReader &reader, Collada::Mesh &pMesh);
 
     /// Reads a source element - a combination of raw data and an accessor defining
     ///things that should not be definable. Yes, that's another rant.
     void ReadSource(XmlNode &node);
+    void ReadSource(XmlStreamReader &reader);
 
     /// Reads a data array holding a number of elements, and stores it in the global library.
     /// Currently supported are array of floats and arrays of strings.
     void ReadDataArray(XmlNode &node);
+    void ReadDataArray(XmlStreamReader &reader);
+
+    /// Decodes the text of a data array and stores the values in the global library.
+    void ReadDataArrayValues(const std::string &pID, bool pIsStringArray, unsigned int pCount, const std::string &pText);
 
     /// Reads an accessor and stores it in the global library under the given ID -
     /// accessors use the ID of the parent <source> element
@@ -174,12 +191,13 @@ public:
 
     /// Reads input declarations of per-index mesh data into the given mesh
     void ReadIndexData(XmlNode &node, Collada::Mesh &pMesh);
+    void ReadIndexData(XmlStreamReader &reader, Collada::Mesh &pMesh);
 
     /// Reads a single input channel element and stores it in the given array, if valid
     void ReadInputChannel(XmlNode &node, std::vector<Collada::InputChannel> &poChannels);
 
-    /// Reads a <p> primitive index list and assembles the mesh data into the given mesh
-    size_t ReadPrimitives(XmlNode &node, Collada::Mesh &pMesh, std::vector<Collada::InputChannel> &pPerIndexChannels,
+    /// Reads the text of a <p> primitive index list and assembles the mesh data into the given mesh
+    size_t ReadPrimitives(const std::string &pText, Collada::Mesh &pMesh, std::vector<Collada::InputChannel> &pPerIndexChannels,
             size_t pNumPrimitives, const std::vector<size_t> &pVCount, Collada::PrimitiveType pPrimType);
 
     /// Copies the data for a single primitive into the mesh, based on the InputChannels
@@ -233,6 +251,9 @@ private:
     /// XML reader, member for everyday use
     XmlParser mXmlParser;
 
+    /// Decodes large data arrays in parallel, nullptr if single-threaded
+    std::unique_ptr<ThreadPool> mThreadPool;
+
     /// All data arrays found in the file by ID. Might be referred to by actually
     ///     everyone. Collada, you are a steaming pile of indirection.
     using DataLibrary = std::map<std::string, Collada::Data> ;
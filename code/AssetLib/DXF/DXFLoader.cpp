@@ -1231,23 +1231,23 @@ void DXFImporter::Parse3DFace(DXF::LineReader& reader, DXF::FileData& output) {
     }
 }
 
-void ParseLWPolyLine(DXF::LineReader& /*reader*/, DXF::FileData& /*output*/)
+void DXFImporter::ParseLWPolyLine(DXF::LineReader& /*reader*/, DXF::FileData& /*output*/)
 {
     ASSIMP_LOG_WARN("DXF: LWPolyLine not currently supported; ignoring");
 }
-void Parse3DSolid(DXF::LineReader& /*reader*/, DXF::FileData& /*output*/)
+void DXFImporter::Parse3DSolid(DXF::LineReader& /*reader*/, DXF::FileData& /*output*/)
 {
     ASSIMP_LOG_WARN("DXF: 3DSOLID not currently supported; ignoring");
 }
-void ParseMesh(DXF::LineReader& /*reader*/, DXF::FileData& /*output*/)
+void DXFImporter::ParseMesh(DXF::LineReader& /*reader*/, DXF::FileData& /*output*/)
 {
     ASSIMP_LOG_WARN("DXF: MESH not currently supported; ignoring");
 }
-void ParseSurface(DXF::LineReader& /*reader*/, DXF::FileData& /*output*/)
+void DXFImporter::ParseSurface(DXF::LineReader& /*reader*/, DXF::FileData& /*output*/)
 {
     ASSIMP_LOG_WARN("DXF: Surface not currently supported; ignoring");
 }
-void ParseAcShClass(DXF::LineReader& /*reader*/, DXF::FileData& /*output*/)
+void DXFImporter::ParseAcShClass(DXF::LineReader& /*reader*/, DXF::FileData& /*output*/)
 {
     ASSIMP_LOG_WARN("DXF: AcShClass not currently supported; ignoring");
 }
@@ -55,6 +55,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/ByteSwapper.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/StringUtils.h>
+#include <assimp/IOStream.hpp>
 
 namespace Assimp {
 namespace FBX {
@@ -68,7 +69,8 @@ Token::Token(const char* sbegin, const char* send, TokenType type, size_t offset
         send(send),
         type(type),
         line(offset),
-        column(BINARY_MARKER) {
+        column(BINARY_MARKER),
+        deferred(nullptr) {
     ai_assert(sbegin);
     ai_assert(send);
 
@@ -77,6 +79,22 @@ Token::Token(const char* sbegin, const char* send, TokenType type, size_t offset
     ai_assert(send >= sbegin);
 }
 
+// ------------------------------------------------------------------------------------------------
+Token::Token(const char* sbegin, const char* send, size_t offset, const DeferredDataSource &source) :
+        #ifdef DEBUG
+        contents(sbegin, static_cast<size_t>(send-sbegin)),
+        #endif
+        sbegin(sbegin),
+        send(send),
+        type(TokenType_DATA),
+        line(offset),
+        column(BINARY_MARKER),
+        deferred(&source) {
+    ai_assert(sbegin);
+    ai_assert(send);
+    ai_assert(send >= sbegin);
+}
+
 
 namespace {
 
@@ -179,6 +197,42 @@ unsigned int ReadString(const char*& sbegin_out, const char*& send_out, const ch
     return length;
 }
 
+// ------------------------------------------------------------------------------------------------
+// validate the header of a data array: the element count, encoding and compressed length
+void CheckArrayHead(char type, uint32_t length, uint32_t encoding, uint32_t comp_len, size_t offset) {
+    // compute length based on type and check against the stored value
+    if(encoding == 0) {
+        uint32_t stride = 0;
+        switch(type)
+        {
+        case 'f':
+        case 'i':
+            stride = 4;
+            break;
+
+        case 'd':
+        case 'l':
+            stride = 8;
+            break;
+
+        case 'c':
+            stride = 1;
+            break;
+
+        default:
+            ai_assert(false);
+        };
+        ai_assert(stride > 0);
+        if(length * stride != comp_len) {
+            TokenizeError("cannot ReadData, calculated data stride differs from what the file claims", offset);
+        }
+    }
+    // zip/deflate algorithm (encoding==1)? take given length. anything else? die
+    else if (encoding != 1) {
+        TokenizeError("cannot ReadData, unknown encoding", offset);
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 void ReadData(const char*& sbegin_out, const char*& send_out, const char* input, const char*& cursor, const char* end) {
     if(Offset(cursor, end) < 1) {
@@ -246,37 +300,7 @@ void ReadData(const char*& sbegin_out, const char*& send_out, const char* input,
 
         const uint32_t comp_len = ReadWord(input, cursor, end);
 
-        // compute length based on type and check against the stored value
-        if(encoding == 0) {
-            uint32_t stride = 0;
-            switch(type)
-            {
-            case 'f':
-            case 'i':
-                stride = 4;
-                break;
-
-            case 'd':
-            case 'l':
-                stride = 8;
-                break;
-
-            case 'c':
-                stride = 1;
-                break;
-
-            default:
-                ai_assert(false);
-            };
-            ai_assert(stride > 0);
-            if(length * stride != comp_len) {
-                TokenizeError("cannot ReadData, calculated data stride differs from what the file claims",input, cursor);
-            }
-        }
-        // zip/deflate algorithm (encoding==1)? take given length. anything else? die
-        else if (encoding != 1) {
-            TokenizeError("cannot ReadData, unknown encoding",input, cursor);
-        }
+        CheckArrayHead(type, length, encoding, comp_len, Offset(input, cursor));
         cursor += comp_len;
         break;
     }
@@ -387,6 +411,289 @@ bool ReadScope(TokenList &output_tokens, StackAllocator &token_allocator, const
     return true;
 }
 
+// ------------------------------------------------------------------------------------------------
+// streaming tokenizer
+// ------------------------------------------------------------------------------------------------
+
+// array properties consist of the type code, element count, encoding and compressed length
+static constexpr size_t ArrayHeaderLength = 1 + sizeof(uint32_t) * 3;
+
+// dummy contents for the structural tokens, which only matter by their type
+static const char StructureChars[] = ",{}";
+
+// ------------------------------------------------------------------------------------------------
+uint32_t DecodeWord(const char* data) {
+    uint32_t word;
+    ::memcpy(&word, data, sizeof(uint32_t));
+    AI_SWAP4(word);
+    return word;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Buffered forward reader on top of an IOStream. Keeps track of the absolute file offset, so
+// tokens and errors carry the same offsets as with the in-memory tokenizer.
+class StreamCursor {
+public:
+    static constexpr size_t BufferSize = 1 << 16;
+
+    explicit StreamCursor(IOStream &stream) :
+            mStream(stream), mFileSize(stream.FileSize()), mBuffer(BufferSize), mBufferOffset(0), mPos(0), mFill(0) {
+        mStream.Seek(0, aiOrigin_SET);
+    }
+
+    size_t Offset() const {
+        return mBufferOffset + mPos;
+    }
+
+    size_t FileSize() const {
+        return mFileSize;
+    }
+
+    void Read(char *out, size_t length) {
+        while (length) {
+            if (mPos == mFill) {
+                Refill();
+            }
+            const size_t n = std::min(length, mFill - mPos);
+            ::memcpy(out, &mBuffer[mPos], n);
+            mPos += n;
+            out += n;
+            length -= n;
+        }
+    }
+
+    void Skip(size_t length) {
+        if (length <= mFill - mPos) {
+            mPos += length;
+            return;
+        }
+        const size_t target = Offset() + length;
+        if (target > mFileSize || mStream.Seek(target, aiOrigin_SET) != aiReturn_SUCCESS) {
+            TokenizeError("cannot skip data, out of bounds", Offset());
+        }
+        mBufferOffset = target;
+        mPos = mFill = 0;
+    }
+
+private:
+    void Refill() {
+        mBufferOffset += mFill;
+        mPos = 0;
+        mFill = mStream.Read(&mBuffer[0], 1, BufferSize);
+        if (!mFill) {
+            TokenizeError("unexpected end of file", mBufferOffset);
+        }
+    }
+
+    IOStream &mStream;
+    const size_t mFileSize;
+    std::vector<char> mBuffer;
+    size_t mBufferOffset;
+    size_t mPos;
+    size_t mFill;
+};
+
+// ------------------------------------------------------------------------------------------------
+// allocate token contents next to the tokens, keeping the allocator aligned for them
+char* AllocateContents(StackAllocator &token_allocator, size_t length) {
+    const size_t align = alignof(Token);
+    return static_cast<char*>(token_allocator.Allocate(std::max<size_t>((length + align - 1) & ~(align - 1), align)));
+}
+
+// ------------------------------------------------------------------------------------------------
+void ReadBytes(StreamCursor &cursor, size_t end, char *out, size_t length, const char *what) {
+    if (cursor.Offset() > end || end - cursor.Offset() < length) {
+        TokenizeError(std::string("cannot ") + what + ", out of bounds", cursor.Offset());
+    }
+    cursor.Read(out, length);
+}
+
+// ------------------------------------------------------------------------------------------------
+uint32_t ReadWord(StreamCursor &cursor, size_t end) {
+    char data[sizeof(uint32_t)];
+    ReadBytes(cursor, end, data, sizeof(data), "ReadWord");
+    return DecodeWord(data);
+}
+
+// ------------------------------------------------------------------------------------------------
+uint64_t ReadDoubleWord(StreamCursor &cursor, size_t end) {
+    uint64_t dword;
+    ReadBytes(cursor, end, reinterpret_cast<char*>(&dword), sizeof(uint64_t), "ReadDoubleWord");
+    AI_SWAP8(dword);
+    return dword;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Streaming counterpart of ReadData(). The property is copied to the token allocator, except for
+// the payload of arrays with at least deferThreshold bytes which is skipped. Returns true then.
+bool ReadData(const char*& sbegin_out, const char*& send_out, StreamCursor& cursor, size_t end,
+        StackAllocator &token_allocator, size_t deferThreshold) {
+    char head[ArrayHeaderLength];
+    ReadBytes(cursor, end, head, 1, "ReadData");
+
+    const char type = head[0];
+    size_t head_length = 1;
+    size_t length = 0;
+    bool defer = false;
+
+    switch(type)
+    {
+    case 'Y':
+        length = 2;
+        break;
+
+    case 'C':
+        length = 1;
+        break;
+
+    case 'I':
+    case 'F':
+        length = 4;
+        break;
+
+    case 'D':
+    case 'L':
+        length = 8;
+        break;
+
+        // raw binary data and strings, the latter may contain 0 characters
+    case 'R':
+    case 'S':
+        ReadBytes(cursor, end, head + 1, sizeof(uint32_t), "ReadData");
+        head_length += sizeof(uint32_t);
+        length = DecodeWord(head + 1);
+        break;
+
+    case 'b':
+        // see ReadData() above - take the full range we could get
+        length = end > cursor.Offset() ? end - cursor.Offset() : 0;
+        break;
+
+        // array of *
+    case 'f':
+    case 'd':
+    case 'l':
+    case 'i':
+    case 'c': {
+        ReadBytes(cursor, end, head + 1, ArrayHeaderLength - 1, "ReadData");
+        head_length = ArrayHeaderLength;
+        length = DecodeWord(head + 9);
+        CheckArrayHead(type, DecodeWord(head + 1), DecodeWord(head + 5), static_cast<uint32_t>(length), cursor.Offset());
+        defer = length >= deferThreshold;
+        break;
+    }
+
+    default:
+        TokenizeError("cannot ReadData, unexpected type code: " + std::string(&type, 1), cursor.Offset());
+    }
+
+    if (cursor.Offset() > end || end - cursor.Offset() < length) {
+        TokenizeError("cannot ReadData, the remaining size is too small for the data type: " + std::string(&type, 1), cursor.Offset());
+    }
+
+    // the type code is contained in the returned range
+    const size_t stored = defer ? head_length : head_length + length;
+    char *data = AllocateContents(token_allocator, stored);
+    ::memcpy(data, head, head_length);
+    if (defer) {
+        cursor.Skip(length);
+    } else {
+        cursor.Read(data + head_length, length);
+    }
+
+    sbegin_out = data;
+    send_out = data + stored;
+    return defer;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Streaming counterpart of ReadScope(), end is the absolute file offset of the enclosing scope end
+bool ReadScope(TokenList &output_tokens, StackAllocator &token_allocator, StreamCursor &cursor, size_t end,
+        bool const is64bits, const DeferredDataSource &source, size_t deferThreshold) {
+    // the first word contains the offset at which this block ends
+    const uint64_t end_offset = is64bits ? ReadDoubleWord(cursor, end) : ReadWord(cursor, end);
+
+    // see ReadScope() above for the trailing 0 record
+    if(!end_offset) {
+        return false;
+    }
+
+    if(end_offset > end) {
+        TokenizeError("block offset is out of range", cursor.Offset());
+    }
+    else if(end_offset < cursor.Offset()) {
+        TokenizeError("block offset is negative out of range", cursor.Offset());
+    }
+
+    const uint64_t prop_count = is64bits ? ReadDoubleWord(cursor, end) : ReadWord(cursor, end);
+    const uint64_t prop_length = is64bits ? ReadDoubleWord(cursor, end) : ReadWord(cursor, end);
+
+    // now comes the name of the scope/key
+    char name_length;
+    ReadBytes(cursor, end, &name_length, 1, "ReadString");
+    const size_t name_size = static_cast<uint8_t>(name_length);
+    char *name = AllocateContents(token_allocator, name_size);
+    ReadBytes(cursor, end, name, name_size, "ReadString");
+    if (nullptr != ::memchr(name, '\0', name_size)) {
+        TokenizeError("failed ReadString, unexpected NUL character in string", cursor.Offset());
+    }
+
+    output_tokens.push_back(new_Token(name, name + name_size, TokenType_KEY, cursor.Offset()));
+
+    // now come the individual properties
+    const size_t begin_cursor = cursor.Offset();
+
+    if (prop_length > end - begin_cursor) {
+        TokenizeError("property length out of bounds reading length ", cursor.Offset());
+    }
+
+    const char *sbeg, *send;
+    for (unsigned int i = 0; i < prop_count; ++i) {
+        if (ReadData(sbeg, send, cursor, begin_cursor + prop_length, token_allocator, deferThreshold)) {
+            output_tokens.push_back(new_Token(sbeg, send, cursor.Offset(), source));
+        } else {
+            output_tokens.push_back(new_Token(sbeg, send, TokenType_DATA, cursor.Offset()));
+        }
+
+        if(i != prop_count-1) {
+            output_tokens.push_back(new_Token(StructureChars, StructureChars + 1, TokenType_COMMA, cursor.Offset()));
+        }
+    }
+
+    if (cursor.Offset() - begin_cursor != prop_length) {
+        TokenizeError("property length not reached, something is wrong", cursor.Offset());
+    }
+
+    const size_t sentinel_block_length = is64bits ? (sizeof(uint64_t)* 3 + 1) : (sizeof(uint32_t)* 3 + 1);
+
+    if (cursor.Offset() < end_offset) {
+        if (end_offset - cursor.Offset() < sentinel_block_length) {
+            TokenizeError("insufficient padding bytes at block end", cursor.Offset());
+        }
+
+        output_tokens.push_back(new_Token(StructureChars + 1, StructureChars + 2, TokenType_OPEN_BRACKET, cursor.Offset()));
+
+        while(cursor.Offset() < end_offset - sentinel_block_length) {
+            ReadScope(output_tokens, token_allocator, cursor, end_offset - sentinel_block_length, is64bits, source, deferThreshold);
+        }
+        output_tokens.push_back(new_Token(StructureChars + 2, StructureChars + 3, TokenType_CLOSE_BRACKET, cursor.Offset()));
+
+        char sentinel[sizeof(uint64_t) * 3 + 1];
+        ReadBytes(cursor, end_offset, sentinel, sentinel_block_length, "ReadData");
+        for (unsigned int i = 0; i < sentinel_block_length; ++i) {
+            if(sentinel[i] != '\0') {
+                TokenizeError("failed to read nested block sentinel, expected all bytes to be 0", cursor.Offset());
+            }
+        }
+    }
+
+    if (cursor.Offset() != end_offset) {
+        TokenizeError("scope length not reached, something is wrong", cursor.Offset());
+    }
+
+    return true;
+}
+
 } // anonymous namespace
 
 // ------------------------------------------------------------------------------------------------
@@ -438,6 +745,73 @@ void TokenizeBinary(TokenList &output_tokens, const char *input, size_t length,
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+void TokenizeBinary(TokenList &output_tokens, IOStream &stream, StackAllocator &token_allocator,
+        const DeferredDataSource &source, size_t deferThreshold) {
+    ASSIMP_LOG_DEBUG("Tokenizing binary FBX file from stream");
+
+    StreamCursor cursor(stream);
+    const size_t length = cursor.FileSize();
+    if(length < 0x1b) {
+        TokenizeError("file is too short",0);
+    }
+
+    char head[0x1b];
+    cursor.Read(head, sizeof(head));
+    if (strncmp(head,"Kaydara FBX Binary",18)) {
+        TokenizeError("magic bytes not found",0);
+    }
+
+    // the magic is followed by five bytes we don't care about and the version
+    const uint32_t version = DecodeWord(head + 23);
+    ASSIMP_LOG_DEBUG("FBX version: ", version);
+    const bool is64bits = version >= 7500;
+    try
+    {
+        while (cursor.Offset() < length) {
+            if (!ReadScope(output_tokens, token_allocator, cursor, length, is64bits, source, deferThreshold)) {
+                break;
+            }
+        }
+    }
+    catch (const DeadlyImportError& e)
+    {
+        if (!is64bits && (length > std::numeric_limits<uint32_t>::max())) {
+            throw DeadlyImportError("The FBX file is invalid. This may be because the content is too big for this older version (", ai_to_string(version), ") of the FBX format. (", e.what(), ")");
+        }
+        throw;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void DeferredDataSource::Read(size_t fileOffset, size_t length, char *out) const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mStream.Seek(fileOffset, aiOrigin_SET) != aiReturn_SUCCESS || mStream.Read(out, 1, length) != length) {
+        TokenizeError("cannot read deferred array data", fileOffset);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void Token::GetBinaryContents(std::vector<char> &storage, const char *&out_begin, const char *&out_end) const {
+    if (nullptr == deferred) {
+        out_begin = sbegin;
+        out_end = send;
+        return;
+    }
+
+    // only the array header is in memory, it ends with the compressed length of
+    // the payload which in turn ends at the token offset
+    ai_assert(static_cast<size_t>(send - sbegin) == ArrayHeaderLength);
+    const uint32_t comp_len = DecodeWord(send - sizeof(uint32_t));
+
+    storage.resize(ArrayHeaderLength + comp_len);
+    std::copy(sbegin, send, storage.begin());
+    deferred->Read(offset - comp_len, comp_len, storage.data() + ArrayHeaderLength);
+
+    out_begin = storage.data();
+    out_end = out_begin + storage.size();
+}
+
 } // !FBX
 } // !Assimp
 
@@ -479,7 +479,7 @@ void FBX::Node::WritePropertyNodeAscii(
 }
 
 // binary property node from vector of doubles
-// TODO: optional zip compression!
+// always uncompressed, see FBXExportProperty::Compress()
 void FBX::Node::WritePropertyNodeBinary(
     const std::string& name,
     const std::vector<double>& v,
@@ -497,7 +497,7 @@ void FBX::Node::WritePropertyNodeBinary(
 }
 
 // binary property node from vector of int32_t
-// TODO: optional zip compression!
+// always uncompressed, see FBXExportProperty::Compress()
 void FBX::Node::WritePropertyNodeBinary(
     const std::string& name,
     const std::vector<int32_t>& v,
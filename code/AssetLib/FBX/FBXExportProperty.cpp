@@ -45,6 +45,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/StreamWriter.h> // StreamWriterLE
 #include <assimp/Exceptional.h> // DeadlyExportError
+#include <assimp/ByteSwapper.h>
+
+#include "zlib.h"
 
 #include <string>
 #include <vector>
@@ -180,6 +183,8 @@ size_t FBXExportProperty::size() {
         case 'R':
             return data.size() + 5;
         case 'i':
+        case 'l':
+        case 'f':
         case 'd':
             return data.size() + 13;
         default:
@@ -187,10 +192,57 @@ size_t FBXExportProperty::size() {
     }
 }
 
+bool FBXExportProperty::IsArray() const {
+    return type == 'i' || type == 'l' || type == 'f' || type == 'd';
+}
+
+void FBXExportProperty::Compress(int level) {
+    if (!IsArray() || compressed || data.empty()) {
+        return;
+    }
+    const size_t element_size = (type == 'i' || type == 'f') ? 4 : 8;
+
+    // the file stores the elements in little endian byte order,
+    // the compressed stream has to contain them the same way.
+    const uint8_t* src = data.data();
+#ifdef AI_BUILD_BIG_ENDIAN
+    std::vector<uint8_t> le(data);
+    for (size_t i = 0; i < le.size(); i += element_size) {
+        if (element_size == 4) {
+            ByteSwap::Swap4(&le[i]);
+        } else {
+            ByteSwap::Swap8(&le[i]);
+        }
+    }
+    src = le.data();
+#endif
+
+    uLongf length = compressBound(static_cast<uLong>(data.size()));
+    std::vector<uint8_t> deflated(length);
+    const int res = compress2(deflated.data(), &length, src, static_cast<uLong>(data.size()), level);
+    if (res != Z_OK) {
+        throw DeadlyExportError("FBX: failed to compress array property");
+    }
+    if (length >= data.size()) {
+        return; // not worth it, keep the raw data
+    }
+    deflated.resize(length);
+    num_elements = data.size() / element_size;
+    data.swap(deflated);
+    compressed = true;
+}
+
 void FBXExportProperty::DumpBinary(Assimp::StreamWriterLE& s) {
     s.PutU1(type);
     uint8_t* d = data.data();
     size_t N;
+    if (compressed) {
+        s.PutU4(uint32_t(num_elements)); // number of elements
+        s.PutU4(1); // zip-compressed
+        s.PutU4(uint32_t(data.size())); // compressed data size
+        for (size_t i = 0; i < data.size(); ++i) { s.PutU1(data[i]); }
+        return;
+    }
     switch (type) {
         case 'C': s.PutU1(*(reinterpret_cast<uint8_t*>(d))); return;
         case 'Y': s.PutI2(*(reinterpret_cast<int16_t*>(d))); return;
@@ -207,7 +259,6 @@ void FBXExportProperty::DumpBinary(Assimp::StreamWriterLE& s) {
             N = data.size() / 4;
             s.PutU4(uint32_t(N)); // number of elements
             s.PutU4(0); // no encoding (1 would be zip-compressed)
-            // TODO: compress if large?
             s.PutU4(uint32_t(data.size())); // data size
             for (size_t i = 0; i < N; ++i) {
                 s.PutI4((reinterpret_cast<int32_t*>(d))[i]);
@@ -217,7 +268,6 @@ void FBXExportProperty::DumpBinary(Assimp::StreamWriterLE& s) {
             N = data.size() / 8;
             s.PutU4(uint32_t(N)); // number of elements
             s.PutU4(0); // no encoding (1 would be zip-compressed)
-            // TODO: compress if large?
             s.PutU4(uint32_t(data.size())); // data size
             for (size_t i = 0; i < N; ++i) {
                 s.PutI8((reinterpret_cast<int64_t*>(d))[i]);
@@ -227,7 +277,6 @@ void FBXExportProperty::DumpBinary(Assimp::StreamWriterLE& s) {
             N = data.size() / 4;
             s.PutU4(uint32_t(N)); // number of elements
             s.PutU4(0); // no encoding (1 would be zip-compressed)
-            // TODO: compress if large?
             s.PutU4(uint32_t(data.size())); // data size
             for (size_t i = 0; i < N; ++i) {
                 s.PutF4((reinterpret_cast<float*>(d))[i]);
@@ -237,7 +286,6 @@ void FBXExportProperty::DumpBinary(Assimp::StreamWriterLE& s) {
             N = data.size() / 8;
             s.PutU4(uint32_t(N)); // number of elements
             s.PutU4(0); // no encoding (1 would be zip-compressed)
-            // TODO: compress if large?
             s.PutU4(uint32_t(data.size())); // data size
             for (size_t i = 0; i < N; ++i) {
                 s.PutF8((reinterpret_cast<double*>(d))[i]);
@@ -260,6 +308,9 @@ void FBXExportProperty::DumpAscii(Assimp::StreamWriterLE& outstream, int indent)
 }
 
 void FBXExportProperty::DumpAscii(std::ostream& s, int indent) {
+    if (compressed) {
+        throw DeadlyExportError("Tried to dump compressed property as ascii");
+    }
     // no writing type... or anything. just shove it into the stream.
     uint8_t* d = data.data();
     size_t N;
@@ -110,6 +110,15 @@ public:
     // the size of this property node in a binary file, in bytes
     size_t size();
 
+    // whether this is an array property ('i', 'l', 'f' or 'd'),
+    // which can be stored deflated in a binary file
+    bool IsArray() const;
+
+    // deflate the data of an array property with the given zlib level.
+    // the data is kept as it is if compression doesn't make it smaller.
+    // a compressed property can only be written to a binary file.
+    void Compress(int level);
+
     // write this property node as binary data to the given stream
     void DumpBinary(Assimp::StreamWriterLE& s);
     void DumpAscii(Assimp::StreamWriterLE& s, int indent = 0);
@@ -119,6 +128,8 @@ public:
 private:
     char type;
     std::vector<uint8_t> data;
+    bool compressed = false; // data holds the deflated array
+    size_t num_elements = 0; // element count of a compressed array
 };
 
 } // Namespace FBX
@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FBXExportProperty.h"
 #include "FBXCommon.h"
 #include "FBXUtil.h"
+#include "Common/ThreadPool.h"
 
 #include <assimp/version.h> // aiGetVersion
 #include <assimp/IOSystem.hpp>
@@ -59,6 +60,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/mesh.h>
 
 // Header files, standard library.
+#include <algorithm>
 #include <array>
 #include <ctime> // localtime, tm_*
 #include <map>
@@ -97,6 +99,8 @@ namespace FBX {
         "\xf8\x5a\x8c\x6a\xde\xf5\xd9\x7e\xec\xe9\x0c\xe3\x75\x8f\x29\x0b";
     const std::string COMMENT_UNDERLINE =
         ";------------------------------------------------------------------";
+    // arrays at least this big (in bytes) are deflated by default
+    const int DEFAULT_COMPRESSION_THRESHOLD = 1024;
 }
 
     // ---------------------------------------------------------------------
@@ -148,6 +152,8 @@ FBXExporter::FBXExporter ( const aiScene* pScene, const ExportProperties* pPrope
     // before we start writing sections to the stream.
 }
 
+FBXExporter::~FBXExporter() = default;
+
 void FBXExporter::ExportBinary (
     const char* pFile,
     IOSystem* pIOSystem
@@ -155,10 +161,15 @@ void FBXExporter::ExportBinary (
     // remember that we're exporting in binary mode
     binary = true;
 
-    // we're not currently using these preferences,
-    // but clang will cry about it if we never touch it.
-    // TODO: some of these might be relevant to export
-    (void)mProperties;
+    // large arrays are stored deflated, as the FBX SDK does it
+    compression_threshold = static_cast<size_t>(std::max(0, mProperties->GetPropertyInteger(
+            AI_CONFIG_EXPORT_FBX_COMPRESSION_THRESHOLD, FBX::DEFAULT_COMPRESSION_THRESHOLD)));
+    compression_level = std::min(9, std::max(1, mProperties->GetPropertyInteger(
+            AI_CONFIG_EXPORT_FBX_COMPRESSION_LEVEL, 6)));
+    if (compression_threshold > 0) {
+        const int threads = mProperties->GetPropertyInteger(AI_CONFIG_EXPORT_FBX_COMPRESSION_THREADS, 1);
+        compression_pool.reset(new ThreadPool(static_cast<unsigned int>(std::max(0, threads))));
+    }
 
     // open the indicated file for writing (in binary mode)
     outfile.reset(pIOSystem->Open(pFile,"wb"));
@@ -237,6 +248,61 @@ void FBXExporter::WriteAsciiSectionHeader(const std::string& title)
     outstream.PutString(s.str());
 }
 
+static void CollectArrays(
+    FBX::Node& node,
+    size_t threshold,
+    std::vector<FBX::FBXExportProperty*>& arrays
+) {
+    for (auto &p : node.properties) {
+        if (p.IsArray() && p.size() >= threshold) {
+            arrays.push_back(&p);
+        }
+    }
+    for (auto &child : node.children) {
+        CollectArrays(child, threshold, arrays);
+    }
+}
+
+static void DeflateArrays(
+    ThreadPool& pool,
+    int level,
+    const std::vector<FBX::FBXExportProperty*>& arrays
+) {
+    // the arrays are independent of each other,
+    // so they can all be deflated at the same time.
+    pool.ParallelFor(arrays.size(), [&arrays, level](size_t i) {
+        arrays[i]->Compress(level);
+    });
+}
+
+void FBXExporter::CompressArrays(std::vector<FBX::Node>& nodes)
+{
+    if (!binary || compression_threshold == 0) {
+        return;
+    }
+    std::vector<FBX::FBXExportProperty*> arrays;
+    for (auto &n : nodes) {
+        CollectArrays(n, compression_threshold, arrays);
+    }
+    DeflateArrays(*compression_pool, compression_level, arrays);
+}
+
+void FBXExporter::CompressArrays(FBX::Node& node)
+{
+    if (!binary || compression_threshold == 0) {
+        return;
+    }
+    std::vector<FBX::FBXExportProperty*> arrays;
+    CollectArrays(node, compression_threshold, arrays);
+    DeflateArrays(*compression_pool, compression_level, arrays);
+}
+
+void FBXExporter::DumpNode(FBX::Node& node, StreamWriterLE& s, int indent)
+{
+    CompressArrays(node);
+    node.Dump(s, binary, indent);
+}
+
 void FBXExporter::WriteBinaryHeader()
 {
     // first a specific sequence of 23 bytes, always the same
@@ -1268,8 +1334,30 @@ void FBXExporter::WriteObjects () {
         }
 
 
-        FBX::Node::WritePropertyNode("Vertices", flattened_vertices, outstream, binary, indent);
-        FBX::Node::WritePropertyNode("PolygonVertexIndex", polygon_data, outstream, binary, indent);
+        // when compressing, the big arrays are turned into nodes up front,
+        // so all of them are deflated together before the geometry is written.
+        std::vector<FBX::Node> arrays;
+        if (binary && compression_threshold > 0) {
+            arrays.emplace_back("Vertices", FBX::FBXExportProperty(flattened_vertices));
+            arrays.emplace_back("PolygonVertexIndex", FBX::FBXExportProperty(polygon_data));
+            arrays.emplace_back("Normals", FBX::FBXExportProperty(normal_data));
+            arrays.emplace_back("Colors", FBX::FBXExportProperty(color_data));
+            for (uint32_t uvi = 0; uvi < uv_data.size(); uvi++) {
+                arrays.emplace_back("UV", FBX::FBXExportProperty(uv_data[uvi]));
+                arrays.emplace_back("UVIndex", FBX::FBXExportProperty(uv_indices[uvi]));
+            }
+            CompressArrays(arrays);
+        }
+        auto writeArray = [&](size_t slot, const std::string& name, const auto& v) {
+            if (arrays.empty()) {
+                FBX::Node::WritePropertyNode(name, v, outstream, binary, indent);
+            } else {
+                arrays[slot].Dump(outstream, binary, indent);
+            }
+        };
+
+        writeArray(0, "Vertices", flattened_vertices);
+        writeArray(1, "PolygonVertexIndex", polygon_data);
         FBX::Node::WritePropertyNode("GeometryVersion", int32_t(124), outstream, binary, indent);
 
 	if (!normal_data.empty()) {
@@ -1283,7 +1371,7 @@ void FBXExporter::WriteObjects () {
 	    FBX::Node::WritePropertyNode("Name", "", outstream, binary, indent);
 	    FBX::Node::WritePropertyNode("MappingInformationType", "ByPolygonVertex", outstream, binary, indent);
 	    FBX::Node::WritePropertyNode("ReferenceInformationType", "Direct", outstream, binary, indent);
-	    FBX::Node::WritePropertyNode("Normals", normal_data, outstream, binary, indent);
+	    writeArray(2, "Normals", normal_data);
 	    // note: version 102 has a NormalsW also... not sure what it is,
 	    // so stick with version 101 for now.
 	    indent = 2;
@@ -1304,7 +1392,7 @@ void FBXExporter::WriteObjects () {
 	    FBX::Node::WritePropertyNode("Name", (const char *)layerName, outstream, binary, indent);
 	    FBX::Node::WritePropertyNode("MappingInformationType", "ByPolygonVertex", outstream, binary, indent);
 	    FBX::Node::WritePropertyNode("ReferenceInformationType", "Direct", outstream, binary, indent);
-	    FBX::Node::WritePropertyNode("Colors", color_data, outstream, binary, indent);
+	    writeArray(3, "Colors", color_data);
 	    indent = 2;
 	    vertexcolors.End(outstream, binary, indent, true);
         }
@@ -1320,8 +1408,8 @@ void FBXExporter::WriteObjects () {
           FBX::Node::WritePropertyNode("Name", "", outstream, binary, indent);
           FBX::Node::WritePropertyNode("MappingInformationType", "ByPolygonVertex", outstream, binary, indent);
           FBX::Node::WritePropertyNode("ReferenceInformationType", "IndexToDirect", outstream, binary, indent);
-          FBX::Node::WritePropertyNode("UV", uv_data[uvi], outstream, binary, indent);
-          FBX::Node::WritePropertyNode("UVIndex", uv_indices[uvi], outstream, binary, indent);
+          writeArray(4 + 2 * uvi, "UV", uv_data[uvi]);
+          writeArray(5 + 2 * uvi, "UVIndex", uv_indices[uvi]);
           indent = 2;
           uv.End(outstream, binary, indent, true);
         }
@@ -1351,7 +1439,7 @@ void FBXExporter::WriteObjects () {
           }
           mat.AddChild("Materials", mat_indices);
         }
-        mat.Dump(outstream, binary, indent);
+        DumpNode(mat, outstream, indent);
 
         // finally we have the layer specifications,
         // which select the normals / UV set / etc to use.
@@ -1382,7 +1470,7 @@ void FBXExporter::WriteObjects () {
         le.AddChild("Type", "LayerElementUV");
         le.AddChild("TypedIndex", int32_t(0));
         layer.AddChild(le);
-        layer.Dump(outstream, binary, indent);
+        DumpNode(layer, outstream, indent);
 
         for(unsigned int lr = 1; lr < uv_data.size(); ++ lr) {
             FBX::Node layerExtra("Layer", int32_t(lr));
@@ -1391,7 +1479,7 @@ void FBXExporter::WriteObjects () {
             leExtra.AddChild("Type", "LayerElementUV");
             leExtra.AddChild("TypedIndex", int32_t(lr));
             layerExtra.AddChild(leExtra);
-            layerExtra.Dump(outstream, binary, indent);
+            DumpNode(layerExtra, outstream, indent);
         }
         // finish the node record
         indent = 1;
@@ -1555,7 +1643,7 @@ void FBXExporter::WriteObjects () {
 
         n.AddChild(p);
 
-        n.Dump(outstream, binary, indent);
+        DumpNode(n, outstream, indent);
     }
 
     // we need to look up all the images we're using,
@@ -1637,7 +1725,7 @@ void FBXExporter::WriteObjects () {
         n.AddChild("UseMipMap", int32_t(0));
         n.AddChild("Filename", path);
         n.AddChild("RelativeFilename", path);
-        n.Dump(outstream, binary, indent);
+        DumpNode(n, outstream, indent);
     }
 
     // Textures
@@ -1774,7 +1862,7 @@ void FBXExporter::WriteObjects () {
             tnode.AddChild(
                 "Cropping", int32_t(0), int32_t(0), int32_t(0), int32_t(0)
             );
-            tnode.Dump(outstream, binary, indent);
+            DumpNode(tnode, outstream, indent);
         }
     }
 
@@ -1789,7 +1877,7 @@ void FBXExporter::WriteObjects () {
       FBX::Node dnode("Deformer");
       dnode.AddProperties(deformer_uid, m->mName.data + FBX::SEPARATOR + "Blendshapes", "BlendShape");
       dnode.AddChild("Version", int32_t(101));
-      dnode.Dump(outstream, binary, indent);
+      DumpNode(dnode, outstream, indent);
       // connect it
       const auto node = get_node_for_mesh((unsigned int)mi, mScene->mRootNode);
       connections.emplace_back("C", "OO", deformer_uid, mesh_uids[node]);
@@ -1836,18 +1924,31 @@ void FBXExporter::WriteObjects () {
               }
           }
 
-          FBX::Node::WritePropertyNode(
-              "Indexes", shape_indices, outstream, binary, indent
-          );
-
-          FBX::Node::WritePropertyNode(
-              "Vertices", pPositionDiff, outstream, binary, indent
-          );
+          if (binary && compression_threshold > 0) {
+            std::vector<FBX::Node> arrays;
+            arrays.emplace_back("Indexes", FBX::FBXExportProperty(shape_indices));
+            arrays.emplace_back("Vertices", FBX::FBXExportProperty(pPositionDiff));
+            if (pNormalDiff.size()>0) {
+              arrays.emplace_back("Normals", FBX::FBXExportProperty(pNormalDiff));
+            }
+            CompressArrays(arrays);
+            for (auto &n : arrays) {
+              n.Dump(outstream, binary, indent);
+            }
+          } else {
+            FBX::Node::WritePropertyNode(
+                "Indexes", shape_indices, outstream, binary, indent
+            );
 
-          if (pNormalDiff.size()>0) {
             FBX::Node::WritePropertyNode(
-                "Normals", pNormalDiff, outstream, binary, indent
+                "Vertices", pPositionDiff, outstream, binary, indent
             );
+
+            if (pNormalDiff.size()>0) {
+              FBX::Node::WritePropertyNode(
+                  "Normals", pNormalDiff, outstream, binary, indent
+              );
+            }
           }
         }
         indent--;
@@ -1868,7 +1969,7 @@ void FBXExporter::WriteObjects () {
         std::vector<double>fFullWeights;
         fFullWeights.push_back(100.);
         sdnode.AddChild("FullWeights", fFullWeights);
-        sdnode.Dump(outstream, binary, indent);
+        DumpNode(sdnode, outstream, indent);
 
         connections.emplace_back("C", "OO", blendchannel_uid, deformer_uid);
         connections.emplace_back("C", "OO", blendshape_uid, blendchannel_uid);
@@ -2037,7 +2138,7 @@ void FBXExporter::WriteObjects () {
         // "acuracy"... this is not a typo....
         dnode.AddChild("Link_DeformAcuracy", double(50));
         dnode.AddChild("SkinningType", "Linear"); // TODO: other modes?
-        dnode.Dump(outstream, binary, indent);
+        DumpNode(dnode, outstream, indent);
 
         // connect it
         connections.emplace_back("C", "OO", deformer_uid, mesh_uids[mesh_node]);
@@ -2134,7 +2235,7 @@ void FBXExporter::WriteObjects () {
             // there's not really any way around this at the moment.
 
             // done
-            sdnode.Dump(outstream, binary, indent);
+            DumpNode(sdnode, outstream, indent);
 
             // lastly, connect to the parent deformer
             connections.emplace_back(
@@ -2252,7 +2353,7 @@ void FBXExporter::WriteObjects () {
         }
 
         // now write it
-        bpnode.Dump(outstream, binary, indent);
+        DumpNode(bpnode, outstream, indent);
     }*/
 
     // lights
@@ -2307,7 +2408,7 @@ void FBXExporter::WriteObjects () {
         lna.AddChild(lnap);
         lna.AddChild("TypeFlags", FBX::FBXExportProperty("Light"));
         lna.AddChild("GeometryVersion", FBX::FBXExportProperty(int32_t(124)));
-        lna.Dump(outstream, binary, indent);
+        DumpNode(lna, outstream, indent);
 
         // Store name and uid (will be used later when parsing scene nodes)
         lights_uids[l->mName.C_Str()] = uid;
@@ -2370,7 +2471,7 @@ void FBXExporter::WriteObjects () {
         // this node absurdly always pretends it has children
         // (in this case it does, but just in case...)
         asnode.force_has_children = true;
-        asnode.Dump(outstream, binary, indent);
+        DumpNode(asnode, outstream, indent);
 
         // note: animation stacks are not connected to anything
     }
@@ -2385,7 +2486,7 @@ void FBXExporter::WriteObjects () {
 
         // this node absurdly always pretends it has children
         alnode.force_has_children = true;
-        alnode.Dump(outstream, binary, indent);
+        DumpNode(alnode, outstream, indent);
 
         // connect to the relevant animstack
         connections.emplace_back(
@@ -2654,7 +2755,7 @@ void FBXExporter::WriteModelNode(
     m.AddChild("Shading", FBXExportProperty(true));
     m.AddChild("Culling", FBXExportProperty("CullingOff"));
 
-    m.Dump(outstream, binary, 1);
+    DumpNode(m, outstream, 1);
 }
 
 // wrapper for WriteModelNodes to create and pass a blank transform chain
@@ -2764,7 +2865,7 @@ void FBXExporter::WriteModelNodes(
             node_attribute_uid, FBX::SEPARATOR + "NodeAttribute", "LimbNode"
         );
         na.AddChild("TypeFlags", FBXExportProperty("Skeleton"));
-        na.Dump(outstream, binary, 1);
+        DumpNode(na, outstream, 1);
         // and connect them
         connections.emplace_back("C", "OO", node_attribute_uid, node_uid);
     } else if (node->mNumMeshes >= 1) {
@@ -2832,7 +2933,7 @@ void FBXExporter::WriteAnimationCurveNode(
     p.AddP70numberA("d|Y", default_value.y);
     p.AddP70numberA("d|Z", default_value.z);
     n.AddChild(p);
-    n.Dump(outstream, binary, 1);
+    DumpNode(n, outstream, 1);
     // connect to layer
     this->connections.emplace_back("C", "OO", uid, layer_uid);
     // connect to bone
@@ -2861,7 +2962,7 @@ void FBXExporter::WriteAnimationCurve(
         "KeyAttrRefCount",
         std::vector<int32_t>{static_cast<int32_t>(times.size())}
     );
-    n.Dump(outstream, binary, 1);
+    DumpNode(n, outstream, 1);
     this->connections.emplace_back(
         "C", "OP", curve_uid, curvenode_uid, property_link
     );
@@ -68,6 +68,7 @@ namespace Assimp {
     class IOSystem;
     class IOStream;
     class ExportProperties;
+    class ThreadPool;
 
     // ---------------------------------------------------------------------
     /** Helper class to export a given scene to an FBX file. */
@@ -78,6 +79,9 @@ namespace Assimp {
         /// Constructor for a specific scene to export
         FBXExporter(const aiScene* pScene, const ExportProperties* pProperties);
 
+        /// Destructor
+        ~FBXExporter();
+
         // call one of these methods to export
         void ExportBinary(const char* pFile, IOSystem* pIOSystem);
         void ExportAscii(const char* pFile, IOSystem* pIOSystem);
@@ -85,9 +89,14 @@ namespace Assimp {
     private:
         bool binary; // whether current export is in binary or ascii format
         const aiScene* mScene; // the scene to export
-        const ExportProperties* mProperties; // currently unused
+        const ExportProperties* mProperties; // export settings
         std::shared_ptr<IOStream> outfile; // file to write to
 
+        // array compression, binary export only
+        size_t compression_threshold = 0; // minimum array size in bytes, 0 = off
+        int compression_level = 6; // zlib level
+        std::unique_ptr<ThreadPool> compression_pool; // deflates arrays concurrently
+
         std::vector<FBX::Node> connections; // connection storage
 
         std::map<const aiNode*, int64_t> mesh_uids;
@@ -131,6 +140,12 @@ namespace Assimp {
 
         // helpers
         void WriteAsciiSectionHeader(const std::string& title);
+        // deflate all large array properties of the given nodes
+        // and their children, using the compression pool
+        void CompressArrays(std::vector<FBX::Node>& nodes);
+        void CompressArrays(FBX::Node& node);
+        // compress the arrays of a node (if enabled), then write it
+        void DumpNode(FBX::Node& node, StreamWriterLE& s, int indent);
         void WriteModelNodes(
             Assimp::StreamWriterLE& s,
             const aiNode* node,
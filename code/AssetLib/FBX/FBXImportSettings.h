@@ -65,7 +65,9 @@ struct ImportSettings {
             optimizeEmptyAnimationCurves(true),
             useLegacyEmbeddedTextureNaming(false),
             removeEmptyBones(true),
-            convertToMeters(false) {
+            convertToMeters(false),
+            streamBinary(false),
+            inflateThreads(1) {
         // empty
     }
 
@@ -159,6 +161,14 @@ struct ImportSettings {
 
     // Set to true to ignore the axis configuration in the file
     bool ignoreUpDirection = false;
+
+    /** read binary files incrementally and load data arrays on demand,
+     *  see AI_CONFIG_IMPORT_FBX_STREAM_BINARY. */
+    bool streamBinary;
+
+    /** number of threads inflating the data arrays of binary files ahead of
+     *  parsing, 0 for all hardware threads, see AI_CONFIG_IMPORT_FBX_INFLATE_THREADS. */
+    unsigned int inflateThreads;
 };
 
 } // namespace FBX
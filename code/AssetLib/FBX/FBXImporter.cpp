@@ -72,6 +72,9 @@ using namespace Assimp::Formatter;
 using namespace Assimp::FBX;
 
 namespace {
+    // arrays smaller than this stay in memory when streaming binary files
+    static constexpr size_t DeferredArraySize = 4096;
+
     static constexpr aiImporterDesc desc = {
 	    "Autodesk FBX Importer",
 	    "",
@@ -119,6 +122,8 @@ void FBXImporter::SetupProperties(const Importer *pImp) {
     mSettings.convertToMeters = pImp->GetPropertyBool(AI_CONFIG_FBX_CONVERT_TO_M, false);
     mSettings.ignoreUpDirection = pImp->GetPropertyBool(AI_CONFIG_IMPORT_FBX_IGNORE_UP_DIRECTION, false);
     mSettings.useSkeleton = pImp->GetPropertyBool(AI_CONFIG_FBX_USE_SKELETON_BONE_CONTAINER, false);
+    mSettings.streamBinary = pImp->GetPropertyBool(AI_CONFIG_IMPORT_FBX_STREAM_BINARY, false);
+    mSettings.inflateThreads = static_cast<unsigned int>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_FBX_INFLATE_THREADS, 1)));
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -134,16 +139,34 @@ void FBXImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 
     ASSIMP_LOG_DEBUG("Reading FBX file");
 
-	// read entire file into memory - no streaming for this, fbx
-	// files can grow large, but the assimp output data structure
-	// then becomes very large, too. Assimp doesn't support
-	// streaming for its output data structures so the net win with
-	// streaming input data would be very low.
+	// read entire file into memory by default - fbx files can grow
+	// large, but the assimp output data structure then becomes very
+	// large, too. Assimp doesn't support streaming for its output data
+	// structures so the net win with streaming input data is only the
+	// memory held by the raw and compressed input.
+	// Binary files are tokenized in place if the stream provides its memory,
+	// the tokens only reference the input and the stream outlives them.
+	// If streaming is enabled, binary files are never loaded as a whole. The
+	// tokens then keep their data arrays in the file and read them from the
+	// stream once they are converted.
 	std::vector<char> contents;
-	contents.resize(stream->FileSize() + 1);
-	stream->Read(&*contents.begin(), 1, contents.size() - 1);
-	contents[contents.size() - 1] = 0;
-	const char *const begin = &*contents.begin();
+	const char *begin = reinterpret_cast<const char *>(stream->GetMemoryView());
+	size_t length = stream->FileSize();
+	bool stream_binary = false;
+	if (nullptr == begin && mSettings.streamBinary && length >= 18) {
+		char magic[18];
+		stream_binary = stream->Read(magic, 1, sizeof(magic)) == sizeof(magic) &&
+				!strncmp(magic, "Kaydara FBX Binary", 18);
+		stream->Seek(0, aiOrigin_SET);
+	}
+	if (!stream_binary && (nullptr == begin || length < 18 || strncmp(begin, "Kaydara FBX Binary", 18))) {
+		contents.resize(length + 1);
+		stream->Read(&*contents.begin(), 1, contents.size() - 1);
+		contents[contents.size() - 1] = 0;
+		begin = &*contents.begin();
+		length = contents.size();
+	}
+	DeferredDataSource deferred(*stream);
 
 	// broad-phase tokenized pass in which we identify the core
 	// syntax elements of FBX (brackets, commas, key:value mappings)
@@ -151,9 +174,15 @@ void FBXImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
     Assimp::StackAllocator tempAllocator;
     try {
 		bool is_binary = false;
-		if (!strncmp(begin, "Kaydara FBX Binary", 18)) {
+		if (stream_binary) {
+			is_binary = true;
+			TokenizeBinary(tokens, *stream, tempAllocator, deferred, DeferredArraySize);
+		} else if (!strncmp(begin, "Kaydara FBX Binary", 18)) {
 			is_binary = true;
-            TokenizeBinary(tokens, begin, contents.size(), tempAllocator);
+            TokenizeBinary(tokens, begin, length, tempAllocator);
+            if (1 != mSettings.inflateThreads) {
+                InflateBinaryDataArrays(tokens, tempAllocator, mSettings.inflateThreads);
+            }
 		} else {
             Tokenize(tokens, begin, tempAllocator);
 		}
@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ASSIMP_BUILD_NO_FBX_IMPORTER
 
 #include "Common/Compression.h"
+#include "Common/ThreadPool.h"
 
 #include "FBXTokenizer.h"
 #include "FBXParser.h"
@@ -57,6 +58,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/DefaultLogger.hpp>
 
 #include <iostream>
+#include <limits>
 
 using namespace Assimp;
 using namespace Assimp::FBX;
@@ -532,55 +534,72 @@ void ReadBinaryDataArrayHead(const char*& data, const char* end, char& type, uin
 
 
 // ------------------------------------------------------------------------------------------------
-// read binary data array, assume cursor points to the 'compression mode' field (i.e. behind the header)
-void ReadBinaryDataArray(char type, uint32_t count, const char*& data, const char* end,
-        std::vector<char>& buff, const Element& /*el*/) {
-    BE_NCONST uint32_t encmode = SafeParse<uint32_t>(data, end);
-    AI_SWAP4(encmode);
-    data += 4;
-
-    // next comes the compressed length
-    BE_NCONST uint32_t comp_len = SafeParse<uint32_t>(data, end);
-    AI_SWAP4(comp_len);
-    data += 4;
-
-    ai_assert(data + comp_len == end);
-
-    // determine the length of the uncompressed data by looking at the type signature
-    uint32_t stride = 0;
+// get the element size of a binary data array from its type signature
+uint32_t GetBinaryDataArrayStride(char type) {
     switch(type)
     {
         case 'f':
         case 'i':
-            stride = 4;
-            break;
+            return 4;
 
         case 'd':
         case 'l':
-            stride = 8;
-            break;
+            return 8;
 
         default:
             ai_assert(false);
     };
+    return 0;
+}
 
+// ------------------------------------------------------------------------------------------------
+// read binary data array, assume cursor points to the 'compression mode' field (i.e. behind the header).
+// Returns the decoded data and its size. Uncompressed arrays which are suitably aligned are
+// returned in place, all others are copied or inflated to buff.
+const char* ReadBinaryDataArray(char type, uint32_t count, const char*& data, const char* end,
+        std::vector<char>& buff, size_t& size_out, const Element& el) {
+    BE_NCONST uint32_t encmode = SafeParse<uint32_t>(data, end);
+    AI_SWAP4(encmode);
+    data += 4;
+
+    // next comes the compressed length
+    BE_NCONST uint32_t comp_len = SafeParse<uint32_t>(data, end);
+    AI_SWAP4(comp_len);
+    data += 4;
+
+    ai_assert(data + comp_len == end);
+
+    // determine the length of the uncompressed data by looking at the type signature
+    const uint32_t stride = GetBinaryDataArrayStride(type);
+    if (!stride) {
+        ParseError("unexpected data type for binary data array", &el);
+    }
     const uint32_t full_length = stride * count;
-    buff.resize(full_length);
+    size_out = full_length;
 
+    const char* result = nullptr;
     if(encmode == 0) {
         ai_assert(full_length == comp_len);
 
-        // plain data, no compression
-        std::copy(data, end, buff.begin());
+        // plain data, no compression. Arrays inflated by InflateBinaryDataArrays() are
+        // aligned and need no copy, arrays read from the file usually are not.
+        if (reinterpret_cast<uintptr_t>(data) % stride == 0) {
+            result = data;
+        } else {
+            buff.assign(data, end);
+            result = buff.data();
+        }
     }
     else if(encmode == 1) {
         // zlib/deflate, next comes ZIP head (0x78 0x01)
         // see http://www.ietf.org/rfc/rfc1950.txt
-         Compression compress;
+        buff.resize(full_length);
+        Compression compress;
         if (compress.open(Compression::Format::Binary, Compression::FlushMode::Finish, 0)) {
             compress.decompress(data, comp_len, buff);
             compress.close();
         }
+        result = buff.data();
     }
 #ifdef ASSIMP_BUILD_DEBUG
     else {
@@ -591,10 +610,95 @@ void ReadBinaryDataArray(char type, uint32_t count, const char*& data, const cha
 
     data += comp_len;
     ai_assert(data == end);
+    return result;
 }
 
 } // !anon
 
+// ------------------------------------------------------------------------------------------------
+void InflateBinaryDataArrays(TokenList& tokens, StackAllocator& token_allocator, unsigned int numThreads) {
+    // type code, element count, encoding and compressed length
+    static constexpr size_t HeaderLength = 13;
+
+    struct Job {
+        size_t index;
+        const char* source;
+        uint32_t source_length;
+        char* target;
+        uint32_t target_length;
+    };
+
+    // collect the compressed arrays and allocate their uncompressed replacements up front,
+    // the allocator is not thread-safe. The payload is aligned so the arrays can later be
+    // read in place, see ReadBinaryDataArray().
+    std::vector<Job> jobs;
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        const Token& t = *tokens[i];
+        if (t.Type() != TokenType_DATA || !t.IsBinary() || t.IsDeferred() || static_cast<size_t>(t.end() - t.begin()) < HeaderLength) {
+            continue;
+        }
+        const char type = *t.begin();
+        if (type != 'f' && type != 'd' && type != 'i' && type != 'l') {
+            continue;
+        }
+
+        uint32_t count, encoding, comp_len;
+        ::memcpy(&count, t.begin() + 1, sizeof(uint32_t));
+        ::memcpy(&encoding, t.begin() + 5, sizeof(uint32_t));
+        ::memcpy(&comp_len, t.begin() + 9, sizeof(uint32_t));
+        AI_SWAP4(count);
+        AI_SWAP4(encoding);
+        AI_SWAP4(comp_len);
+        if (encoding != 1 || !count || !comp_len) {
+            continue;
+        }
+
+        const uint64_t full_length = static_cast<uint64_t>(GetBinaryDataArrayStride(type)) * count;
+        if (full_length > std::numeric_limits<uint32_t>::max()) {
+            continue;
+        }
+
+        // keep the allocation size a multiple of the alignment, the tokens share the allocator
+        const size_t mem_length = (static_cast<size_t>(full_length) + HeaderLength + 2 * sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1);
+        char* mem = static_cast<char*>(token_allocator.Allocate(mem_length));
+        char* payload = reinterpret_cast<char*>((reinterpret_cast<uintptr_t>(mem) + HeaderLength + sizeof(uint64_t) - 1) & ~(uintptr_t)(sizeof(uint64_t) - 1));
+
+        // rewrite the header to announce uncompressed data
+        char* header = payload - HeaderLength;
+        BE_NCONST uint32_t plain = 0, length = static_cast<uint32_t>(full_length);
+        AI_SWAP4(length);
+        ::memcpy(header, t.begin(), 5);
+        ::memcpy(header + 5, &plain, sizeof(uint32_t));
+        ::memcpy(header + 9, &length, sizeof(uint32_t));
+
+        jobs.push_back({ i, t.begin() + HeaderLength, comp_len, payload, static_cast<uint32_t>(full_length) });
+    }
+
+    if (jobs.empty()) {
+        return;
+    }
+
+    ThreadPool pool(numThreads);
+    ASSIMP_LOG_DEBUG("FBX-Parser: inflating ", jobs.size(), " binary arrays in parallel on ", pool.GetNumThreads(), " threads");
+    pool.ParallelFor(jobs.size(), [&jobs](size_t i) {
+        const Job& job = jobs[i];
+        Compression compress;
+        if (!compress.open(Compression::Format::Binary, Compression::FlushMode::Finish, 0)) {
+            throw DeadlyImportError("FBX-Parser: failed to initialize decompression");
+        }
+        const size_t written = compress.decompress(job.source, job.source_length, job.target, job.target_length);
+        compress.close();
+
+        // short data reads as zeros, like with ParseVectorDataArray()
+        std::fill(job.target + written, job.target + job.target_length, '\0');
+    });
+
+    for (const Job& job : jobs) {
+        const Token* old = tokens[job.index];
+        tokens[job.index] = new_Token(job.target - HeaderLength, job.target + job.target_length, TokenType_DATA, old->Offset());
+        delete_Token(old);
+    }
+}
 
 // ------------------------------------------------------------------------------------------------
 // read an array of float3 tuples
@@ -608,7 +712,9 @@ void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el)
     }
 
     if(tok[0]->IsBinary()) {
-        const char* data = tok[0]->begin(), *end = tok[0]->end();
+        std::vector<char> contents;
+        const char *data, *end;
+        tok[0]->GetBinaryContents(contents, data, end);
 
         char type;
         uint32_t count;
@@ -627,11 +733,12 @@ void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        size_t size;
+        const char* raw = ReadBinaryDataArray(type, count, data, end, buff, size, el);
 
         ai_assert(data == end);
         uint64_t dataToRead = static_cast<uint64_t>(count) * (type == 'd' ? 8 : 4);
-        if (dataToRead != buff.size()) {
+        if (dataToRead != size) {
             ParseError("Invalid read size (binary)",&el);
         }
 
@@ -639,7 +746,7 @@ void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el)
         out.reserve(count3);
 
         if (type == 'd') {
-            const double* d = reinterpret_cast<const double*>(&buff[0]);
+            const double* d = reinterpret_cast<const double*>(raw);
             for (unsigned int i = 0; i < count3; ++i, d += 3) {
                 BE_NCONST double val1 = d[0];
                 BE_NCONST double val2 = d[1];
@@ -660,7 +767,7 @@ void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el)
             }*/
         }
         else if (type == 'f') {
-            const float* f = reinterpret_cast<const float*>(&buff[0]);
+            const float* f = reinterpret_cast<const float*>(raw);
             for (unsigned int i = 0; i < count3; ++i, f += 3) {
                 BE_NCONST float val1 = f[0];
                 BE_NCONST float val2 = f[1];
@@ -709,7 +816,9 @@ void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el)
     }
 
     if(tok[0]->IsBinary()) {
-        const char* data = tok[0]->begin(), *end = tok[0]->end();
+        std::vector<char> contents;
+        const char *data, *end;
+        tok[0]->GetBinaryContents(contents, data, end);
 
         char type;
         uint32_t count;
@@ -728,11 +837,12 @@ void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        size_t size;
+        const char* raw = ReadBinaryDataArray(type, count, data, end, buff, size, el);
 
         ai_assert(data == end);
         uint64_t dataToRead = static_cast<uint64_t>(count) * (type == 'd' ? 8 : 4);
-        if (dataToRead != buff.size()) {
+        if (dataToRead != size) {
             ParseError("Invalid read size (binary)",&el);
         }
 
@@ -740,7 +850,7 @@ void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el)
         out.reserve(count4);
 
         if (type == 'd') {
-            const double* d = reinterpret_cast<const double*>(&buff[0]);
+            const double* d = reinterpret_cast<const double*>(raw);
             for (unsigned int i = 0; i < count4; ++i, d += 4) {
                 BE_NCONST double val1 = d[0];
                 BE_NCONST double val2 = d[1];
@@ -757,7 +867,7 @@ void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el)
             }
         }
         else if (type == 'f') {
-            const float* f = reinterpret_cast<const float*>(&buff[0]);
+            const float* f = reinterpret_cast<const float*>(raw);
             for (unsigned int i = 0; i < count4; ++i, f += 4) {
                 BE_NCONST float val1 = f[0];
                 BE_NCONST float val2 = f[1];
@@ -806,7 +916,9 @@ void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el) {
     }
 
     if(tok[0]->IsBinary()) {
-        const char* data = tok[0]->begin(), *end = tok[0]->end();
+        std::vector<char> contents;
+        const char *data, *end;
+        tok[0]->GetBinaryContents(contents, data, end);
 
         char type;
         uint32_t count;
@@ -825,11 +937,12 @@ void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el) {
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        size_t size;
+        const char* raw = ReadBinaryDataArray(type, count, data, end, buff, size, el);
 
         ai_assert(data == end);
         uint64_t dataToRead = static_cast<uint64_t>(count) * (type == 'd' ? 8 : 4);
-        if (dataToRead != buff.size()) {
+        if (dataToRead != size) {
             ParseError("Invalid read size (binary)",&el);
         }
 
@@ -837,7 +950,7 @@ void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el) {
         out.reserve(count2);
 
         if (type == 'd') {
-            const double* d = reinterpret_cast<const double*>(&buff[0]);
+            const double* d = reinterpret_cast<const double*>(raw);
             for (unsigned int i = 0; i < count2; ++i, d += 2) {
                 BE_NCONST double val1 = d[0];
                 BE_NCONST double val2 = d[1];
@@ -847,7 +960,7 @@ void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el) {
                     static_cast<float>(val2));
             }
         } else if (type == 'f') {
-            const float* f = reinterpret_cast<const float*>(&buff[0]);
+            const float* f = reinterpret_cast<const float*>(raw);
             for (unsigned int i = 0; i < count2; ++i, f += 2) {
                 BE_NCONST float val1 = f[0];
                 BE_NCONST float val2 = f[1];
@@ -891,7 +1004,9 @@ void ParseVectorDataArray(std::vector<int>& out, const Element& el) {
     }
 
     if(tok[0]->IsBinary()) {
-        const char* data = tok[0]->begin(), *end = tok[0]->end();
+        std::vector<char> contents;
+        const char *data, *end;
+        tok[0]->GetBinaryContents(contents, data, end);
 
         char type;
         uint32_t count;
@@ -906,17 +1021,18 @@ void ParseVectorDataArray(std::vector<int>& out, const Element& el) {
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        size_t size;
+        const char* raw = ReadBinaryDataArray(type, count, data, end, buff, size, el);
 
         ai_assert(data == end);
         uint64_t dataToRead = static_cast<uint64_t>(count) * 4;
-        if (dataToRead != buff.size()) {
+        if (dataToRead != size) {
             ParseError("Invalid read size (binary)",&el);
         }
 
         out.reserve(count);
 
-        const int32_t* ip = reinterpret_cast<const int32_t*>(&buff[0]);
+        const int32_t* ip = reinterpret_cast<const int32_t*>(raw);
         for (unsigned int i = 0; i < count; ++i, ++ip) {
             BE_NCONST int32_t val = *ip;
             AI_SWAP4(val);
@@ -952,7 +1068,9 @@ void ParseVectorDataArray(std::vector<float>& out, const Element& el)
     }
 
     if(tok[0]->IsBinary()) {
-        const char* data = tok[0]->begin(), *end = tok[0]->end();
+        std::vector<char> contents;
+        const char *data, *end;
+        tok[0]->GetBinaryContents(contents, data, end);
 
         char type;
         uint32_t count;
@@ -967,16 +1085,17 @@ void ParseVectorDataArray(std::vector<float>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        size_t size;
+        const char* raw = ReadBinaryDataArray(type, count, data, end, buff, size, el);
 
         ai_assert(data == end);
         uint64_t dataToRead = static_cast<uint64_t>(count) * (type == 'd' ? 8 : 4);
-        if (dataToRead != buff.size()) {
+        if (dataToRead != size) {
             ParseError("Invalid read size (binary)",&el);
         }
 
         if (type == 'd') {
-            const double* d = reinterpret_cast<const double*>(&buff[0]);
+            const double* d = reinterpret_cast<const double*>(raw);
             for (unsigned int i = 0; i < count; ++i, ++d) {
                 BE_NCONST double val = *d;
                 AI_SWAP8(val);
@@ -984,7 +1103,7 @@ void ParseVectorDataArray(std::vector<float>& out, const Element& el)
             }
         }
         else if (type == 'f') {
-            const float* f = reinterpret_cast<const float*>(&buff[0]);
+            const float* f = reinterpret_cast<const float*>(raw);
             for (unsigned int i = 0; i < count; ++i, ++f) {
                 BE_NCONST float val = *f;
                 AI_SWAP4(val);
@@ -1019,7 +1138,9 @@ void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el) {
     }
 
     if(tok[0]->IsBinary()) {
-        const char* data = tok[0]->begin(), *end = tok[0]->end();
+        std::vector<char> contents;
+        const char *data, *end;
+        tok[0]->GetBinaryContents(contents, data, end);
 
         char type;
         uint32_t count;
@@ -1034,17 +1155,18 @@ void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el) {
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        size_t size;
+        const char* raw = ReadBinaryDataArray(type, count, data, end, buff, size, el);
 
         ai_assert(data == end);
         uint64_t dataToRead = static_cast<uint64_t>(count) * 4;
-        if (dataToRead != buff.size()) {
+        if (dataToRead != size) {
             ParseError("Invalid read size (binary)",&el);
         }
 
         out.reserve(count);
 
-        const int32_t* ip = reinterpret_cast<const int32_t*>(&buff[0]);
+        const int32_t* ip = reinterpret_cast<const int32_t*>(raw);
         for (unsigned int i = 0; i < count; ++i, ++ip) {
             BE_NCONST int32_t val = *ip;
             if(val < 0) {
@@ -1087,7 +1209,9 @@ void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& el)
     }
 
     if(tok[0]->IsBinary()) {
-        const char* data = tok[0]->begin(), *end = tok[0]->end();
+        std::vector<char> contents;
+        const char *data, *end;
+        tok[0]->GetBinaryContents(contents, data, end);
 
         char type;
         uint32_t count;
@@ -1102,17 +1226,18 @@ void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        size_t size;
+        const char* raw = ReadBinaryDataArray(type, count, data, end, buff, size, el);
 
         ai_assert(data == end);
         uint64_t dataToRead = static_cast<uint64_t>(count) * 8;
-        if (dataToRead != buff.size()) {
+        if (dataToRead != size) {
             ParseError("Invalid read size (binary)",&el);
         }
 
         out.reserve(count);
 
-        const uint64_t* ip = reinterpret_cast<const uint64_t*>(&buff[0]);
+        const uint64_t* ip = reinterpret_cast<const uint64_t*>(raw);
         for (unsigned int i = 0; i < count; ++i, ++ip) {
             BE_NCONST uint64_t val = *ip;
             AI_SWAP8(val);
@@ -1148,7 +1273,9 @@ void ParseVectorDataArray(std::vector<int64_t>& out, const Element& el)
     }
 
     if (tok[0]->IsBinary()) {
-        const char* data = tok[0]->begin(), *end = tok[0]->end();
+        std::vector<char> contents;
+        const char *data, *end;
+        tok[0]->GetBinaryContents(contents, data, end);
 
         char type;
         uint32_t count;
@@ -1163,17 +1290,18 @@ void ParseVectorDataArray(std::vector<int64_t>& out, const Element& el)
         }
 
         std::vector<char> buff;
-        ReadBinaryDataArray(type, count, data, end, buff, el);
+        size_t size;
+        const char* raw = ReadBinaryDataArray(type, count, data, end, buff, size, el);
 
         ai_assert(data == end);
         uint64_t dataToRead = static_cast<uint64_t>(count) * 8;
-        if (dataToRead != buff.size()) {
+        if (dataToRead != size) {
             ParseError("Invalid read size (binary)",&el);
         }
 
         out.reserve(count);
 
-        const int64_t* ip = reinterpret_cast<const int64_t*>(&buff[0]);
+        const int64_t* ip = reinterpret_cast<const int64_t*>(raw);
         for (unsigned int i = 0; i < count; ++i, ++ip) {
             BE_NCONST int64_t val = *ip;
             AI_SWAP8(val);
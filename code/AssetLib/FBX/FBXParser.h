@@ -220,6 +220,11 @@ void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el);
 void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& e);
 void ParseVectorDataArray(std::vector<int64_t>& out, const Element& el);
 
+/* inflate all zlib-compressed data arrays of a binary token list using the given number of
+   threads (0 for all hardware threads). The affected tokens are replaced by tokens holding the
+   uncompressed data, which is allocated from token_allocator. */
+void InflateBinaryDataArrays(TokenList& tokens, StackAllocator& token_allocator, unsigned int numThreads);
+
 bool HasElement( const Scope& sc, const std::string& index );
 
 // extract a required element from a scope, abort if the element cannot be found
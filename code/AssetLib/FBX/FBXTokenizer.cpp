@@ -69,6 +69,7 @@ Token::Token(const char* sbegin, const char* send, TokenType type, unsigned int
     , type(type)
     , line(line)
     , column(column)
+    , deferred(nullptr)
 {
     ai_assert(sbegin);
     ai_assert(send);
@@ -51,8 +51,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/defs.h>
 #include <vector>
 #include <string>
+#include <mutex>
 
 namespace Assimp {
+
+class IOStream;
+
 namespace FBX {
 
 /** Rough classification for text FBX tokens used for constructing the
@@ -80,6 +84,27 @@ enum TokenType
 };
 
 
+/** Gives access to the parts of a binary FBX file which have not been loaded
+ *  into memory by the streaming tokenizer. Reads are serialized, the source
+ *  does not own the stream and must not outlive it. */
+class DeferredDataSource
+{
+public:
+    explicit DeferredDataSource(IOStream &stream) :
+            mStream(stream) {
+        // empty
+    }
+
+    /** Read length bytes starting at the given file offset into out.
+     *  @throw DeadlyImportError if the stream is too short. */
+    void Read(size_t fileOffset, size_t length, char *out) const;
+
+private:
+    IOStream &mStream;
+    mutable std::mutex mMutex;
+};
+
+
 /** Represents a single token in a FBX file. Tokens are
  *  classified by the #TokenType enumerated types.
  *
@@ -96,6 +121,11 @@ public:
     /** construct a binary token */
     Token(const char* sbegin, const char* send, TokenType type, size_t offset);
 
+    /** construct a binary array token whose payload is still in the file.
+     *  [sbegin,send) holds the array header, offset is the file offset
+     *  behind the payload - like for any other binary token. */
+    Token(const char* sbegin, const char* send, size_t offset, const DeferredDataSource &source);
+
     ~Token() = default;
 
 public:
@@ -107,6 +137,16 @@ public:
         return column == BINARY_MARKER;
     }
 
+    /** Binary array tokens produced by the streaming tokenizer only keep
+     *  their header in memory, see GetBinaryContents(). */
+    bool IsDeferred() const {
+        return nullptr != deferred;
+    }
+
+    /** Get the full contents of a binary token. Deferred tokens are loaded
+     *  into storage, all others just return [begin(),end()). */
+    void GetBinaryContents(std::vector<char> &storage, const char *&out_begin, const char *&out_end) const;
+
     const char* begin() const {
         return sbegin;
     }
@@ -152,6 +192,7 @@ private:
         size_t offset;
     };
     const unsigned int column;
+    const DeferredDataSource *const deferred;
 };
 
 typedef const Token* TokenPtr;
@@ -182,6 +223,24 @@ void Tokenize(TokenList &output_tokens, const char *input, StackAllocator &token
 void TokenizeBinary(TokenList &output_tokens, const char *input, size_t length, StackAllocator &tokenAllocator);
 
 
+/** Streaming tokenizer function for binary FBX files.
+ *
+ *  Reads the node records incrementally from the stream instead of requiring
+ *  the whole file in memory. Token contents are copied to tokenAllocator,
+ *  except for the payload of data arrays of at least deferThreshold bytes
+ *  which stays in the file until it is requested through
+ *  Token::GetBinaryContents().
+ *
+ * @param output_tokens Receives a list of all tokens in the input data.
+ * @param stream Binary input stream, positioned at the start of the file.
+ * @param source Used by the deferred tokens to load their data, must be
+ *   bound to stream and outlive the tokens.
+ * @param deferThreshold Minimum compressed size of arrays to be deferred.
+ * @throw DeadlyImportError if something goes wrong */
+void TokenizeBinary(TokenList &output_tokens, IOStream &stream, StackAllocator &tokenAllocator,
+        const DeferredDataSource &source, size_t deferThreshold);
+
+
 } // ! FBX
 } // ! Assimp
 
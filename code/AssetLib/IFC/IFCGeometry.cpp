@@ -47,6 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PostProcessing/ProcessHelper.h"
 #include "contrib/poly2tri/poly2tri/poly2tri.h"
 #include "contrib/clipper/clipper.hpp"
+#include <assimp/SceneCombiner.h>
 
 #include <iterator>
 #include <memory>
@@ -862,6 +863,98 @@ void PopulateMeshCache(const Schema_2x3::IfcRepresentationItem& item,
     conv.cached_meshes[idx] = mesh_indices;
 }
 
+// ------------------------------------------------------------------------------------------------
+bool CanPopulateSharedMeshCache(const ConversionData& conv) {
+    // Meshes with openings applied or collected are specific to their product. Like
+    // cached_meshes, the main conversion shares them anyway: it runs in the same order
+    // as a serial conversion. A worker doesn't know whether an earlier product would
+    // have produced the mesh first.
+    return conv.pool || (!conv.collect_openings && (!conv.apply_openings || conv.apply_openings->empty()));
+}
+
+// ------------------------------------------------------------------------------------------------
+bool TryQuerySharedMeshCache(const Schema_2x3::IfcRepresentationItem& item,
+        std::set<unsigned int>& mesh_indices,
+        unsigned int mat_index,
+        ConversionData& conv) {
+    const SharedMeshCache::Key key(&item, GetMaterialSource(mat_index, conv));
+    SharedMeshCache::Entry* entry = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(conv.shared_meshes->mutex);
+        std::map<SharedMeshCache::Key, SharedMeshCache::Entry>::iterator it = conv.shared_meshes->entries.find(key);
+        if (it != conv.shared_meshes->entries.end()) {
+            entry = &(*it).second;
+        }
+    }
+    if (!entry) {
+        return false;
+    }
+
+    if (conv.pool) {
+        // the main conversion, its meshes are the scene meshes. It only runs while the
+        // workers are idle, so their meshes have been merged into the scene already.
+        for (unsigned int scene_index : entry->scene_indices) {
+            if (scene_index == std::numeric_limits<unsigned int>::max()) {
+                return false;
+            }
+        }
+        mesh_indices.insert(entry->scene_indices.begin(), entry->scene_indices.end());
+        return true;
+    }
+
+    // entries are never changed once they have been added, except for the
+    // scene indices which are assigned by the main conversion
+    for (unsigned int i = 0; i < entry->meshes.size(); ++i) {
+        aiMesh* mesh = nullptr;
+        SceneCombiner::Copy(&mesh, entry->meshes[i].get());
+        mesh->mMaterialIndex = mat_index;
+
+        const unsigned int index = static_cast<unsigned int>(conv.meshes.size());
+        conv.shared_mesh_refs[index] = std::make_pair(entry, i);
+        mesh_indices.insert(index);
+        conv.meshes.push_back(mesh);
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void PopulateSharedMeshCache(const Schema_2x3::IfcRepresentationItem& item,
+        size_t first_mesh,
+        unsigned int mat_index,
+        ConversionData& conv) {
+    const size_t count = conv.meshes.size() - first_mesh;
+    if (!count) {
+        return;
+    }
+
+    // the meshes of the main conversion are in the scene already, those of
+    // workers get their scene indices when they are merged
+    SharedMeshCache::Entry copy;
+    copy.meshes.resize(count);
+    copy.scene_indices.resize(count, std::numeric_limits<unsigned int>::max());
+    for (size_t i = 0; i < count; ++i) {
+        aiMesh* mesh = nullptr;
+        SceneCombiner::Copy(&mesh, conv.meshes[first_mesh + i]);
+        copy.meshes[i].reset(mesh);
+        if (conv.pool) {
+            copy.scene_indices[i] = static_cast<unsigned int>(first_mesh + i);
+        }
+    }
+
+    SharedMeshCache::Entry* entry = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(conv.shared_meshes->mutex);
+        // if another thread was faster, keep its meshes. They are the same.
+        entry = &conv.shared_meshes->entries.insert(std::make_pair(
+                SharedMeshCache::Key(&item, GetMaterialSource(mat_index, conv)), std::move(copy))).first->second;
+    }
+    if (!conv.pool && entry->meshes.size() == count) {
+        for (size_t i = 0; i < count; ++i) {
+            conv.shared_mesh_refs[static_cast<unsigned int>(first_mesh + i)] = std::make_pair(entry, static_cast<unsigned int>(i));
+        }
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 bool ProcessRepresentationItem(const Schema_2x3::IfcRepresentationItem& item,
         unsigned int matid,
@@ -871,10 +964,20 @@ bool ProcessRepresentationItem(const Schema_2x3::IfcRepresentationItem& item,
     unsigned int localmatid = ProcessMaterials(item.GetID(), matid, conv, true);
 
     if (!TryQueryMeshCache(item,mesh_indices,localmatid,conv)) {
+        // with a thread pool, every conversion goes through the shared cache as well
+        if (conv.shared_meshes && TryQuerySharedMeshCache(item,mesh_indices,localmatid,conv)) {
+            PopulateMeshCache(item,mesh_indices,localmatid,conv);
+            return true;
+        }
+
+        const size_t first_mesh = conv.meshes.size();
         if(ProcessGeometricItem(item,localmatid,mesh_indices,conv)) {
             if(mesh_indices.size()) {
                 PopulateMeshCache(item,mesh_indices,localmatid,conv);
             }
+            if (conv.shared_meshes && CanPopulateSharedMeshCache(conv)) {
+                PopulateSharedMeshCache(item,first_mesh,localmatid,conv);
+            }
         } else {
             return false;
         }
@@ -58,6 +58,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #endif
 
 #include "../STEPParser/STEPFileReader.h"
+#include "Common/ThreadPool.h"
 #include "IFCLoader.h"
 
 #include "IFCUtil.h"
@@ -140,6 +141,8 @@ void IFCImporter::SetupProperties(const Importer *pImp) {
     settings.conicSamplingAngle = std::min(std::max((float)pImp->GetPropertyFloat(AI_CONFIG_IMPORT_IFC_SMOOTHING_ANGLE, AI_IMPORT_IFC_DEFAULT_SMOOTHING_ANGLE), 5.0f), 120.0f);
     settings.cylindricalTessellation = std::min(std::max(pImp->GetPropertyInteger(AI_CONFIG_IMPORT_IFC_CYLINDRICAL_TESSELLATION, AI_IMPORT_IFC_DEFAULT_CYLINDRICAL_TESSELLATION), 3), 180);
     settings.skipAnnotations = true;
+    settings.parseThreads = static_cast<unsigned int>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_IFC_PARSE_THREADS, 1)));
+    settings.geometryThreads = static_cast<unsigned int>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_IFC_GEOMETRY_THREADS, 1)));
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -254,13 +257,21 @@ void IFCImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
     };
 
     // feed the IFC schema into the reader and pre-parse all lines
-    STEP::ReadFile(*db, schema, types_to_track, inverse_indices_to_track);
+    STEP::ReadFile(*db, schema, types_to_track, inverse_indices_to_track, settings.parseThreads);
     const STEP::LazyObject *proj = db->GetObject("ifcproject");
     if (!proj) {
         ThrowException("missing IfcProject entity");
     }
 
     ConversionData conv(*db, proj->To<Schema_2x3::IfcProject>(), pScene, settings);
+    std::unique_ptr<ThreadPool> pool;
+    SharedMeshCache shared_meshes;
+    if (settings.geometryThreads != 1) {
+        pool.reset(new ThreadPool(settings.geometryThreads));
+        conv.pool = pool.get();
+        conv.shared_meshes = &shared_meshes;
+        db->SetConcurrentEvaluation(true);
+    }
     SetUnits(conv);
     SetCoordinateSpace(conv);
     ProcessSpatialStructures(conv);
@@ -624,6 +635,10 @@ void ProcessMetadata(uint64_t relDefinesByPropertiesID, ConversionData &conv, Me
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+void ProcessContainedProducts(aiNode *nd, const std::vector<std::pair<const Schema_2x3::IfcProduct *, size_t>> &products,
+        std::vector<aiNode *> &subnodes, ConversionData &conv);
+
 // ------------------------------------------------------------------------------------------------
 aiNode *ProcessSpatialStructure(aiNode *parent, const Schema_2x3::IfcProduct &el, ConversionData &conv,
         std::vector<TempOpening> *collect_openings = nullptr) {
@@ -689,6 +704,7 @@ aiNode *ProcessSpatialStructure(aiNode *parent, const Schema_2x3::IfcProduct &el
     // convert everything contained directly within this structure,
     // this may result in more nodes.
     std::vector<aiNode *> subnodes;
+    std::vector<std::pair<const Schema_2x3::IfcProduct *, size_t>> contained;
     try {
         // locate aggregates and 'contained-in-here'-elements of this spatial structure and add them in recursively
         // on our way, collect openings in *this* element
@@ -716,6 +732,13 @@ aiNode *ProcessSpatialStructure(aiNode *parent, const Schema_2x3::IfcProduct &el
                         continue;
                     }
 
+                    if (conv.pool) {
+                        // converted all at once below, keep the position of the node
+                        contained.emplace_back(&pro, subnodes.size());
+                        subnodes.push_back(nullptr);
+                        continue;
+                    }
+
                     aiNode *const ndnew = ProcessSpatialStructure(nd, pro, conv, nullptr);
                     if (ndnew) {
                         subnodes.push_back(ndnew);
@@ -761,6 +784,11 @@ aiNode *ProcessSpatialStructure(aiNode *parent, const Schema_2x3::IfcProduct &el
             }
         }
 
+        if (!contained.empty()) {
+            ProcessContainedProducts(nd, contained, subnodes, conv);
+            subnodes.erase(std::remove(subnodes.begin(), subnodes.end(), nullptr), subnodes.end());
+        }
+
         for (; range.first != range.second; ++range.first) {
             // see note in loop above
             if (conv.already_processed.find((*range.first).second) != conv.already_processed.end()) {
@@ -821,6 +849,110 @@ aiNode *ProcessSpatialStructure(aiNode *parent, const Schema_2x3::IfcProduct &el
     return nd;
 }
 
+// ------------------------------------------------------------------------------------------------
+void RemapMeshIndices(aiNode *nd, const std::vector<unsigned int> &mesh_map) {
+    for (unsigned int i = 0; i < nd->mNumMeshes; ++i) {
+        nd->mMeshes[i] = mesh_map[nd->mMeshes[i]];
+    }
+    for (unsigned int i = 0; i < nd->mNumChildren; ++i) {
+        RemapMeshIndices(nd->mChildren[i], mesh_map);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Moves the meshes and materials of a worker into conv, dropping those conv already has
+void MergeConversionData(ConversionData &worker, aiNode *nd, ConversionData &conv) {
+    std::vector<unsigned int> material_map(worker.materials.size());
+    for (size_t i = 0; i < worker.materials.size(); ++i) {
+        std::unique_ptr<aiMaterial> mat(worker.materials[i]);
+        worker.materials[i] = nullptr;
+
+        // same rules as ProcessMaterials(): one material per surface style, and
+        // materials without style are identified by their name
+        unsigned int index = std::numeric_limits<unsigned int>::max();
+        if (const Schema_2x3::IfcSurfaceStyle *const surf = GetMaterialSource(static_cast<unsigned int>(i), worker)) {
+            ConversionData::MaterialCache::const_iterator it = conv.cached_materials.find(surf);
+            if (it != conv.cached_materials.end()) {
+                index = (*it).second;
+            } else {
+                conv.cached_materials[surf] = static_cast<unsigned int>(conv.materials.size());
+            }
+        } else {
+            aiString name;
+            mat->Get(AI_MATKEY_NAME, name);
+            for (size_t a = 0; a < conv.materials.size(); ++a) {
+                aiString mname;
+                conv.materials[a]->Get(AI_MATKEY_NAME, mname);
+                if (name == mname) {
+                    index = static_cast<unsigned int>(a);
+                    break;
+                }
+            }
+        }
+        if (index == std::numeric_limits<unsigned int>::max()) {
+            index = static_cast<unsigned int>(conv.materials.size());
+            conv.materials.push_back(mat.release());
+        }
+        material_map[i] = index;
+    }
+
+    std::vector<unsigned int> mesh_map(worker.meshes.size());
+    for (size_t i = 0; i < worker.meshes.size(); ++i) {
+        const std::map<unsigned int, std::pair<SharedMeshCache::Entry *, unsigned int>>::const_iterator ref =
+                worker.shared_mesh_refs.find(static_cast<unsigned int>(i));
+        if (ref != worker.shared_mesh_refs.end()) {
+            unsigned int &scene_index = (*ref).second.first->scene_indices[(*ref).second.second];
+            if (scene_index != std::numeric_limits<unsigned int>::max()) {
+                // an earlier product has the same mesh, the worker deletes this copy
+                mesh_map[i] = scene_index;
+                continue;
+            }
+            scene_index = static_cast<unsigned int>(conv.meshes.size());
+        }
+
+        aiMesh *const mesh = worker.meshes[i];
+        worker.meshes[i] = nullptr;
+        if (mesh->mMaterialIndex < material_map.size()) {
+            mesh->mMaterialIndex = material_map[mesh->mMaterialIndex];
+        }
+        mesh_map[i] = static_cast<unsigned int>(conv.meshes.size());
+        conv.meshes.push_back(mesh);
+    }
+
+    if (nd) {
+        RemapMeshIndices(nd, mesh_map);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Converts the products contained in a spatial structure on conv.pool, each one with a
+// ConversionData of its own. The results are merged in their original order, so they don't
+// depend on the number of threads.
+void ProcessContainedProducts(aiNode *nd, const std::vector<std::pair<const Schema_2x3::IfcProduct *, size_t>> &products,
+        std::vector<aiNode *> &subnodes, ConversionData &conv) {
+    std::vector<std::unique_ptr<ConversionData>> workers(products.size());
+    std::vector<std::unique_ptr<aiNode>> nodes(products.size());
+
+    IFCImporter::LogDebug("converting ", products.size(), " contained products in parallel on ", conv.pool->GetNumThreads(), " threads");
+    conv.pool->ParallelFor(products.size(), [&](size_t i) {
+        ConversionData *const worker = new ConversionData(conv.db, conv.proj, conv.out, conv.settings);
+        workers[i].reset(worker);
+        worker->len_scale = conv.len_scale;
+        worker->angle_scale = conv.angle_scale;
+        worker->plane_angle_in_radians = conv.plane_angle_in_radians;
+        worker->wcs = conv.wcs;
+        worker->already_processed = conv.already_processed;
+        worker->shared_meshes = conv.shared_meshes;
+
+        nodes[i].reset(ProcessSpatialStructure(nd, *products[i].first, *worker, nullptr));
+    });
+
+    for (size_t i = 0; i < products.size(); ++i) {
+        MergeConversionData(*workers[i], nodes[i].get(), conv);
+        subnodes[products[i].second] = nodes[i].release();
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 void ProcessSpatialStructures(ConversionData &conv) {
     // XXX add support for multiple sites (i.e. IfcSpatialStructureElements with composition == COMPLEX)
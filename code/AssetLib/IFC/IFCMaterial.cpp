@@ -193,6 +193,17 @@ unsigned int ProcessMaterials(uint64_t id, unsigned int prevMatId, ConversionDat
     return (unsigned int) conv.materials.size() - 1;
 }
 
+// ------------------------------------------------------------------------------------------------
+const IFC::Schema_2x3::IfcSurfaceStyle* GetMaterialSource(unsigned int matid, const ConversionData& conv) {
+    // there are only few materials, no need for a reverse map
+    for (const ConversionData::MaterialCache::value_type& kv : conv.cached_materials) {
+        if (kv.second == matid) {
+            return kv.first;
+        }
+    }
+    return nullptr;
+}
+
 } // ! IFC
 } // ! Assimp
 
@@ -53,11 +53,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/mesh.h>
 #include <assimp/material.h>
 
+#include <mutex>
 #include <utility>
 
 struct aiNode;
 
 namespace Assimp {
+
+class ThreadPool;
+
 namespace IFC {
 
     typedef double IfcFloat;
@@ -164,6 +168,29 @@ struct TempOpening
 };
 
 
+// ------------------------------------------------------------------------------------------------
+// Meshes of representation items, shared by the main conversion and the threads which
+// convert products in parallel.
+// Keyed by the item and the surface style of its material (nullptr for the default material).
+// ------------------------------------------------------------------------------------------------
+struct SharedMeshCache
+{
+    struct Entry {
+        // private copies of the meshes generated for the item
+        std::vector<std::unique_ptr<aiMesh>> meshes;
+
+        // indices of the meshes in the output scene, assigned on creation by the
+        // main conversion or when the results of the threads are merged
+        std::vector<unsigned int> scene_indices;
+    };
+
+    typedef std::pair<const IFC::Schema_2x3::IfcRepresentationItem*, const IFC::Schema_2x3::IfcSurfaceStyle*> Key;
+
+    std::mutex mutex;
+    std::map<Key, Entry> entries;
+};
+
+
 // ------------------------------------------------------------------------------------------------
 // Intermediate data storage during conversion. Keeps everything and a bit more.
 // ------------------------------------------------------------------------------------------------
@@ -178,6 +205,8 @@ struct ConversionData
         , settings(settings)
         , apply_openings()
         , collect_openings()
+        , pool()
+        , shared_meshes()
     {}
 
     ~ConversionData() {
@@ -221,6 +250,17 @@ struct ConversionData
     std::vector<TempOpening>* collect_openings;
 
     std::set<uint64_t> already_processed;
+
+    // If set, the products contained in spatial structures are converted on
+    // this pool, each one into a ConversionData of its own which is merged
+    // into this one afterwards. This one and the workers look up and store the
+    // meshes of representation items in shared_meshes.
+    ThreadPool* pool;
+    SharedMeshCache* shared_meshes;
+
+    // meshes of a worker which are copies of shared_meshes entries, mesh index
+    // to entry and index in the entry
+    std::map<unsigned int, std::pair<SharedMeshCache::Entry*, unsigned int> > shared_mesh_refs;
 };
 
 
@@ -276,6 +316,7 @@ bool ProcessCurve(const Schema_2x3::IfcCurve& curve,  TempMesh& meshout, Convers
 
 // IFCMaterial.cpp
 unsigned int ProcessMaterials(uint64_t id, unsigned int prevMatId, ConversionData& conv, bool forceDefaultMat);
+const Schema_2x3::IfcSurfaceStyle* GetMaterialSource(unsigned int matid, const ConversionData& conv);
 
 // IFCGeometry.cpp
 IfcMatrix3 DerivePlaneCoordinateSpace(const TempMesh& curmesh, bool& ok, IfcVector3& norOut);
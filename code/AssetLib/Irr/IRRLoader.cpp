@@ -82,7 +82,7 @@ static constexpr aiImporterDesc desc = {
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 IRRImporter::IRRImporter() :
-        fps(), configSpeedFlag() {
+        fps(), configSpeedFlag(), numBatchThreads(1) {
     // empty
 }
 
@@ -113,6 +113,9 @@ void IRRImporter::SetupProperties(const Importer *pImp) {
 
     // AI_CONFIG_FAVOUR_SPEED
     configSpeedFlag = (0 != pImp->GetPropertyInteger(AI_CONFIG_FAVOUR_SPEED, 0));
+
+    // AI_CONFIG_IMPORT_BATCH_LOADER_THREADS
+    numBatchThreads = static_cast<unsigned int>(pImp->GetPropertyInteger(AI_CONFIG_IMPORT_BATCH_LOADER_THREADS, 1));
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -1222,6 +1225,7 @@ void IRRImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 
     // Batch loader used to load external models
     BatchLoader batch(pIOHandler);
+    batch.setNumThreads(numBatchThreads);
     // batch.SetBasePath(pFile);
 
     cameras.reserve(1); // Probably only one camera in entire scene
@@ -280,6 +280,9 @@ private:
     /// Configuration option: speed flag was set?
     bool configSpeedFlag;
 
+    /// Configuration option: threads used to load external meshes
+    unsigned int numBatchThreads;
+
     std::vector<aiCamera*> cameras;
     std::vector<aiLight*> lights;
     unsigned int guessedMeshCnt;
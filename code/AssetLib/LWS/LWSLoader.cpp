@@ -142,7 +142,8 @@ LWSImporter::LWSImporter() :
         first(),
         last(),
         fps(),
-        noSkeletonMesh() {
+        noSkeletonMesh(),
+        numBatchThreads(1) {
     // nothing to do here
 }
 
@@ -183,6 +184,9 @@ void LWSImporter::SetupProperties(const Importer *pImp) {
     }
 
     noSkeletonMesh = pImp->GetPropertyInteger(AI_CONFIG_IMPORT_NO_SKELETON_MESHES, 0) != 0;
+
+    // AI_CONFIG_IMPORT_BATCH_LOADER_THREADS
+    numBatchThreads = static_cast<unsigned int>(pImp->GetPropertyInteger(AI_CONFIG_IMPORT_BATCH_LOADER_THREADS, 1));
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -513,6 +517,7 @@ void LWSImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 
     // Construct a Batch-importer to read more files recursively
     BatchLoader batch(pIOHandler);
+    batch.setNumThreads(numBatchThreads);
 
     // Construct an array to receive the flat output graph
     std::list<LWS::NodeDesc> nodes;
@@ -230,6 +230,7 @@ private:
     IOSystem *io;
     double first, last, fps;
     bool noSkeletonMesh;
+    unsigned int numBatchThreads;
 };
 
 } // end of namespace Assimp
@@ -148,7 +148,7 @@ void NFFImporter::LoadNFF2MaterialTable(std::vector<ShadingInfo> &output,
 
     // No read the file line per line
     char line[4096];
-    const char *sz, *lineEnd = &line[2095]+1;
+    const char *sz, *lineEnd = &line[4096];
     while (GetNextLine(buffer, line)) {
         SkipSpaces(line, &sz, lineEnd);
 
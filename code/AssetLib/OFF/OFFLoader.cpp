@@ -91,6 +91,16 @@ static void NextToken(const char **car, const char *end) {
     }
 }
 
+// Reads count reals of a vertex line, plain numbers in one go
+static const char *ReadReals(const char *sz, const char *lineEnd, ai_real *values, size_t count) {
+    size_t numRead = fast_atoreal_array(sz, lineEnd, values, count);
+    for (; numRead < count; ++numRead) {
+        SkipSpaces(&sz, lineEnd);
+        sz = fast_atoreal_move(sz, values[numRead]);
+    }
+    return sz;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Imports the given file into the given scene structure.
 void OFFImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSystem *pIOHandler) {
@@ -209,17 +219,17 @@ void OFFImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
         // helper array to write a for loop over possible dimension values
         ai_real *vec[3] = { &v.x, &v.y, &v.z };
 
-        // stop at dimensions: this allows loading 1D or 2D coordinate vertices
+        // stop at dimensions: this allows loading 1D or 2D coordinate vertices,
+        // the homogeneous coordinate follows them
+        ai_real coords[4] = { 0., 0., 0., 1. };
+        sz = ReadReals(sz, lineEnd, coords, hasHomogenous ? dimensions + 1 : dimensions);
         for (unsigned int dim = 0; dim < dimensions; ++dim) {
-            SkipSpaces(&sz, lineEnd);
-            sz = fast_atoreal_move(sz, *vec[dim]);
+            *(vec[dim]) = coords[dim];
         }
 
         // if has homogeneous coordinate, divide others by this one
         if (hasHomogenous) {
-            SkipSpaces(&sz, lineEnd);
-            ai_real w = 1.;
-            sz = fast_atoreal_move(sz, w);
+            const ai_real w = coords[dimensions];
             for (unsigned int dim = 0; dim < dimensions; ++dim) {
                 *(vec[dim]) /= w;
             }
@@ -227,13 +237,9 @@ void OFFImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 
         // read optional normals
         if (hasNormals) {
-            aiVector3D &n = mesh->mNormals[i];
-            SkipSpaces(&sz, lineEnd);
-            sz = fast_atoreal_move(sz, n.x);
-            SkipSpaces(&sz, lineEnd);
-            sz = fast_atoreal_move(sz, n.y);
-            SkipSpaces(&sz, lineEnd);
-            fast_atoreal_move(sz, n.z);
+            ai_real n[3];
+            sz = ReadReals(sz, lineEnd, n, 3);
+            mesh->mNormals[i].Set(n[0], n[1], n[2]);
         }
 
         // reading colors is a pain because the specification says it can be
@@ -264,11 +270,9 @@ void OFFImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
             }
         }
         if (hasTexCoord) {
-            aiVector3D &t = mesh->mTextureCoords[0][i];
-            SkipSpaces(&sz, lineEnd);
-            sz = fast_atoreal_move(sz, t.x);
-            SkipSpaces(&sz, lineEnd);
-            fast_atoreal_move(sz, t.y);
+            ai_real t[2];
+            ReadReals(sz, lineEnd, t, 2);
+            mesh->mTextureCoords[0][i].Set(t[0], t[1], 0.);
         }
     }
 
@@ -62,24 +62,20 @@ void ExportSceneObj(const char* pFile,IOSystem* pIOSystem, const aiScene* pScene
     // invoke the exporter
     ObjExporter exporter(pFile, pScene, false, props);
 
-    if (exporter.mOutput.fail() || exporter.mOutputMat.fail()) {
-        throw DeadlyExportError("output data creation failed. Most likely the file became too large: " + std::string(pFile));
-    }
-
-    // we're still here - export successfully completed. Write both the main OBJ file and the material script
+    // write both the main OBJ file and the material script, each is streamed to its file directly
     {
         std::unique_ptr<IOStream> outfile (pIOSystem->Open(pFile,"wt"));
         if (outfile == nullptr) {
             throw DeadlyExportError("could not open output .obj file: " + std::string(pFile));
         }
-        outfile->Write( exporter.mOutput.str().c_str(), static_cast<size_t>(exporter.mOutput.tellp()),1);
+        exporter.WriteGeometry(outfile.get());
     }
     {
         std::unique_ptr<IOStream> outfile (pIOSystem->Open(exporter.GetMaterialLibFileName(),"wt"));
         if (outfile == nullptr) {
             throw DeadlyExportError("could not open output .mtl file: " + std::string(exporter.GetMaterialLibFileName()));
         }
-        outfile->Write( exporter.mOutputMat.str().c_str(), static_cast<size_t>(exporter.mOutputMat.tellp()),1);
+        exporter.WriteMaterials(outfile.get());
     }
 }
 
@@ -89,20 +85,12 @@ void ExportSceneObjNoMtl(const char* pFile,IOSystem* pIOSystem, const aiScene* p
     // invoke the exporter
     ObjExporter exporter(pFile, pScene, true, props);
 
-    if (exporter.mOutput.fail() || exporter.mOutputMat.fail()) {
-        throw DeadlyExportError("output data creation failed. Most likely the file became too large: " + std::string(pFile));
-    }
-
-    // we're still here - export successfully completed. Write both the main OBJ file and the material script
-    {
-        std::unique_ptr<IOStream> outfile (pIOSystem->Open(pFile,"wt"));
-        if (outfile == nullptr) {
-            throw DeadlyExportError("could not open output .obj file: " + std::string(pFile));
-        }
-        outfile->Write( exporter.mOutput.str().c_str(), static_cast<size_t>(exporter.mOutput.tellp()),1);
+    // write the main OBJ file
+    std::unique_ptr<IOStream> outfile (pIOSystem->Open(pFile,"wt"));
+    if (outfile == nullptr) {
+        throw DeadlyExportError("could not open output .obj file: " + std::string(pFile));
     }
-
-
+    exporter.WriteGeometry(outfile.get());
 }
 
 } // end of namespace Assimp
@@ -113,6 +101,8 @@ static const std::string MaterialExt = ".mtl";
 ObjExporter::ObjExporter(const char* _filename, const aiScene* pScene, bool noMtl, const ExportProperties* props)
 : filename(_filename)
 , pScene(pScene)
+, mNoMtl(noMtl)
+, mMergeIdenticalVertices(props == nullptr ? true : props->GetPropertyBool("bJoinIdenticalVertices", true))
 , vn()
 , vt()
 , vp()
@@ -122,20 +112,21 @@ ObjExporter::ObjExporter(const char* _filename, const aiScene* pScene, bool noMt
 , mVpMap()
 , mMeshes()
 , endl("\n") {
-    // make sure that all formatting happens using the standard, C locale and not the user's current locale
-    const std::locale& l = std::locale("C");
-    mOutput.imbue(l);
-    mOutput.precision(ASSIMP_AI_REAL_TEXT_PRECISION);
-    mOutputMat.imbue(l);
-    mOutputMat.precision(ASSIMP_AI_REAL_TEXT_PRECISION);
-
-    WriteGeometryFile(
-        noMtl,
-        props == nullptr ? true : props->GetPropertyBool("bJoinIdenticalVertices", true)
-    );
-    if ( !noMtl ) {
-        WriteMaterialFile();
-    }
+    // nothing is written before the output files are known, see WriteGeometry() and WriteMaterials()
+}
+
+// ------------------------------------------------------------------------------------------------
+void ObjExporter::WriteGeometry(IOStream* pStream) {
+    mOutput.setStream(pStream);
+    WriteGeometryFile(mNoMtl, mMergeIdenticalVertices);
+    mOutput.flush();
+}
+
+// ------------------------------------------------------------------------------------------------
+void ObjExporter::WriteMaterials(IOStream* pStream) {
+    mOutputMat.setStream(pStream);
+    WriteMaterialFile();
+    mOutputMat.flush();
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -165,7 +156,7 @@ std::string ObjExporter::GetMaterialLibFileName() {
 }
 
 // ------------------------------------------------------------------------------------------------
-void ObjExporter::WriteHeader(std::ostringstream& out) {
+void ObjExporter::WriteHeader(BufferedTextWriter& out) {
     out << "# File produced by Open Asset Import Library (http://www.assimp.sf.net)" << endl;
     out << "# (assimp v" << aiGetVersionMajor() << '.' << aiGetVersionMinor() << '.'
         << aiGetVersionRevision() << ")" << endl  << endl;
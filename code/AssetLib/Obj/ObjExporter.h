@@ -47,7 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AI_OBJEXPORTER_H_INC
 
 #include <assimp/types.h>
-#include <sstream>
+#include <assimp/BufferedTextWriter.h>
 #include <vector>
 #include <map>
 
@@ -70,8 +70,14 @@ public:
     std::string GetMaterialLibName();
     std::string GetMaterialLibFileName();
 
-    /// public string-streams to write all output into
-    std::ostringstream mOutput, mOutputMat;
+    /// Writes the OBJ file to the given stream
+    void WriteGeometry(IOStream* pStream);
+    /// Writes the material library to the given stream
+    void WriteMaterials(IOStream* pStream);
+
+private:
+    /// buffered writers for the OBJ file and the material library
+    BufferedTextWriter mOutput, mOutputMat;
 
 private:
     // intermediate data structures
@@ -97,7 +103,7 @@ private:
         std::vector<Face> faces;
     };
 
-    void WriteHeader(std::ostringstream& out);
+    void WriteHeader(BufferedTextWriter& out);
     void WriteMaterialFile();
     void WriteGeometryFile(bool noMtl=false, bool merge_identical_vertices = false);
     std::string GetMaterialName(unsigned int index);
@@ -107,6 +113,8 @@ private:
 private:
     std::string filename;
     const aiScene* const pScene;
+    bool mNoMtl;
+    bool mMergeIdenticalVertices;
 
     struct vertexData {
         aiVector3D vp;
@@ -44,6 +44,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ObjFileImporter.h"
 #include "ObjFileData.h"
 #include "ObjFileParser.h"
+#include "Common/ScenePrivate.h"
 #include <assimp/DefaultIOSystem.h>
 #include <assimp/IOStreamBuffer.h>
 #include <assimp/ai_assert.h>
@@ -52,6 +53,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/Importer.hpp>
 #include <assimp/ObjMaterial.h>
+#include <algorithm>
 #include <memory>
 
 static constexpr aiImporterDesc desc = {
@@ -78,7 +80,10 @@ using namespace std;
 ObjFileImporter::ObjFileImporter() :
         m_Buffer(),
         m_pRootObject(nullptr),
-        m_strAbsPath(std::string(1, DefaultIOSystem().getOsSeparator())) {
+        m_strAbsPath(std::string(1, DefaultIOSystem().getOsSeparator())),
+        m_numThreads(1),
+        m_blockSize(0),
+        m_prefetchBlocks(1) {
     // empty
 }
 
@@ -100,6 +105,14 @@ const aiImporterDesc *ObjFileImporter::GetInfo() const {
     return &desc;
 }
 
+// ------------------------------------------------------------------------------------------------
+//  Setup configuration properties for the loader
+void ObjFileImporter::SetupProperties(const Importer *pImp) {
+    m_numThreads = static_cast<unsigned int>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_OBJ_PARSE_THREADS, 1)));
+    m_blockSize = static_cast<size_t>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_STREAM_BLOCK_SIZE, 0)));
+    m_prefetchBlocks = static_cast<size_t>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_STREAM_PREFETCH_BLOCKS, 1)));
+}
+
 // ------------------------------------------------------------------------------------------------
 //  Obj-file import implementation
 void ObjFileImporter::InternReadFile(const std::string &file, aiScene *pScene, IOSystem *pIOHandler) {
@@ -124,7 +137,7 @@ void ObjFileImporter::InternReadFile(const std::string &file, aiScene *pScene, I
         throw DeadlyImportError("OBJ-file is too small.");
     }
 
-    IOStreamBuffer<char> streamedBuffer;
+    IOStreamBuffer<char> streamedBuffer(m_blockSize > 0 ? m_blockSize : 4096 * 4096, m_prefetchBlocks);
     streamedBuffer.open(fileStream.get());
 
     // Allocate buffer and read file into it
@@ -144,7 +157,7 @@ void ObjFileImporter::InternReadFile(const std::string &file, aiScene *pScene, I
     }
 
     // parse the file into a temporary representation
-    ObjFileParser parser(streamedBuffer, modelName, pIOHandler, m_progress, file);
+    ObjFileParser parser(streamedBuffer, modelName, pIOHandler, m_progress, file, m_numThreads);
 
     // And create the proper return structures out of it
     CreateDataFromImport(parser.GetModel(), pScene);
@@ -273,7 +286,7 @@ aiNode *ObjFileImporter::createNodes(const ObjFile::Model *pModel, const ObjFile
 
     for (size_t i = 0; i < pObject->m_Meshes.size(); ++i) {
         unsigned int meshId = pObject->m_Meshes[i];
-        std::unique_ptr<aiMesh> pMesh = createTopology(pModel, pObject, meshId);
+        std::unique_ptr<aiMesh> pMesh = createTopology(pModel, pObject, meshId, pScene);
         if (pMesh != nullptr) {
             if (pMesh->mNumFaces > 0) {
                 MeshArray.push_back(std::move(pMesh));
@@ -308,7 +321,8 @@ aiNode *ObjFileImporter::createNodes(const ObjFile::Model *pModel, const ObjFile
 
 // ------------------------------------------------------------------------------------------------
 //  Create topology data
-std::unique_ptr<aiMesh> ObjFileImporter::createTopology(const ObjFile::Model *pModel, const ObjFile::Object *pData, unsigned int meshIndex) {
+std::unique_ptr<aiMesh> ObjFileImporter::createTopology(const ObjFile::Model *pModel, const ObjFile::Object *pData, unsigned int meshIndex,
+        aiScene *pScene) {
     if (nullptr == pData || pModel == nullptr) {
         return nullptr;
     }
@@ -352,39 +366,28 @@ std::unique_ptr<aiMesh> ObjFileImporter::createTopology(const ObjFile::Model *pM
 
     unsigned int uiIdxCount = 0u;
     if (pMesh->mNumFaces > 0) {
-        pMesh->mFaces = new aiFace[pMesh->mNumFaces];
         if (pObjMesh->m_uiMaterialIndex != ObjFile::Mesh::NoMaterial) {
             pMesh->mMaterialIndex = pObjMesh->m_uiMaterialIndex;
         }
 
-        unsigned int outIndex = 0u;
-
-        // Copy all data from all stored meshes
+        // Lines and points are split into one face per segment or point
+        std::vector<unsigned int> faceSizes;
+        faceSizes.reserve(pMesh->mNumFaces);
         for (auto &face : pObjMesh->m_Faces) {
             const ObjFile::Face *inp = face;
             if (inp->mPrimitiveType == aiPrimitiveType_LINE) {
-                for (size_t i = 0; i < inp->m_vertices.size() - 1; ++i) {
-                    aiFace &f = pMesh->mFaces[outIndex++];
-                    uiIdxCount += f.mNumIndices = 2;
-                    f.mIndices = new unsigned int[2];
-                }
-                continue;
+                faceSizes.insert(faceSizes.end(), inp->m_vertices.size() - 1, 2u);
             } else if (inp->mPrimitiveType == aiPrimitiveType_POINT) {
-                for (size_t i = 0; i < inp->m_vertices.size(); ++i) {
-                    aiFace &f = pMesh->mFaces[outIndex++];
-                    uiIdxCount += f.mNumIndices = 1;
-                    f.mIndices = new unsigned int[1];
-                }
-                continue;
-            }
-
-            aiFace *pFace = &pMesh->mFaces[outIndex++];
-            const unsigned int uiNumIndices = (unsigned int)face->m_vertices.size();
-            uiIdxCount += pFace->mNumIndices = (unsigned int)uiNumIndices;
-            if (pFace->mNumIndices > 0) {
-                pFace->mIndices = new unsigned int[uiNumIndices];
+                faceSizes.insert(faceSizes.end(), inp->m_vertices.size(), 1u);
+            } else {
+                faceSizes.push_back(static_cast<unsigned int>(inp->m_vertices.size()));
             }
         }
+        for (unsigned int size : faceSizes) {
+            uiIdxCount += size;
+        }
+        unsigned int *arena = contiguousFaceIndices ? AllocateArenaFaceIndices(pScene, uiIdxCount) : nullptr;
+        pMesh->AllocateFaces(pMesh->mNumFaces, faceSizes.data(), contiguousFaceIndices, arena);
     }
 
     // Create mesh vertices
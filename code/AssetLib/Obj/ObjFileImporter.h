@@ -77,6 +77,9 @@ protected:
     //! \brief  Appends the supported extension.
     const aiImporterDesc *GetInfo() const override;
 
+    //! \brief  Reads the configuration properties.
+    void SetupProperties(const Importer *pImp) override;
+
     //! \brief  File import implementation.
     void InternReadFile(const std::string &pFile, aiScene *pScene, IOSystem *pIOHandler) override;
 
@@ -89,7 +92,7 @@ protected:
 
     //! \brief  Creates topology data like faces and meshes for the geometry.
     std::unique_ptr<aiMesh> createTopology(const ObjFile::Model *pModel, const ObjFile::Object *pData,
-            unsigned int uiMeshIndex);
+            unsigned int uiMeshIndex, aiScene *pScene);
 
     //! \brief  Creates vertices from model.
     void createVertexArray(const ObjFile::Model *pModel, const ObjFile::Object *pCurrentObject,
@@ -114,6 +117,11 @@ private:
     ObjFile::Object *m_pRootObject;
     //! Absolute pathname of model in file system
     std::string m_strAbsPath;
+    //! Number of parser threads, see AI_CONFIG_IMPORT_OBJ_PARSE_THREADS
+    unsigned int m_numThreads;
+    //! Block size and number of blocks read ahead, see AI_CONFIG_IMPORT_STREAM_BLOCK_SIZE
+    size_t m_blockSize;
+    size_t m_prefetchBlocks;
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -44,12 +44,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ObjFileData.h"
 #include "ObjFileMtlImporter.h"
 #include "ObjTools.h"
+#include "Common/ThreadPool.h"
 #include <assimp/BaseImporter.h>
 #include <assimp/DefaultIOSystem.h>
 #include <assimp/ParsingUtils.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/Importer.hpp>
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <utility>
 
@@ -72,7 +75,7 @@ ObjFileParser::ObjFileParser() :
 
 ObjFileParser::ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::string &modelName,
         IOSystem *io, ProgressHandler *progress,
-        const std::string &originalObjFileName) :
+        const std::string &originalObjFileName, unsigned int numThreads) :
         m_DataIt(),
         m_DataItEnd(),
         m_pModel(nullptr),
@@ -94,7 +97,11 @@ ObjFileParser::ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::stri
     m_pModel->mMaterialMap[DEFAULT_MATERIAL] = m_pModel->mDefaultMaterial;
 
     // Start parsing the file
-    parseFile(streamBuffer);
+    if (1 == numThreads) {
+        parseFile(streamBuffer);
+    } else {
+        parseFileParallel(streamBuffer, numThreads);
+    }
 }
 
 void ObjFileParser::setBuffer(std::vector<char> &buffer) {
@@ -136,130 +143,454 @@ void ObjFileParser::parseFile(IOStreamBuffer<char> &streamBuffer) {
             m_progress->UpdateFileRead(processed, progressTotal);
         }
 
-        // handle c-stype section end (http://paulbourke.net/dataformats/obj/)
-        if (insideCstype) {
-            switch (*m_DataIt) {
-            case 'e': {
-                std::string name;
-                getNameNoSpace(m_DataIt, m_DataItEnd, name);
-                insideCstype = name != "end";
-            } break;
-            }
-            goto pf_skip_line;
-        }
+        parseLine(insideCstype);
+    }
+}
 
-        // parse line
+void ObjFileParser::parseLine(bool &insideCstype) {
+    // handle c-stype section end (http://paulbourke.net/dataformats/obj/)
+    if (insideCstype) {
         switch (*m_DataIt) {
-        case 'v': // Parse a vertex texture coordinate
-        {
-            ++m_DataIt;
-            if (*m_DataIt == ' ' || *m_DataIt == '\t') {
-                size_t numComponents = getNumComponentsInDataDefinition();
-                if (numComponents == 3) {
-                    // read in vertex definition
-                    getVector3(m_pModel->mVertices);
-                } else if (numComponents == 4) {
-                    // read in vertex definition (homogeneous coords)
-                    getHomogeneousVector3(m_pModel->mVertices);
-                } else if (numComponents == 6) {
-                    // fill previous omitted vertex-colors by default
-                    if (m_pModel->mVertexColors.size() < m_pModel->mVertices.size()) {
-                        m_pModel->mVertexColors.resize(m_pModel->mVertices.size(), aiVector3D(0, 0, 0));
-                    }
-                    // read vertex and vertex-color
-                    getTwoVectors3(m_pModel->mVertices, m_pModel->mVertexColors);
-                }
-                // append omitted vertex-colors as default for the end if any vertex-color exists
-                if (!m_pModel->mVertexColors.empty() && m_pModel->mVertexColors.size() < m_pModel->mVertices.size()) {
+        case 'e': {
+            std::string name;
+            getNameNoSpace(m_DataIt, m_DataItEnd, name);
+            insideCstype = name != "end";
+        } break;
+        }
+        goto pf_skip_line;
+    }
+
+    // parse line
+    switch (*m_DataIt) {
+    case 'v': // Parse a vertex texture coordinate
+    {
+        ++m_DataIt;
+        if (*m_DataIt == ' ' || *m_DataIt == '\t') {
+            size_t numComponents = getNumComponentsInDataDefinition();
+            if (numComponents == 3) {
+                // read in vertex definition
+                getVector3(m_pModel->mVertices);
+            } else if (numComponents == 4) {
+                // read in vertex definition (homogeneous coords)
+                getHomogeneousVector3(m_pModel->mVertices);
+            } else if (numComponents == 6) {
+                // fill previous omitted vertex-colors by default
+                if (m_pModel->mVertexColors.size() < m_pModel->mVertices.size()) {
                     m_pModel->mVertexColors.resize(m_pModel->mVertices.size(), aiVector3D(0, 0, 0));
                 }
-            } else if (*m_DataIt == 't') {
-                // read in texture coordinate ( 2D or 3D )
-                ++m_DataIt;
-                size_t dim = getTexCoordVector(m_pModel->mTextureCoord);
-                m_pModel->mTextureCoordDim = std::max(m_pModel->mTextureCoordDim, (unsigned int)dim);
-            } else if (*m_DataIt == 'n') {
-                // Read in normal vector definition
-                ++m_DataIt;
-                getVector3(m_pModel->mNormals);
+                // read vertex and vertex-color
+                getTwoVectors3(m_pModel->mVertices, m_pModel->mVertexColors);
             }
-        } break;
+            // append omitted vertex-colors as default for the end if any vertex-color exists
+            if (!m_pModel->mVertexColors.empty() && m_pModel->mVertexColors.size() < m_pModel->mVertices.size()) {
+                m_pModel->mVertexColors.resize(m_pModel->mVertices.size(), aiVector3D(0, 0, 0));
+            }
+        } else if (*m_DataIt == 't') {
+            // read in texture coordinate ( 2D or 3D )
+            ++m_DataIt;
+            size_t dim = getTexCoordVector(m_pModel->mTextureCoord);
+            m_pModel->mTextureCoordDim = std::max(m_pModel->mTextureCoordDim, (unsigned int)dim);
+        } else if (*m_DataIt == 'n') {
+            // Read in normal vector definition
+            ++m_DataIt;
+            getVector3(m_pModel->mNormals);
+        }
+    } break;
 
-        case 'p': // Parse a face, line or point statement
-        case 'l':
-        case 'f': {
-            getFace(*m_DataIt == 'f' ? aiPrimitiveType_POLYGON : (*m_DataIt == 'l' ? aiPrimitiveType_LINE : aiPrimitiveType_POINT));
-        } break;
+    case 'p': // Parse a face, line or point statement
+    case 'l':
+    case 'f': {
+        getFace(*m_DataIt == 'f' ? aiPrimitiveType_POLYGON : (*m_DataIt == 'l' ? aiPrimitiveType_LINE : aiPrimitiveType_POINT));
+    } break;
 
-        case '#': // Parse a comment
-        {
-            getComment();
-        } break;
+    case '#': // Parse a comment
+    {
+        getComment();
+    } break;
 
-        case 'u': // Parse a material desc. setter
-        {
-            std::string name;
+    case 'u': // Parse a material desc. setter
+    {
+        std::string name;
 
-            getNameNoSpace(m_DataIt, m_DataItEnd, name);
+        getNameNoSpace(m_DataIt, m_DataItEnd, name);
+
+        size_t nextSpace = name.find(' ');
+        if (nextSpace != std::string::npos)
+            name = name.substr(0, nextSpace);
+
+        if (name == "usemtl") {
+            getMaterialDesc();
+        }
+    } break;
+
+    case 'm': // Parse a material library or merging group ('mg')
+    {
+        std::string name;
+
+        getNameNoSpace(m_DataIt, m_DataItEnd, name);
 
-            size_t nextSpace = name.find(' ');
-            if (nextSpace != std::string::npos)
-                name = name.substr(0, nextSpace);
+        size_t nextSpace = name.find(' ');
+        if (nextSpace != std::string::npos)
+            name = name.substr(0, nextSpace);
 
-            if (name == "usemtl") {
-                getMaterialDesc();
+        if (name == "mg")
+            getGroupNumberAndResolution();
+        else if (name == "mtllib")
+            getMaterialLib();
+        else
+            goto pf_skip_line;
+    } break;
+
+    case 'g': // Parse group name
+    {
+        getGroupName();
+    } break;
+
+    case 's': // Parse group number
+    {
+        getGroupNumber();
+    } break;
+
+    case 'o': // Parse object name
+    {
+        getObjectName();
+    } break;
+
+    case 'c': // handle cstype section start
+    {
+        std::string name;
+        getNameNoSpace(m_DataIt, m_DataItEnd, name);
+        insideCstype = name == "cstype";
+        goto pf_skip_line;
+    }
+
+    default: {
+    pf_skip_line:
+        m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
+    } break;
+    }
+}
+
+// -------------------------------------------------------------------
+//  Parallel parsing
+// -------------------------------------------------------------------
+
+/// A line-aligned part of the input. The vertex attributes of a chunk are parsed independently
+/// of all others, faces need the number of attributes in front of the chunk for relative
+/// indices. All remaining lines are kept and parsed in file order after all chunks are done.
+struct ObjFileParser::ParseChunk {
+    struct Line {
+        const char *begin;
+        unsigned int numVertices;
+        unsigned int numTexCoords;
+        unsigned int numNormals;
+        bool isFace;
+        bool hasNormal;
+        std::unique_ptr<ObjFile::Face> face;
+    };
+
+    const char *begin = nullptr;
+    const char *end = nullptr;
+    std::vector<aiVector3D> vertices;
+    std::vector<aiVector3D> normals;
+    std::vector<aiVector3D> texCoords;
+    std::vector<std::pair<size_t, aiVector3D>> vertexColors;
+    unsigned int texCoordDim = 0;
+    std::vector<Line> lines;
+    unsigned int vertexBase = 0;
+    unsigned int texCoordBase = 0;
+    unsigned int normalBase = 0;
+    bool hasCstype = false;
+};
+
+namespace {
+
+// input is handed to the workers in windows of this size, if the file is mapped into memory
+constexpr size_t ParallelWindowSize = 64 * 1024 * 1024;
+// minimum size of a chunk, smaller ones aren't worth a work item
+constexpr size_t MinChunkSize = 256 * 1024;
+
+// Reads the line at pos into line, terminated by '\n' and a '\0' behind it. Follows
+// IOStreamBuffer::getNextDataLine(), so backslash continuations join lines. The line
+// parsers expect some data behind the line end, see isEndOfBuffer(). Returns the start
+// of the next line.
+const char *readDataLine(const char *pos, const char *end, std::vector<char> &line) {
+    line.clear();
+    while (pos < end) {
+        if ('\\' == *pos && pos + 1 < end && IsLineEnd(pos[1])) {
+            ++pos;
+            while (pos < end && *pos != '\n') {
+                ++pos;
             }
-        } break;
+            if (++pos >= end) {
+                break;
+            }
+        } else if (IsLineEnd(*pos)) {
+            line.push_back('\n');
+            line.push_back('\0');
+            return pos + 1;
+        }
+        line.push_back(*pos);
+        ++pos;
+    }
+    line.push_back('\n');
+    line.push_back('\0');
+    return end;
+}
 
-        case 'm': // Parse a material library or merging group ('mg')
-        {
-            std::string name;
+// Returns true if a line starts behind the '\n' at pos. This is not the case if the '\n' is
+// part of a continuation. To keep it simple, lines containing a backslash are never split.
+bool isLineBoundary(const char *begin, const char *pos) {
+    const char *it = pos;
+    while (it > begin && it[-1] != '\n') {
+        if (*--it == '\\') {
+            return false;
+        }
+    }
+    return it != pos && it != begin;
+}
 
-            getNameNoSpace(m_DataIt, m_DataItEnd, name);
+// Returns the start of the first line at or behind pos
+const char *findLineStart(const char *begin, const char *pos, const char *end) {
+    for (; pos < end; ++pos) {
+        if ('\n' == *pos && isLineBoundary(begin, pos)) {
+            return pos + 1;
+        }
+    }
+    return end;
+}
 
-            size_t nextSpace = name.find(' ');
-            if (nextSpace != std::string::npos)
-                name = name.substr(0, nextSpace);
+// Returns the end of the last complete line in [begin, end), or begin if there is none
+const char *findLastLineEnd(const char *begin, const char *end) {
+    for (const char *pos = end; pos > begin; --pos) {
+        if ('\n' == pos[-1] && isLineBoundary(begin, pos - 1)) {
+            return pos;
+        }
+    }
+    return begin;
+}
 
-            if (name == "mg")
-                getGroupNumberAndResolution();
-            else if (name == "mtllib")
-                getMaterialLib();
-            else
-                goto pf_skip_line;
-        } break;
+} // namespace
 
-        case 'g': // Parse group name
-        {
-            getGroupName();
-        } break;
+void ObjFileParser::parseFileParallel(IOStreamBuffer<char> &streamBuffer, unsigned int numThreads) {
+    const unsigned int progressTotal = static_cast<unsigned int>(streamBuffer.size());
+    ThreadPool pool(numThreads);
 
-        case 's': // Parse group number
-        {
-            getGroupNumber();
-        } break;
+    // Files with curve sections are parsed sequentially from the first one on, the
+    // lines between cstype and end are skipped and that can't be seen from a chunk.
+    bool sequential = false;
+    bool insideCstype = false;
+    bool firstWindow = true;
+    std::vector<char> line;
+
+    auto parseWindow = [&](const char *begin, const char *end) {
+        if (firstWindow && end - begin >= 3 &&
+                static_cast<unsigned char>(begin[0]) == 0xEF &&
+                static_cast<unsigned char>(begin[1]) == 0xBB &&
+                static_cast<unsigned char>(begin[2]) == 0xBF) {
+            begin += 3; // skip BOM
+        }
+        firstWindow = false;
+
+        std::vector<ParseChunk> chunks;
+        if (!sequential) {
+            const size_t numChunks = std::max<size_t>(1, std::min<size_t>(pool.GetNumThreads() * 4,
+                    static_cast<size_t>(end - begin) / MinChunkSize));
+            chunks.resize(numChunks);
+            const char *pos = begin;
+            for (size_t i = 0; i < numChunks; ++i) {
+                chunks[i].begin = pos;
+                pos = (i + 1 == numChunks) ? end :
+                        findLineStart(begin, std::max(pos, begin + (end - begin) * (i + 1) / numChunks), end);
+                chunks[i].end = pos;
+            }
+
+            ASSIMP_LOG_DEBUG("ObjFileParser: parsing ", chunks.size(), " chunks in parallel on ", pool.GetNumThreads(), " threads");
+            pool.ParallelFor(chunks.size(), [&chunks](size_t i) {
+                ObjFileParser worker;
+                worker.parseChunkAttributes(chunks[i]);
+            });
+
+            for (const ParseChunk &chunk : chunks) {
+                sequential = sequential || chunk.hasCstype;
+            }
+        }
+
+        if (sequential) {
+            for (const char *pos = begin; pos < end;) {
+                pos = readDataLine(pos, end, line);
+                m_DataIt = line.begin();
+                m_DataItEnd = line.end();
+                mEnd = line.data() + line.size();
+                parseLine(insideCstype);
+            }
+            return;
+        }
+
+        // attribute counts in front of each chunk
+        unsigned int numVertices = static_cast<unsigned int>(m_pModel->mVertices.size());
+        unsigned int numTexCoords = static_cast<unsigned int>(m_pModel->mTextureCoord.size());
+        unsigned int numNormals = static_cast<unsigned int>(m_pModel->mNormals.size());
+        for (ParseChunk &chunk : chunks) {
+            chunk.vertexBase = numVertices;
+            chunk.texCoordBase = numTexCoords;
+            chunk.normalBase = numNormals;
+            numVertices += static_cast<unsigned int>(chunk.vertices.size());
+            numTexCoords += static_cast<unsigned int>(chunk.texCoords.size());
+            numNormals += static_cast<unsigned int>(chunk.normals.size());
+        }
 
-        case 'o': // Parse object name
-        {
-            getObjectName();
+        pool.ParallelFor(chunks.size(), [&chunks](size_t i) {
+            ObjFileParser worker;
+            worker.parseChunkFaces(chunks[i]);
+        });
+
+        // merge in file order, vertex colors which are not given default to black
+        bool hasVertexColors = !m_pModel->mVertexColors.empty();
+        for (ParseChunk &chunk : chunks) {
+            m_pModel->mVertices.insert(m_pModel->mVertices.end(), chunk.vertices.begin(), chunk.vertices.end());
+            m_pModel->mTextureCoord.insert(m_pModel->mTextureCoord.end(), chunk.texCoords.begin(), chunk.texCoords.end());
+            m_pModel->mNormals.insert(m_pModel->mNormals.end(), chunk.normals.begin(), chunk.normals.end());
+            m_pModel->mTextureCoordDim = std::max(m_pModel->mTextureCoordDim, chunk.texCoordDim);
+            hasVertexColors = hasVertexColors || !chunk.vertexColors.empty();
+        }
+        if (hasVertexColors) {
+            m_pModel->mVertexColors.resize(m_pModel->mVertices.size(), aiVector3D(0, 0, 0));
+            for (const ParseChunk &chunk : chunks) {
+                for (const auto &color : chunk.vertexColors) {
+                    m_pModel->mVertexColors[chunk.vertexBase + color.first] = color.second;
+                }
+            }
+        }
+
+        // groups, materials and objects are resolved sequentially, this is where faces are assigned
+        for (ParseChunk &chunk : chunks) {
+            for (ParseChunk::Line &l : chunk.lines) {
+                if (l.isFace) {
+                    if (l.face) {
+                        storeFace(l.face.release(), l.hasNormal);
+                    }
+                    continue;
+                }
+                readDataLine(l.begin, chunk.end, line);
+                m_DataIt = line.begin();
+                m_DataItEnd = line.end();
+                mEnd = line.data() + line.size();
+                parseLine(insideCstype);
+            }
+        }
+    };
+
+    const char *view = nullptr;
+    size_t viewSize = 0;
+    if (streamBuffer.getRemainingView(view, viewSize)) {
+        const char *end = view + viewSize;
+        for (const char *pos = view; pos < end;) {
+            const char *windowEnd = (static_cast<size_t>(end - pos) <= ParallelWindowSize) ? end :
+                    findLineStart(pos, pos + ParallelWindowSize, end);
+            parseWindow(pos, windowEnd);
+            pos = windowEnd;
+            m_progress->UpdateFileRead(static_cast<unsigned int>(pos - view), progressTotal);
+        }
+        return;
+    }
+
+    // otherwise go block by block, keeping incomplete lines for the next one
+    std::vector<char> pending, block;
+    while (streamBuffer.getNextBlock(block)) {
+        block.resize(std::min(block.size(), streamBuffer.cacheSize()));
+        pending.insert(pending.end(), block.begin(), block.end());
+
+        const char *begin = pending.data();
+        const char *windowEnd = findLastLineEnd(begin, begin + pending.size());
+        if (windowEnd != begin) {
+            parseWindow(begin, windowEnd);
+            pending.erase(pending.begin(), pending.begin() + (windowEnd - begin));
+        }
+        m_progress->UpdateFileRead(static_cast<unsigned int>(streamBuffer.getFilePos()), progressTotal);
+    }
+    if (!pending.empty()) {
+        parseWindow(pending.data(), pending.data() + pending.size());
+    }
+}
+
+void ObjFileParser::parseChunkAttributes(ParseChunk &chunk) {
+    std::vector<char> line;
+    for (const char *pos = chunk.begin; pos < chunk.end;) {
+        const char *lineBegin = pos;
+        pos = readDataLine(pos, chunk.end, line);
+        m_DataIt = line.begin();
+        m_DataItEnd = line.end();
+        mEnd = line.data() + line.size();
+
+        switch (*m_DataIt) {
+        case 'v': {
+            // same as in parseLine(), vertex colors are resolved when merging
+            ++m_DataIt;
+            if (*m_DataIt == ' ' || *m_DataIt == '\t') {
+                size_t numComponents = getNumComponentsInDataDefinition();
+                if (numComponents == 3) {
+                    getVector3(chunk.vertices);
+                } else if (numComponents == 4) {
+                    getHomogeneousVector3(chunk.vertices);
+                } else if (numComponents == 6) {
+                    std::vector<aiVector3D> color;
+                    getTwoVectors3(chunk.vertices, color);
+                    chunk.vertexColors.emplace_back(chunk.vertices.size() - 1, color.back());
+                }
+            } else if (*m_DataIt == 't') {
+                ++m_DataIt;
+                size_t dim = getTexCoordVector(chunk.texCoords);
+                chunk.texCoordDim = std::max(chunk.texCoordDim, (unsigned int)dim);
+            } else if (*m_DataIt == 'n') {
+                ++m_DataIt;
+                getVector3(chunk.normals);
+            }
         } break;
 
-        case 'c': // handle cstype section start
-        {
+        case '#':
+        case '\n':
+            break;
+
+        case 'c': {
             std::string name;
             getNameNoSpace(m_DataIt, m_DataItEnd, name);
-            insideCstype = name == "cstype";
-            goto pf_skip_line;
+            chunk.hasCstype = chunk.hasCstype || name == "cstype";
         }
+            [[fallthrough]];
 
         default: {
-        pf_skip_line:
-            m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
+            const bool isFace = *m_DataIt == 'f' || *m_DataIt == 'l' || *m_DataIt == 'p';
+            chunk.lines.push_back({ lineBegin,
+                    static_cast<unsigned int>(chunk.vertices.size()),
+                    static_cast<unsigned int>(chunk.texCoords.size()),
+                    static_cast<unsigned int>(chunk.normals.size()),
+                    isFace, false, nullptr });
         } break;
         }
     }
 }
 
+void ObjFileParser::parseChunkFaces(ParseChunk &chunk) {
+    std::vector<char> line;
+    for (ParseChunk::Line &l : chunk.lines) {
+        if (!l.isFace) {
+            continue;
+        }
+        readDataLine(l.begin, chunk.end, line);
+        m_DataIt = line.begin();
+        m_DataItEnd = line.end();
+        mEnd = line.data() + line.size();
+
+        const aiPrimitiveType type = *m_DataIt == 'f' ? aiPrimitiveType_POLYGON : (*m_DataIt == 'l' ? aiPrimitiveType_LINE : aiPrimitiveType_POINT);
+        l.face.reset(parseFace(type,
+                static_cast<int>(chunk.vertexBase + l.numVertices),
+                static_cast<int>(chunk.texCoordBase + l.numTexCoords),
+                static_cast<int>(chunk.normalBase + l.numNormals),
+                l.hasNormal));
+    }
+}
+
 void ObjFileParser::copyNextWord(char *pBuffer, size_t length) {
     size_t index = 0;
     m_DataIt = getNextWord<DataArrayIt>(m_DataIt, m_DataItEnd);
@@ -323,116 +654,79 @@ size_t ObjFileParser::getNumComponentsInDataDefinition() {
     return numComponents;
 }
 
-size_t ObjFileParser::getTexCoordVector(std::vector<aiVector3D> &point3d_array) {
-    size_t numComponents = getNumComponentsInDataDefinition();
-    ai_real x, y, z;
-    if (2 == numComponents) {
-        copyNextWord(m_buffer, Buffersize);
-        x = (ai_real)fast_atof(m_buffer);
-
-        copyNextWord(m_buffer, Buffersize);
-        y = (ai_real)fast_atof(m_buffer);
-        z = 0.0;
-    } else if (3 == numComponents) {
-        copyNextWord(m_buffer, Buffersize);
-        x = (ai_real)fast_atof(m_buffer);
-
+void ObjFileParser::getReals(ai_real *values, size_t count) {
+    size_t numRead = 0;
+    if (m_DataIt != m_DataItEnd) {
+        // plain numbers are read in one go, line continuations and
+        // anything unusual are left to copyNextWord()
+        const char *begin = &*m_DataIt;
+        const size_t length = m_DataItEnd - m_DataIt;
+        const char *lineEnd = static_cast<const char *>(::memchr(begin, '\n', length));
+        const char *cur = begin;
+        numRead = fast_atoreal_array(cur, lineEnd ? lineEnd : begin + length, values, count);
+        m_DataIt += cur - begin;
+    }
+    for (; numRead < count; ++numRead) {
         copyNextWord(m_buffer, Buffersize);
-        y = (ai_real)fast_atof(m_buffer);
+        values[numRead] = (ai_real)fast_atof(m_buffer);
+    }
+}
 
-        copyNextWord(m_buffer, Buffersize);
-        z = (ai_real)fast_atof(m_buffer);
+size_t ObjFileParser::getTexCoordVector(std::vector<aiVector3D> &point3d_array) {
+    size_t numComponents = getNumComponentsInDataDefinition();
+    ai_real v[3] = { 0.0, 0.0, 0.0 };
+    if (2 == numComponents || 3 == numComponents) {
+        getReals(v, numComponents);
     } else {
         throw DeadlyImportError("OBJ: Invalid number of components");
     }
 
     // Coerce nan and inf to 0 as is the OBJ default value
-    if (!std::isfinite(x))
-        x = 0;
-
-    if (!std::isfinite(y))
-        y = 0;
-
-    if (!std::isfinite(z))
-        z = 0;
+    for (ai_real &f : v) {
+        if (!std::isfinite(f))
+            f = 0;
+    }
 
-    point3d_array.emplace_back(x, y, z);
+    point3d_array.emplace_back(v[0], v[1], v[2]);
     m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
     return numComponents;
 }
 
 void ObjFileParser::getVector3(std::vector<aiVector3D> &point3d_array) {
-    ai_real x, y, z;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
+    ai_real v[3];
+    getReals(v, 3);
 
-    copyNextWord(m_buffer, Buffersize);
-    z = (ai_real)fast_atof(m_buffer);
-
-    point3d_array.emplace_back(x, y, z);
+    point3d_array.emplace_back(v[0], v[1], v[2]);
     m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
 
 void ObjFileParser::getHomogeneousVector3(std::vector<aiVector3D> &point3d_array) {
-    ai_real x, y, z, w;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    z = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    w = (ai_real)fast_atof(m_buffer);
+    ai_real v[4];
+    getReals(v, 4);
 
+    const ai_real w = v[3];
     if (w == 0)
         throw DeadlyImportError("OBJ: Invalid component in homogeneous vector (Division by zero)");
 
-    point3d_array.emplace_back(x / w, y / w, z / w);
+    point3d_array.emplace_back(v[0] / w, v[1] / w, v[2] / w);
     m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
 
 void ObjFileParser::getTwoVectors3(std::vector<aiVector3D> &point3d_array_a, std::vector<aiVector3D> &point3d_array_b) {
-    ai_real x, y, z;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
+    ai_real v[6];
+    getReals(v, 6);
 
-    copyNextWord(m_buffer, Buffersize);
-    z = (ai_real)fast_atof(m_buffer);
-
-    point3d_array_a.emplace_back(x, y, z);
-
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    z = (ai_real)fast_atof(m_buffer);
-
-    point3d_array_b.emplace_back(x, y, z);
+    point3d_array_a.emplace_back(v[0], v[1], v[2]);
+    point3d_array_b.emplace_back(v[3], v[4], v[5]);
 
     m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
 
 void ObjFileParser::getVector2(std::vector<aiVector2D> &point2d_array) {
-    ai_real x, y;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
+    ai_real v[2];
+    getReals(v, 2);
 
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
-
-    point2d_array.emplace_back(x, y);
+    point2d_array.emplace_back(v[0], v[1]);
 
     m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
@@ -440,20 +734,28 @@ void ObjFileParser::getVector2(std::vector<aiVector2D> &point2d_array) {
 static constexpr char DefaultObjName[] = "defaultobject";
 
 void ObjFileParser::getFace(aiPrimitiveType type) {
+    bool hasNormal = false;
+    ObjFile::Face *face = parseFace(type,
+            static_cast<unsigned int>(m_pModel->mVertices.size()),
+            static_cast<unsigned int>(m_pModel->mTextureCoord.size()),
+            static_cast<unsigned int>(m_pModel->mNormals.size()),
+            hasNormal);
+    if (nullptr != face) {
+        storeFace(face, hasNormal);
+    }
+}
+
+ObjFile::Face *ObjFileParser::parseFace(aiPrimitiveType type, int vSize, int vtSize, int vnSize, bool &hasNormal) {
     m_DataIt = getNextToken<DataArrayIt>(m_DataIt, m_DataItEnd);
     if (m_DataIt == m_DataItEnd || *m_DataIt == '\0') {
-        return;
+        return nullptr;
     }
 
     ObjFile::Face *face = new ObjFile::Face(type);
-    bool hasNormal = false;
-
-    const int vSize = static_cast<unsigned int>(m_pModel->mVertices.size());
-    const int vtSize = static_cast<unsigned int>(m_pModel->mTextureCoord.size());
-    const int vnSize = static_cast<unsigned int>(m_pModel->mNormals.size());
+    hasNormal = false;
 
-    const bool vt = (!m_pModel->mTextureCoord.empty());
-    const bool vn = (!m_pModel->mNormals.empty());
+    const bool vt = (vtSize > 0);
+    const bool vn = (vnSize > 0);
     int iPos = 0;
     while (m_DataIt < m_DataItEnd) {
         int iStep = 1;
@@ -531,14 +833,19 @@ void ObjFileParser::getFace(aiPrimitiveType type) {
         m_DataIt += iStep;
     }
 
+    // skip the rest of the line
+    m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
+
     if (face->m_vertices.empty()) {
         ASSIMP_LOG_ERROR("Obj: Ignoring empty face");
-        // skip line and clean up
-        m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
         delete face;
-        return;
+        return nullptr;
     }
 
+    return face;
+}
+
+void ObjFileParser::storeFace(ObjFile::Face *face, bool hasNormal) {
     // Set active material, if one set
     if (nullptr != m_pModel->mCurrentMaterial) {
         face->m_pMaterial = m_pModel->mCurrentMaterial;
@@ -563,8 +870,6 @@ void ObjFileParser::getFace(aiPrimitiveType type) {
     if (!m_pModel->mCurrentMesh->m_hasNormals && hasNormal) {
         m_pModel->mCurrentMesh->m_hasNormals = true;
     }
-    // Skip the rest of the line
-    m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
 
 void ObjFileParser::getMaterialDesc() {
@@ -74,7 +74,11 @@ public:
     /// @brief  The default constructor.
     ObjFileParser();
     /// @brief  Constructor with data array.
-    ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::string &modelName, IOSystem *io, ProgressHandler *progress, const std::string &originalObjFileName);
+    /// @param  numThreads  Number of threads parsing the vertex attributes and
+    ///                     faces, 0 for all hardware threads. 1 parses the file
+    ///                     line by line on the calling thread.
+    ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::string &modelName, IOSystem *io, ProgressHandler *progress, const std::string &originalObjFileName,
+            unsigned int numThreads = 1);
     /// @brief  Destructor
     ~ObjFileParser() = default;
     /// @brief  If you want to load in-core data.
@@ -86,10 +90,22 @@ public:
     ObjFileParser &operator=(const ObjFileParser& ) = delete;
 
 protected:
+    struct ParseChunk;
+
     /// Parse the loaded file
     void parseFile(IOStreamBuffer<char> &streamBuffer);
+    /// Parse the loaded file, distributing line-aligned chunks over worker threads
+    void parseFileParallel(IOStreamBuffer<char> &streamBuffer, unsigned int numThreads);
+    /// Parse the vertex attributes of a chunk and collect its remaining lines
+    void parseChunkAttributes(ParseChunk &chunk);
+    /// Parse the faces of a chunk, the attribute counts in front of the chunk are known
+    void parseChunkFaces(ParseChunk &chunk);
+    /// Parse the current line
+    void parseLine(bool &insideCstype);
     /// Method to copy the new delimited word in the current line.
     void copyNextWord(char *pBuffer, size_t length);
+    /// Reads the next count reals of the current line.
+    void getReals(ai_real *values, size_t count);
     /// Get the number of components in a line.
     size_t getNumComponentsInDataDefinition();
     /// Stores the vector
@@ -104,6 +120,10 @@ protected:
     void getVector2(std::vector<aiVector2D> &point2d_array);
     /// Stores the following face.
     void getFace(aiPrimitiveType type);
+    /// Reads the following face, indices are relative to the given attribute counts.
+    ObjFile::Face *parseFace(aiPrimitiveType type, int vSize, int vtSize, int vnSize, bool &hasNormal);
+    /// Assigns a face to the current mesh.
+    void storeFace(ObjFile::Face *face, bool hasNormal);
     /// Reads the material description.
     void getMaterialDesc();
     /// Gets a comment.
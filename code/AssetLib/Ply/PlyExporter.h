@@ -45,7 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef AI_PLYEXPORTER_H_INC
 #define AI_PLYEXPORTER_H_INC
 
-#include <sstream>
+#include <assimp/BufferedTextWriter.h>
 
 struct aiScene;
 struct aiNode;
@@ -58,19 +58,18 @@ namespace Assimp {
 // ------------------------------------------------------------------------------------------------
 class PlyExporter {
 public:
-    /// The class constructor for a specific scene to export
-    PlyExporter(const char* filename, const aiScene* pScene, bool binary = false);
+    /// The class constructor for a specific scene to export, writes it to the given stream
+    PlyExporter(const char* filename, const aiScene* pScene, IOStream* pStream, bool binary = false);
     /// The class destructor, empty.
     ~PlyExporter() = default;
 
     PlyExporter( const PlyExporter & ) = delete;
     PlyExporter &operator = ( const PlyExporter & ) = delete;
 
-public:
-    /// public string-streams to write all output into:
-    std::ostringstream mOutput;
-
 private:
+    /// buffered writer for the output file
+    BufferedTextWriter mOutput;
+
     void WriteMeshVerts(const aiMesh* m, unsigned int components);
     void WriteMeshIndices(const aiMesh* m, unsigned int ofs);
     void WriteMeshVertsBinary(const aiMesh* m, unsigned int components);
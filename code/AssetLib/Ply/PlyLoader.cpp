@@ -51,6 +51,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/importerdesc.h>
 #include <assimp/scene.h>
 #include <assimp/IOSystem.hpp>
+#include <assimp/Importer.hpp>
+#include <algorithm>
 #include <memory>
 
 namespace Assimp {
@@ -109,7 +111,9 @@ namespace {
 PLYImporter::PLYImporter() :
         mBuffer(nullptr),
         pcDOM(nullptr),
-        mGeneratedMesh(nullptr) {
+        mGeneratedMesh(nullptr),
+        mBlockSize(0),
+        mPrefetchBlocks(1) {
     // empty
 }
 
@@ -125,6 +129,13 @@ bool PLYImporter::CanRead(const std::string &pFile, IOSystem *pIOHandler, bool /
     return SearchFileHeaderForToken(pIOHandler, pFile, tokens, AI_COUNT_OF(tokens));
 }
 
+// ------------------------------------------------------------------------------------------------
+//  Setup configuration properties for the loader
+void PLYImporter::SetupProperties(const Importer *pImp) {
+    mBlockSize = static_cast<size_t>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_STREAM_BLOCK_SIZE, 0)));
+    mPrefetchBlocks = static_cast<size_t>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_STREAM_PREFETCH_BLOCKS, 1)));
+}
+
 // ------------------------------------------------------------------------------------------------
 const aiImporterDesc *PLYImporter::GetInfo() const {
     return &desc;
@@ -145,7 +156,7 @@ void PLYImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
         throw DeadlyImportError("File ", pFile, " is empty.");
     }
 
-    IOStreamBuffer<char> streamedBuffer(1024 * 1024);
+    IOStreamBuffer<char> streamedBuffer(mBlockSize > 0 ? mBlockSize : 1024 * 1024, mPrefetchBlocks);
     streamedBuffer.open(fileStream.get());
 
     // the beginning of the file must be PLY - magic, magic
@@ -264,10 +275,10 @@ void PLYImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 
 static constexpr ai_uint NotSet = 0xFFFFFFFF;
 
-void PLYImporter::LoadVertex(const PLY::Element *pcElement, const PLY::ElementInstance *instElement, unsigned int pos) {
-    ai_assert(nullptr != pcElement);
-    ai_assert(nullptr != instElement);
+namespace {
 
+// Indices and types of the properties of a vertex element, by semantic
+struct VertexProperties {
     ai_uint aiPositions[3] = { NotSet, NotSet, NotSet };
     PLY::EDataType aiTypes[3] = { EDT_Char, EDT_Char, EDT_Char };
 
@@ -280,144 +291,158 @@ void PLYImporter::LoadVertex(const PLY::Element *pcElement, const PLY::ElementIn
     unsigned int aiTexcoord[2] = { NotSet, NotSet };
     PLY::EDataType aiTexcoordTypes[2] = { EDT_Char, EDT_Char };
 
-    // now check whether which normal components are available
-    unsigned int _a(0), cnt(0);
-    for (std::vector<PLY::Property>::const_iterator a = pcElement->alProperties.begin();
-            a != pcElement->alProperties.end(); ++a, ++_a) {
-        if ((*a).bIsList) {
-            continue;
-        }
-
-        // Positions
-        if (PLY::EST_XCoord == (*a).Semantic) {
-            ++cnt;
-            aiPositions[0] = _a;
-            aiTypes[0] = (*a).eType;
-        } else if (PLY::EST_YCoord == (*a).Semantic) {
-            ++cnt;
-            aiPositions[1] = _a;
-            aiTypes[1] = (*a).eType;
-        } else if (PLY::EST_ZCoord == (*a).Semantic) {
-            ++cnt;
-            aiPositions[2] = _a;
-            aiTypes[2] = (*a).eType;
-        } else if (PLY::EST_XNormal == (*a).Semantic) {
-            // Normals
-            ++cnt;
-            aiNormal[0] = _a;
-            aiNormalTypes[0] = (*a).eType;
-        } else if (PLY::EST_YNormal == (*a).Semantic) {
-            ++cnt;
-            aiNormal[1] = _a;
-            aiNormalTypes[1] = (*a).eType;
-        } else if (PLY::EST_ZNormal == (*a).Semantic) {
-            ++cnt;
-            aiNormal[2] = _a;
-            aiNormalTypes[2] = (*a).eType;
-        } else if (PLY::EST_Red == (*a).Semantic) {
-            // Colors
-            ++cnt;
-            aiColors[0] = _a;
-            aiColorsTypes[0] = (*a).eType;
-        } else if (PLY::EST_Green == (*a).Semantic) {
-            ++cnt;
-            aiColors[1] = _a;
-            aiColorsTypes[1] = (*a).eType;
-        } else if (PLY::EST_Blue == (*a).Semantic) {
-            ++cnt;
-            aiColors[2] = _a;
-            aiColorsTypes[2] = (*a).eType;
-        } else if (PLY::EST_Alpha == (*a).Semantic) {
-            ++cnt;
-            aiColors[3] = _a;
-            aiColorsTypes[3] = (*a).eType;
-        } else if (PLY::EST_UTextureCoord == (*a).Semantic) {
-            // Texture coordinates
-            ++cnt;
-            aiTexcoord[0] = _a;
-            aiTexcoordTypes[0] = (*a).eType;
-        } else if (PLY::EST_VTextureCoord == (*a).Semantic) {
-            ++cnt;
-            aiTexcoord[1] = _a;
-            aiTexcoordTypes[1] = (*a).eType;
+    // number of properties with a known semantic
+    unsigned int cnt = 0;
+
+    explicit VertexProperties(const PLY::Element *pcElement) {
+        // now check whether which normal components are available
+        unsigned int _a(0);
+        for (std::vector<PLY::Property>::const_iterator a = pcElement->alProperties.begin();
+                a != pcElement->alProperties.end(); ++a, ++_a) {
+            if ((*a).bIsList) {
+                continue;
+            }
+
+            // Positions
+            if (PLY::EST_XCoord == (*a).Semantic) {
+                ++cnt;
+                aiPositions[0] = _a;
+                aiTypes[0] = (*a).eType;
+            } else if (PLY::EST_YCoord == (*a).Semantic) {
+                ++cnt;
+                aiPositions[1] = _a;
+                aiTypes[1] = (*a).eType;
+            } else if (PLY::EST_ZCoord == (*a).Semantic) {
+                ++cnt;
+                aiPositions[2] = _a;
+                aiTypes[2] = (*a).eType;
+            } else if (PLY::EST_XNormal == (*a).Semantic) {
+                // Normals
+                ++cnt;
+                aiNormal[0] = _a;
+                aiNormalTypes[0] = (*a).eType;
+            } else if (PLY::EST_YNormal == (*a).Semantic) {
+                ++cnt;
+                aiNormal[1] = _a;
+                aiNormalTypes[1] = (*a).eType;
+            } else if (PLY::EST_ZNormal == (*a).Semantic) {
+                ++cnt;
+                aiNormal[2] = _a;
+                aiNormalTypes[2] = (*a).eType;
+            } else if (PLY::EST_Red == (*a).Semantic) {
+                // Colors
+                ++cnt;
+                aiColors[0] = _a;
+                aiColorsTypes[0] = (*a).eType;
+            } else if (PLY::EST_Green == (*a).Semantic) {
+                ++cnt;
+                aiColors[1] = _a;
+                aiColorsTypes[1] = (*a).eType;
+            } else if (PLY::EST_Blue == (*a).Semantic) {
+                ++cnt;
+                aiColors[2] = _a;
+                aiColorsTypes[2] = (*a).eType;
+            } else if (PLY::EST_Alpha == (*a).Semantic) {
+                ++cnt;
+                aiColors[3] = _a;
+                aiColorsTypes[3] = (*a).eType;
+            } else if (PLY::EST_UTextureCoord == (*a).Semantic) {
+                // Texture coordinates
+                ++cnt;
+                aiTexcoord[0] = _a;
+                aiTexcoordTypes[0] = (*a).eType;
+            } else if (PLY::EST_VTextureCoord == (*a).Semantic) {
+                ++cnt;
+                aiTexcoord[1] = _a;
+                aiTexcoordTypes[1] = (*a).eType;
+            }
         }
     }
+};
+
+} // namespace
+
+void PLYImporter::LoadVertex(const PLY::Element *pcElement, const PLY::ElementInstance *instElement, unsigned int pos) {
+    ai_assert(nullptr != pcElement);
+    ai_assert(nullptr != instElement);
+
+    const VertexProperties props(pcElement);
 
     // check whether we have a valid source for the vertex data
-    if (0 != cnt) {
+    if (0 != props.cnt) {
         // Position
         aiVector3D vOut;
-        if (NotSet != aiPositions[0]) {
+        if (NotSet != props.aiPositions[0]) {
             vOut.x = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiPositions[0]).avList.front(), aiTypes[0]);
+                    GetProperty(instElement->alProperties, props.aiPositions[0]).avList.front(), props.aiTypes[0]);
         }
 
-        if (NotSet != aiPositions[1]) {
+        if (NotSet != props.aiPositions[1]) {
             vOut.y = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiPositions[1]).avList.front(), aiTypes[1]);
+                    GetProperty(instElement->alProperties, props.aiPositions[1]).avList.front(), props.aiTypes[1]);
         }
 
-        if (NotSet != aiPositions[2]) {
+        if (NotSet != props.aiPositions[2]) {
             vOut.z = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiPositions[2]).avList.front(), aiTypes[2]);
+                    GetProperty(instElement->alProperties, props.aiPositions[2]).avList.front(), props.aiTypes[2]);
         }
 
         // Normals
         aiVector3D nOut;
         bool haveNormal = false;
-        if (NotSet != aiNormal[0]) {
+        if (NotSet != props.aiNormal[0]) {
             nOut.x = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiNormal[0]).avList.front(), aiNormalTypes[0]);
+                    GetProperty(instElement->alProperties, props.aiNormal[0]).avList.front(), props.aiNormalTypes[0]);
             haveNormal = true;
         }
 
-        if (NotSet != aiNormal[1]) {
+        if (NotSet != props.aiNormal[1]) {
             nOut.y = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiNormal[1]).avList.front(), aiNormalTypes[1]);
+                    GetProperty(instElement->alProperties, props.aiNormal[1]).avList.front(), props.aiNormalTypes[1]);
             haveNormal = true;
         }
 
-        if (NotSet != aiNormal[2]) {
+        if (NotSet != props.aiNormal[2]) {
             nOut.z = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiNormal[2]).avList.front(), aiNormalTypes[2]);
+                    GetProperty(instElement->alProperties, props.aiNormal[2]).avList.front(), props.aiNormalTypes[2]);
             haveNormal = true;
         }
 
         // Colors
         aiColor4D cOut;
         bool haveColor = false;
-        if (NotSet != aiColors[0]) {
+        if (NotSet != props.aiColors[0]) {
             cOut.r = NormalizeColorValue(GetProperty(instElement->alProperties,
-                                                 aiColors[0])
+                                                 props.aiColors[0])
                                                  .avList.front(),
-                    aiColorsTypes[0]);
+                    props.aiColorsTypes[0]);
             haveColor = true;
         }
 
-        if (NotSet != aiColors[1]) {
+        if (NotSet != props.aiColors[1]) {
             cOut.g = NormalizeColorValue(GetProperty(instElement->alProperties,
-                                                 aiColors[1])
+                                                 props.aiColors[1])
                                                  .avList.front(),
-                    aiColorsTypes[1]);
+                    props.aiColorsTypes[1]);
             haveColor = true;
         }
 
-        if (NotSet != aiColors[2]) {
+        if (NotSet != props.aiColors[2]) {
             cOut.b = NormalizeColorValue(GetProperty(instElement->alProperties,
-                                                 aiColors[2])
+                                                 props.aiColors[2])
                                                  .avList.front(),
-                    aiColorsTypes[2]);
+                    props.aiColorsTypes[2]);
             haveColor = true;
         }
 
         // assume 1.0 for the alpha channel if it is not set
-        if (NotSet == aiColors[3]) {
+        if (NotSet == props.aiColors[3]) {
             cOut.a = 1.0;
         } else {
             cOut.a = NormalizeColorValue(GetProperty(instElement->alProperties,
-                                                 aiColors[3])
+                                                 props.aiColors[3])
                                                  .avList.front(),
-                    aiColorsTypes[3]);
+                    props.aiColorsTypes[3]);
 
             haveColor = true;
         }
@@ -426,15 +451,15 @@ void PLYImporter::LoadVertex(const PLY::Element *pcElement, const PLY::ElementIn
         aiVector3D tOut;
         tOut.z = 0;
         bool haveTextureCoords = false;
-        if (NotSet != aiTexcoord[0]) {
+        if (NotSet != props.aiTexcoord[0]) {
             tOut.x = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiTexcoord[0]).avList.front(), aiTexcoordTypes[0]);
+                    GetProperty(instElement->alProperties, props.aiTexcoord[0]).avList.front(), props.aiTexcoordTypes[0]);
             haveTextureCoords = true;
         }
 
-        if (NotSet != aiTexcoord[1]) {
+        if (NotSet != props.aiTexcoord[1]) {
             tOut.y = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiTexcoord[1]).avList.front(), aiTexcoordTypes[1]);
+                    GetProperty(instElement->alProperties, props.aiTexcoord[1]).avList.front(), props.aiTexcoordTypes[1]);
             haveTextureCoords = true;
         }
 
@@ -476,6 +501,85 @@ void PLYImporter::LoadVertex(const PLY::Element *pcElement, const PLY::ElementIn
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Extract a block of vertices property by property, same results as LoadVertex()
+void PLYImporter::LoadVertices(const PLY::Element *pcElement, const PLY::ElementBlock &block, const char *data,
+        unsigned int first, unsigned int count, bool p_bBE) {
+    ai_assert(nullptr != pcElement);
+    ai_assert(nullptr != data);
+
+    const VertexProperties props(pcElement);
+    if (0 == props.cnt) {
+        return;
+    }
+
+    // create aiMesh if needed
+    if (nullptr == mGeneratedMesh) {
+        mGeneratedMesh = new aiMesh();
+        mGeneratedMesh->mMaterialIndex = 0;
+    }
+
+    if (nullptr == mGeneratedMesh->mVertices) {
+        mGeneratedMesh->mNumVertices = pcElement->NumOccur;
+        mGeneratedMesh->mVertices = new aiVector3D[mGeneratedMesh->mNumVertices];
+    }
+    const unsigned int numVertices = mGeneratedMesh->mNumVertices;
+    if (first >= numVertices || count > numVertices - first) {
+        throw DeadlyImportError("Invalid .ply file: Too many vertices");
+    }
+
+    // Position
+    for (unsigned int c = 0; c < 3; ++c) {
+        if (NotSet != props.aiPositions[c]) {
+            block.Decode(data, count, props.aiPositions[c], p_bBE, &mGeneratedMesh->mVertices[first].x + c, 3);
+        }
+    }
+
+    // Normals
+    for (unsigned int c = 0; c < 3; ++c) {
+        if (NotSet != props.aiNormal[c]) {
+            if (nullptr == mGeneratedMesh->mNormals) {
+                mGeneratedMesh->mNormals = new aiVector3D[numVertices];
+            }
+            block.Decode(data, count, props.aiNormal[c], p_bBE, &mGeneratedMesh->mNormals[first].x + c, 3);
+        }
+    }
+
+    // Colors, they need to be normalized per type
+    bool haveColor = false;
+    for (unsigned int c = 0; c < 4; ++c) {
+        haveColor = haveColor || NotSet != props.aiColors[c];
+    }
+    if (haveColor) {
+        if (nullptr == mGeneratedMesh->mColors[0]) {
+            mGeneratedMesh->mColors[0] = new aiColor4D[numVertices];
+        }
+        aiColor4D *cOut = mGeneratedMesh->mColors[0] + first;
+        for (unsigned int i = 0; i < count; ++i, ++cOut) {
+            const char *inst = data + static_cast<size_t>(i) * block.Stride;
+            for (unsigned int c = 0; c < 4; ++c) {
+                if (NotSet != props.aiColors[c]) {
+                    (*cOut)[c] = NormalizeColorValue(block.GetValue(inst, props.aiColors[c], p_bBE), props.aiColorsTypes[c]);
+                } else {
+                    // assume 1.0 for the alpha channel if it is not set
+                    (*cOut)[c] = 3 == c ? 1.0f : 0.0f;
+                }
+            }
+        }
+    }
+
+    // Texture coordinates
+    for (unsigned int c = 0; c < 2; ++c) {
+        if (NotSet != props.aiTexcoord[c]) {
+            if (nullptr == mGeneratedMesh->mTextureCoords[0]) {
+                mGeneratedMesh->mNumUVComponents[0] = 2;
+                mGeneratedMesh->mTextureCoords[0] = new aiVector3D[numVertices];
+            }
+            block.Decode(data, count, props.aiTexcoord[c], p_bBE, &mGeneratedMesh->mTextureCoords[0][first].x + c, 3);
+        }
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 // Convert a color component to [0...1]
 ai_real PLYImporter::NormalizeColorValue(PLY::PropertyInstance::ValueUnion val, PLY::EDataType eType) {
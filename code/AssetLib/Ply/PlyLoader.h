@@ -74,11 +74,25 @@ public:
     bool CanRead(const std::string &pFile, IOSystem *pIOHandler,
             bool checkSig) const override;
 
+    // -------------------------------------------------------------------
+    /** Called prior to ReadFile().
+     * The function is a request to the importer to update its configuration
+     * basing on the Importer's configuration property list.
+     */
+    void SetupProperties(const Importer *pImp) override;
+
     // -------------------------------------------------------------------
     /** Extract a vertex from the DOM
     */
     void LoadVertex(const PLY::Element *pcElement, const PLY::ElementInstance *instElement, unsigned int pos);
 
+    // -------------------------------------------------------------------
+    /** Extract count vertices starting at first from a block of raw binary
+     *  instances of an element without list properties
+    */
+    void LoadVertices(const PLY::Element *pcElement, const PLY::ElementBlock &block, const char *data,
+            unsigned int first, unsigned int count, bool p_bBE);
+
     // -------------------------------------------------------------------
     /** Extract a face from the DOM
     */
@@ -124,6 +138,9 @@ private:
     unsigned char *mBuffer;
     PLY::DOM *pcDOM;
     aiMesh *mGeneratedMesh;
+    //! Block size and number of blocks read ahead, see AI_CONFIG_IMPORT_STREAM_BLOCK_SIZE
+    size_t mBlockSize;
+    size_t mPrefetchBlocks;
 };
 
 } // end of namespace Assimp
@@ -47,6 +47,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/ByteSwapper.h>
 #include <assimp/fast_atof.h>
 #include <assimp/DefaultLogger.hpp>
+#include <algorithm>
+#include <limits>
 #include <unordered_set>
 #include <utility>
 
@@ -533,10 +535,17 @@ bool PLY::DOM::ParseInstanceBinary(IOStreamBuffer<char> &streamBuffer, DOM *p_pc
         return false;
     }
 
-    streamBuffer.getNextBlock(buffer);
-
-    unsigned int bufferSize = static_cast<unsigned int>(buffer.size());
-    const char *pCur = (char *)&buffer[0];
+    // parse the body straight from the stream's memory if it provides it
+    const char *pCur = nullptr;
+    size_t viewSize = 0;
+    unsigned int bufferSize = 0;
+    if (streamBuffer.size() <= std::numeric_limits<unsigned int>::max() && streamBuffer.getRemainingView(pCur, viewSize)) {
+        bufferSize = static_cast<unsigned int>(viewSize);
+    } else {
+        streamBuffer.getNextBlock(buffer);
+        bufferSize = static_cast<unsigned int>(buffer.size());
+        pCur = (char *)&buffer[0];
+    }
     if (!p_pcOut->ParseElementInstanceListsBinary(streamBuffer, buffer, pCur, bufferSize, loader, p_bBE)) {
         ASSIMP_LOG_VERBOSE_DEBUG("PLY::DOM::ParseInstanceBinary() failure");
         return false;
@@ -614,6 +623,7 @@ bool PLY::ElementInstanceList::ParseInstanceList(
 
             streamBuffer.getNextLine(buffer);
             pCur = (buffer.empty()) ? nullptr : (const char *)&buffer[0];
+            end = (buffer.empty()) ? nullptr : pCur + buffer.size();
         }
     }
     return true;
@@ -631,6 +641,14 @@ bool PLY::ElementInstanceList::ParseInstanceListBinary(
         bool p_bBE /* = false */) {
     ai_assert(nullptr != pcElement);
 
+    // vertices without list properties are decoded column by column
+    if (nullptr == p_pcOut && pcElement->eSemantic == EEST_Vertex) {
+        PLY::ElementBlock block;
+        if (block.Setup(pcElement)) {
+            return block.ParseVerticesBinary(streamBuffer, buffer, pCur, bufferSize, pcElement, loader, p_bBE);
+        }
+    }
+
     // we can add special handling code for unknown element semantics since
     // we can't skip it as a whole block (we don't know its exact size
     // due to the fact that lists could be contained in the property list
@@ -658,6 +676,201 @@ bool PLY::ElementInstanceList::ParseInstanceListBinary(
     return true;
 }
 
+// ------------------------------------------------------------------------------------------------
+namespace {
+
+// Size of a binary value in bytes, 0 for invalid types
+unsigned int GetTypeSize(PLY::EDataType eType) {
+    switch (eType) {
+    case EDT_Char:
+    case EDT_UChar:
+        return 1;
+    case EDT_UShort:
+    case EDT_Short:
+        return 2;
+    case EDT_UInt:
+    case EDT_Int:
+    case EDT_Float:
+        return 4;
+    case EDT_Double:
+        return 8;
+    default:
+        break;
+    }
+    return 0;
+}
+
+template <typename T>
+inline T ReadBinaryValue(const char *data, bool p_bBE) {
+    T t;
+    memcpy(&t, data, sizeof(T));
+    if (p_bBE) {
+        ByteSwap::Swap(&t);
+    }
+    return t;
+}
+
+template <>
+inline int8_t ReadBinaryValue<int8_t>(const char *data, bool) {
+    return static_cast<int8_t>(*data);
+}
+
+template <>
+inline uint8_t ReadBinaryValue<uint8_t>(const char *data, bool) {
+    return static_cast<uint8_t>(*data);
+}
+
+// Decode a strided column of values of type T. The byte order check is
+// hoisted out of the loops, they are simple enough to be unrolled.
+template <typename T>
+void DecodeColumn(const char *data, unsigned int stride, unsigned int count, bool p_bBE,
+        ai_real *out, unsigned int outStride) {
+    if (p_bBE) {
+        for (unsigned int i = 0; i < count; ++i, data += stride, out += outStride) {
+            *out = static_cast<ai_real>(ReadBinaryValue<T>(data, true));
+        }
+    } else {
+        for (unsigned int i = 0; i < count; ++i, data += stride, out += outStride) {
+            *out = static_cast<ai_real>(ReadBinaryValue<T>(data, false));
+        }
+    }
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+bool PLY::ElementBlock::Setup(const PLY::Element *pcElement) {
+    ai_assert(nullptr != pcElement);
+
+    Stride = 0;
+    Offsets.clear();
+    Types.clear();
+    for (const PLY::Property &prop : pcElement->alProperties) {
+        const unsigned int size = GetTypeSize(prop.eType);
+        if (prop.bIsList || 0 == size) {
+            return false;
+        }
+        Offsets.push_back(Stride);
+        Types.push_back(prop.eType);
+        Stride += size;
+    }
+    return 0 != Stride;
+}
+
+// ------------------------------------------------------------------------------------------------
+void PLY::ElementBlock::Decode(const char *data, unsigned int count, unsigned int prop, bool p_bBE,
+        ai_real *out, unsigned int outStride) const {
+    ai_assert(prop < Offsets.size());
+
+    data += Offsets[prop];
+    switch (Types[prop]) {
+    case EDT_UInt:
+        DecodeColumn<uint32_t>(data, Stride, count, p_bBE, out, outStride);
+        break;
+    case EDT_UShort:
+        DecodeColumn<uint16_t>(data, Stride, count, p_bBE, out, outStride);
+        break;
+    case EDT_UChar:
+        DecodeColumn<uint8_t>(data, Stride, count, p_bBE, out, outStride);
+        break;
+    case EDT_Int:
+        DecodeColumn<int32_t>(data, Stride, count, p_bBE, out, outStride);
+        break;
+    case EDT_Short:
+        DecodeColumn<int16_t>(data, Stride, count, p_bBE, out, outStride);
+        break;
+    case EDT_Char:
+        DecodeColumn<int8_t>(data, Stride, count, p_bBE, out, outStride);
+        break;
+    case EDT_Float:
+        DecodeColumn<float>(data, Stride, count, p_bBE, out, outStride);
+        break;
+    case EDT_Double:
+        DecodeColumn<double>(data, Stride, count, p_bBE, out, outStride);
+        break;
+    default:
+        break;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+PLY::PropertyInstance::ValueUnion PLY::ElementBlock::GetValue(const char *data, unsigned int prop, bool p_bBE) const {
+    ai_assert(prop < Offsets.size());
+
+    data += Offsets[prop];
+    PLY::PropertyInstance::ValueUnion out;
+    switch (Types[prop]) {
+    case EDT_UInt:
+        out.iUInt = ReadBinaryValue<uint32_t>(data, p_bBE);
+        break;
+    case EDT_UShort:
+        out.iUInt = ReadBinaryValue<uint16_t>(data, p_bBE);
+        break;
+    case EDT_UChar:
+        out.iUInt = ReadBinaryValue<uint8_t>(data, p_bBE);
+        break;
+    case EDT_Int:
+        out.iInt = ReadBinaryValue<int32_t>(data, p_bBE);
+        break;
+    case EDT_Short:
+        out.iInt = ReadBinaryValue<int16_t>(data, p_bBE);
+        break;
+    case EDT_Char:
+        out.iInt = ReadBinaryValue<int8_t>(data, p_bBE);
+        break;
+    case EDT_Float:
+        out.fFloat = ReadBinaryValue<float>(data, p_bBE);
+        break;
+    case EDT_Double:
+        out.fDouble = ReadBinaryValue<double>(data, p_bBE);
+        break;
+    default:
+        out.iUInt = 0;
+        break;
+    }
+    return out;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool PLY::ElementBlock::ParseVerticesBinary(
+        IOStreamBuffer<char> &streamBuffer,
+        std::vector<char> &buffer,
+        const char *&pCur,
+        unsigned int &bufferSize,
+        const PLY::Element *pcElement,
+        PLYImporter *loader,
+        bool p_bBE) const {
+    ai_assert(nullptr != pcElement);
+    ai_assert(nullptr != loader);
+    ai_assert(0 != Stride);
+
+    ASSIMP_LOG_DEBUG("PLY: decoding ", pcElement->NumOccur, " binary vertices column by column");
+    unsigned int i = 0;
+    while (i < pcElement->NumOccur) {
+        // hand all complete instances in the buffer to the loader at once
+        const unsigned int count = std::min(bufferSize / Stride, pcElement->NumOccur - i);
+        if (0 != count) {
+            loader->LoadVertices(pcElement, *this, pCur, i, count, p_bBE);
+            pCur += static_cast<size_t>(count) * Stride;
+            bufferSize -= count * Stride;
+            i += count;
+            continue;
+        }
+
+        // an instance spans the end of the buffer, append the next file block
+        std::vector<char> nbuffer;
+        if (!streamBuffer.getNextBlock(nbuffer)) {
+            throw DeadlyImportError("Invalid .ply file: File corrupted");
+        }
+        std::vector<char> rest(pCur, pCur + bufferSize);
+        rest.insert(rest.end(), nbuffer.begin(), nbuffer.end());
+        buffer.swap(rest);
+        bufferSize = static_cast<unsigned int>(buffer.size());
+        pCur = buffer.data();
+    }
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 bool PLY::ElementInstance::ParseInstance(const char *&pCur, const char *end,
         const PLY::Element *pcElement,
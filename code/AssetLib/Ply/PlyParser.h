@@ -396,6 +396,52 @@ public:
     static bool ParseInstanceListBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
         const char* &pCur, unsigned int &bufferSize, const Element* pcElement, ElementInstanceList* p_pcOut, PLYImporter* loader, bool p_bBE);
 };
+
+// ---------------------------------------------------------------------------------
+/** \brief Columnar view on the instances of a binary element
+ *
+ * If an element has no list properties all of its instances have the same
+ * size. They are handed to the loader in blocks of raw instances then, and
+ * each property is decoded for the whole block at once, instead of building
+ * an ElementInstance for every instance.
+ */
+class ElementBlock
+{
+public:
+
+    //! Default constructor
+    ElementBlock() AI_NO_EXCEPT = default;
+
+    //! Size of one instance, in bytes
+    unsigned int Stride = 0;
+
+    //! Byte offset of each property within an instance
+    std::vector<unsigned int> Offsets;
+
+    //! Data type of each property
+    std::vector<EDataType> Types;
+
+    // -------------------------------------------------------------------
+    //! Compute the layout of an element. Returns false if the element
+    //! has list properties, it must be parsed by instance then.
+    bool Setup(const Element* pcElement);
+
+    // -------------------------------------------------------------------
+    //! Decode a property of count instances starting at data. The values
+    //! are converted like PropertyInstance::ConvertTo<ai_real>() does and
+    //! written to out, outStride values apart.
+    void Decode(const char* data, unsigned int count, unsigned int prop, bool p_bBE,
+        ai_real* out, unsigned int outStride) const;
+
+    // -------------------------------------------------------------------
+    //! Read a single property value of the instance starting at data
+    PropertyInstance::ValueUnion GetValue(const char* data, unsigned int prop, bool p_bBE) const;
+
+    // -------------------------------------------------------------------
+    //! Parse all instances of a binary vertex element, in blocks
+    bool ParseVerticesBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char* &pCur, unsigned int &bufferSize, const Element* pcElement, PLYImporter* loader, bool p_bBE) const;
+};
 // ---------------------------------------------------------------------------------
 /** \brief Class to represent the document object model of an ASCII or binary
  * (both little and big-endian) PLY file
@@ -47,8 +47,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "STEPFileReader.h"
 #include "STEPFileEncoding.h"
+#include "Common/ThreadPool.h"
 #include <assimp/TinyFormatter.h>
 #include <assimp/fast_atof.h>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <utility>
@@ -95,6 +97,7 @@ STEP::DB* STEP::ReadFileHeader(std::shared_ptr<IOStream> stream) {
         const std::string& s = *splitter;
         if (s == "DATA;") {
             // here we go, header done, start of data section
+            db->data_begin = reinterpret_cast<const char*>(reader->GetPtr());
             ++splitter;
             break;
         }
@@ -158,26 +161,119 @@ bool IsEntityDef(const std::string& snext)
     return false;
 }
 
+// ------------------------------------------------------------------------------------------------
+// check whether the line starting at the given position contains an entity definition,
+// same as IsEntityDef() but without having to copy the line first
+bool IsEntityDefAt(const char* cur, const char* end)
+{
+    if (cur == end || *cur != '#') {
+        return false;
+    }
+    for (++cur; cur != end; ++cur) {
+        if (*cur == '=') {
+            return true;
+        }
+        if ((*cur < '0' || *cur > '9') && *cur != ' ') {
+            break;
+        }
+    }
+    return false;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Splits the text of a STEP DATA section into lines, exactly like the LineSplitter used
+// by the DB does, but stops at the end of a chunk of the section.
+class ChunkLineSplitter {
+public:
+    ChunkLineSplitter(const char* begin, const char* chunk_end, const char* end)
+    : mLineStart(begin), mCur(begin), mChunkEnd(chunk_end), mEnd(end) {
+        operator++();
+        mIdx = 0;
+    }
+
+    ChunkLineSplitter& operator++() {
+        mLine.clear();
+        mLineStart = mCur;
+        while (mCur != mEnd) {
+            const char s = *mCur++;
+            if (s == '\n' || s == '\r') {
+                char c;
+                while (mCur != mEnd && ((c = *mCur++) == ' ' || c == '\r' || c == '\n'));
+                if (mCur != mEnd) {
+                    --mCur;
+                }
+                break;
+            }
+            mLine += s;
+        }
+        ++mIdx;
+        return *this;
+    }
+
+    const std::string& operator*() const {
+        return mLine;
+    }
+
+    // a line beyond the chunk belongs to the next one
+    operator bool() const {
+        return mLineStart < mChunkEnd && mCur != mEnd;
+    }
+
+    size_t get_index() const {
+        return mIdx;
+    }
+
+private:
+    std::string mLine;
+    const char* mLineStart;
+    const char* mCur;
+    const char* const mChunkEnd;
+    const char* const mEnd;
+    size_t mIdx = 0;
+};
 
 // ------------------------------------------------------------------------------------------------
-void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
-    const char* const* types_to_track, size_t len,
-    const char* const* inverse_indices_to_track, size_t len2)
+// Returns the start of the first entity definition line at or after pos, the split points
+// for scanning a DATA section in parallel. Records never span such a line.
+const char* FindEntityDefLine(const char* pos, const char* end)
 {
-    db.SetSchema(scheme);
-    db.SetTypesToTrack(types_to_track,len);
-    db.SetInverseIndicesToTrack(inverse_indices_to_track,len2);
+    while (pos != end) {
+        const char* nl = pos;
+        while (nl != end && *nl != '\n' && *nl != '\r') {
+            ++nl;
+        }
+        while (nl != end && (*nl == ' ' || *nl == '\r' || *nl == '\n')) {
+            ++nl;
+        }
+        if (IsEntityDefAt(nl, end)) {
+            return nl;
+        }
+        pos = nl;
+    }
+    return end;
+}
 
-    const DB::ObjectMap& map = db.GetObjects();
-    LineSplitter& splitter = db.GetSplitter();
+// ------------------------------------------------------------------------------------------------
+// One record or warning found while scanning a chunk of the DATA section.
+struct ScannedRecord {
+    uint64_t id; // 0 for warnings
+    uint64_t line;
+    const char* type; // warning text for warnings, nullptr for unknown types
+    std::unique_ptr<char[]> args;
+};
 
+// ------------------------------------------------------------------------------------------------
+// Scans entity records "#id=TYPE(args);" from the DATA section, calls on_warning(text, line)
+// for malformed lines and on_record(id, line, type, args) for every record, with type being
+// nullptr if the scheme doesn't know it. Returns true if the end of the section was found.
+template <typename Splitter, typename OnWarning, typename OnRecord>
+bool ScanRecords(Splitter& splitter, const EXPRESS::ConversionSchema& scheme, OnWarning on_warning, OnRecord on_record)
+{
     while (splitter) {
         bool has_next = false;
         std::string s = *splitter;
         if (s == "ENDSEC;") {
-            break;
+            return true;
         }
         s.erase(std::remove(s.begin(), s.end(), ' '), s.end());
 
@@ -186,7 +282,7 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
         // LineSplitter already ignores empty lines
         ai_assert(s.length());
         if (s[0] != '#') {
-            ASSIMP_LOG_WARN(AddLineNumber("expected token \'#\'",line));
+            on_warning("expected token \'#\'",line);
             ++splitter;
             continue;
         }
@@ -196,14 +292,14 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
         // ---
         const std::string::size_type n0 = s.find_first_of('=');
         if (n0 == std::string::npos) {
-            ASSIMP_LOG_WARN(AddLineNumber("expected token \'=\'",line));
+            on_warning("expected token \'=\'",line);
             ++splitter;
             continue;
         }
 
         const uint64_t id = strtoul10_64(s.substr(1,n0-1).c_str());
         if (!id) {
-            ASSIMP_LOG_WARN(AddLineNumber("expected positive, numeric entity id",line));
+            on_warning("expected positive, numeric entity id",line);
             ++splitter;
             continue;
         }
@@ -230,7 +326,7 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
             }
 
             if(!ok) {
-                ASSIMP_LOG_WARN(AddLineNumber("expected token \'(\'",line));
+                on_warning("expected token \'(\'",line);
                 continue;
             }
         }
@@ -256,15 +352,11 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
                 }
             }
             if(!ok) {
-                ASSIMP_LOG_WARN(AddLineNumber("expected token \')\'",line));
+                on_warning("expected token \')\'",line);
                 continue;
             }
         }
 
-        if (map.find(id) != map.end()) {
-            ASSIMP_LOG_WARN(AddLineNumber((Formatter::format(),"an object with the id #",id," already exists"),line));
-        }
-
         std::string::size_type ns = n0;
         do {
             ++ns;
@@ -276,19 +368,131 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
         std::string type = s.substr(ns, ne - ns + 1);
         type = ai_tolower(type);
         const char* sz = scheme.GetStaticStringForToken(type);
+        std::unique_ptr<char[]> copysz;
         if(sz) {
             const std::string::size_type szLen = n2-n1+1;
-            char* const copysz = new char[szLen+1];
-            std::copy(s.c_str()+n1,s.c_str()+n2+1,copysz);
+            copysz.reset(new char[szLen+1]);
+            std::copy(s.c_str()+n1,s.c_str()+n2+1,copysz.get());
             copysz[szLen] = '\0';
-            db.InternInsert(new LazyObject(db,id,line,sz,copysz));
         }
+        on_record(id,line,sz,std::move(copysz));
         if(!has_next) {
             ++splitter;
         }
     }
+    return false;
+}
+
+// DATA sections smaller than this are always read by a single thread
+constexpr size_t ParallelSectionMinSize = 1 << 21;
+// approximate size of the chunks scanned in parallel
+constexpr size_t ParallelChunkSize = 1 << 20;
+
+}
+
+
+// ------------------------------------------------------------------------------------------------
+void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
+    const char* const* types_to_track, size_t len,
+    const char* const* inverse_indices_to_track, size_t len2,
+    unsigned int numThreads /*= 1*/)
+{
+    db.SetSchema(scheme);
+    db.SetTypesToTrack(types_to_track,len);
+    db.SetInverseIndicesToTrack(inverse_indices_to_track,len2);
+
+    const DB::ObjectMap& map = db.GetObjects();
+    LineSplitter& splitter = db.GetSplitter();
+
+    const auto warn = [](const char* text, uint64_t line) {
+        ASSIMP_LOG_WARN(AddLineNumber(text,line));
+    };
+    // objects are always created here, in file order, as they register
+    // their references with the DB
+    const auto insert = [&db,&map](uint64_t id, uint64_t line, const char* type, std::unique_ptr<char[]> args) {
+        if (map.find(id) != map.end()) {
+            ASSIMP_LOG_WARN(AddLineNumber((Formatter::format(),"an object with the id #",id," already exists"),line));
+        }
+        if (type) {
+            db.InternInsert(new LazyObject(db,id,line,type,args.release()));
+        }
+    };
+
+    StreamReaderLE& stream = splitter.get_stream();
+    const char* const end = reinterpret_cast<const char*>(stream.GetPtr()) + stream.GetRemainingSize();
+    const char* const begin = db.data_begin;
+
+    bool found_end = false;
+    if (numThreads == 1 || !splitter || !begin || static_cast<size_t>(end - begin) < ParallelSectionMinSize) {
+        found_end = ScanRecords(splitter,scheme,warn,insert);
+    }
+    else {
+        // split the section at entity definitions, the records in between can
+        // be tokenized independently of each other.
+        std::vector<const char*> bounds(1,begin);
+        while (static_cast<size_t>(end - bounds.back()) > ParallelChunkSize) {
+            const char* const next = FindEntityDefLine(bounds.back() + ParallelChunkSize, end);
+            if (next == end) {
+                break;
+            }
+            bounds.push_back(next);
+        }
+        bounds.push_back(end);
+
+        const size_t num_chunks = bounds.size() - 1;
+        std::vector<std::vector<ScannedRecord>> records(num_chunks);
+        std::vector<size_t> line_counts(num_chunks);
+        std::vector<char> chunk_found_end(num_chunks);
+
+        ThreadPool pool(numThreads);
+        ASSIMP_LOG_DEBUG("STEP: scanning ",num_chunks," chunks of the DATA section in parallel on ",pool.GetNumThreads()," threads");
+        pool.ParallelFor(num_chunks, [&](size_t i) {
+            ChunkLineSplitter chunk(bounds[i],bounds[i+1],end);
+            std::vector<ScannedRecord>& out = records[i];
+            out.reserve(static_cast<size_t>(bounds[i+1] - bounds[i]) / 64);
+
+            chunk_found_end[i] = ScanRecords(chunk,scheme,
+                [&out](const char* text, uint64_t line) {
+                    out.push_back(ScannedRecord{0,line,text,nullptr});
+                },
+                [&out](uint64_t id, uint64_t line, const char* type, std::unique_ptr<char[]> args) {
+                    out.push_back(ScannedRecord{id,line,type,std::move(args)});
+                });
+            line_counts[i] = chunk.get_index();
+        });
+
+        size_t total = 0;
+        for (const std::vector<ScannedRecord>& chunk : records) {
+            total += chunk.size();
+        }
+#ifdef ASSIMP_STEP_USE_UNORDERED_MULTIMAP
+        db.objects.reserve(db.objects.size() + total);
+#endif
+
+        // the line numbers of each chunk start at the first line of the chunk,
+        // which is also the last line seen by the previous chunk.
+        uint64_t line_base = splitter.get_index();
+        for (size_t i = 0; i < num_chunks; ++i) {
+            for (ScannedRecord& rec : records[i]) {
+                if (!rec.id) {
+                    warn(rec.type,line_base+rec.line);
+                }
+                else {
+                    insert(rec.id,line_base+rec.line,rec.type,std::move(rec.args));
+                }
+            }
+            records[i].clear();
+            records[i].shrink_to_fit();
+
+            if (chunk_found_end[i]) {
+                found_end = true;
+                break;
+            }
+            line_base += line_counts[i];
+        }
+    }
 
-    if (!splitter) {
+    if (!found_end) {
         ASSIMP_LOG_WARN("STEP: ignoring unexpected EOF");
     }
 
@@ -514,11 +718,8 @@ STEP::LazyObject::LazyObject(DB& db, uint64_t id,uint64_t /*line*/, const char*
 // ------------------------------------------------------------------------------------------------
 STEP::LazyObject::~LazyObject() {
     // make sure the right dtor/operator delete get called
-    if (obj) {
-        delete obj;
-    } else {
-        delete[] args;
-    }
+    delete obj.load();
+    delete[] args;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -533,20 +734,29 @@ void STEP::LazyObject::LazyInit() const {
     const char* acopy = args;
     const char *end = acopy + std::strlen(args);
     std::shared_ptr<const EXPRESS::LIST> conv_args = EXPRESS::LIST::Parse(acopy, end, (uint64_t)STEP::SyntaxError::LINE_NOT_SPECIFIED,&db.GetSchema());
-    delete[] args;
-    args = nullptr;
+    if (!db.concurrent_evaluation) {
+        delete[] args;
+        args = nullptr;
+    }
 
     // if the converter fails, it should throw an exception, but it should never return nullptr
+    Object* o = nullptr;
     try {
-        obj = proc(db,*conv_args);
+        o = proc(db,*conv_args);
     }
     catch(const TypeError& t) {
         // augment line and entity information
         throw TypeError(t.what(),id);
     }
+    ai_assert(o);
+
+    // store the original id in the object instance, then publish it. Another
+    // thread may have evaluated the same object meanwhile, its instance wins.
+    o->SetID(id);
+    Object* expected = nullptr;
+    if (!obj.compare_exchange_strong(expected, o)) {
+        delete o;
+        return;
+    }
     ++db.evaluated_count;
-    ai_assert(obj);
-
-    // store the original id in the object instance
-    obj->SetID(id);
 }
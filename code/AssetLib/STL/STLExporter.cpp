@@ -59,40 +59,26 @@ void ExportSceneSTL(const char* pFile,IOSystem* pIOSystem, const aiScene* pScene
 {
     bool exportPointClouds = pProperties->GetPropertyBool(AI_CONFIG_EXPORT_POINT_CLOUDS);
 
-    // invoke the exporter
-    STLExporter exporter(pFile, pScene, exportPointClouds );
-
-    if (exporter.mOutput.fail()) {
-        throw DeadlyExportError("output data creation failed. Most likely the file became too large: " + std::string(pFile));
-    }
-
-    // we're still here - export successfully completed. Write the file.
     std::unique_ptr<IOStream> outfile (pIOSystem->Open(pFile,"wt"));
     if (outfile == nullptr) {
         throw DeadlyExportError("could not open output .stl file: " + std::string(pFile));
     }
 
-    outfile->Write( exporter.mOutput.str().c_str(), static_cast<size_t>(exporter.mOutput.tellp()),1);
+    // invoke the exporter, it writes to the file directly
+    STLExporter exporter(pFile, pScene, outfile.get(), exportPointClouds);
 }
 
 void ExportSceneSTLBinary(const char* pFile,IOSystem* pIOSystem, const aiScene* pScene, const ExportProperties* pProperties )
 {
     bool exportPointClouds = pProperties->GetPropertyBool(AI_CONFIG_EXPORT_POINT_CLOUDS);
 
-    // invoke the exporter
-    STLExporter exporter(pFile, pScene, exportPointClouds, true);
-
-    if (exporter.mOutput.fail()) {
-        throw DeadlyExportError("output data creation failed. Most likely the file became too large: " + std::string(pFile));
-    }
-
-    // we're still here - export successfully completed. Write the file.
     std::unique_ptr<IOStream> outfile (pIOSystem->Open(pFile,"wb"));
     if (outfile == nullptr) {
         throw DeadlyExportError("could not open output .stl file: " + std::string(pFile));
     }
 
-    outfile->Write( exporter.mOutput.str().c_str(), static_cast<size_t>(exporter.mOutput.tellp()),1);
+    // invoke the exporter, it writes to the file directly
+    STLExporter exporter(pFile, pScene, outfile.get(), exportPointClouds, true);
 }
 
 } // end of namespace Assimp
@@ -101,12 +87,9 @@ static constexpr char SolidToken[]    = "solid";
 static constexpr char EndSolidToken[] = "endsolid";
 
 // ------------------------------------------------------------------------------------------------
-STLExporter::STLExporter(const char* _filename, const aiScene* pScene, bool exportPointClouds, bool binary) : filename(_filename) , endl("\n")
+STLExporter::STLExporter(const char* _filename, const aiScene* pScene, IOStream* pStream, bool exportPointClouds, bool binary) :
+        mOutput(pStream), filename(_filename) , endl("\n")
 {
-    // make sure that all formatting happens using the standard, C locale and not the user's current locale
-    const std::locale& l = std::locale("C");
-    mOutput.imbue(l);
-    mOutput.precision(ASSIMP_AI_REAL_TEXT_PRECISION);
     if (binary) {
         char buf[80] = {0} ;
         buf[0] = 'A'; buf[1] = 's'; buf[2] = 's'; buf[3] = 'i'; buf[4] = 'm'; buf[5] = 'p';
@@ -133,6 +116,7 @@ STLExporter::STLExporter(const char* _filename, const aiScene* pScene, bool expo
         // Exporting only point clouds
         if (exportPointClouds) {
             WritePointCloud("Assimp_Pointcloud", pScene );
+            mOutput.flush();
             return;
         }
 
@@ -144,6 +128,7 @@ STLExporter::STLExporter(const char* _filename, const aiScene* pScene, bool expo
         }
         mOutput << EndSolidToken << " " << name << endl;
     }
+    mOutput.flush();
 }
 
 // ------------------------------------------------------------------------------------------------
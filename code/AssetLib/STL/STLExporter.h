@@ -46,7 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef AI_STLEXPORTER_H_INC
 #define AI_STLEXPORTER_H_INC
 
-#include <sstream>
+#include <assimp/BufferedTextWriter.h>
 
 struct aiScene;
 struct aiNode;
@@ -59,13 +59,13 @@ namespace Assimp {
 // ------------------------------------------------------------------------------------------------
 class STLExporter {
 public:
-    /// Constructor for a specific scene to export
-    STLExporter(const char *filename, const aiScene *pScene, bool exportPOintClouds, bool binary = false);
-
-    /// public string-streams to write all output into
-    std::ostringstream mOutput;
+    /// Constructor for a specific scene to export, writes it to the given stream
+    STLExporter(const char *filename, const aiScene *pScene, IOStream *pStream, bool exportPOintClouds, bool binary = false);
 
 private:
+    /// buffered writer for the output file
+    BufferedTextWriter mOutput;
+
     void WritePointCloud(const std::string &name, const aiScene *pScene);
     void WriteMesh(const aiMesh *m);
     void WriteMeshBinary(const aiMesh *m);
@@ -44,6 +44,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ASSIMP_BUILD_NO_STL_IMPORTER
 
 #include "STLLoader.h"
+#include "Common/ScenePrivate.h"
 #include <assimp/ParsingUtils.h>
 #include <assimp/fast_atof.h>
 #include <assimp/importerdesc.h>
@@ -121,6 +122,18 @@ static bool IsAsciiSTL(const char *buffer, size_t fileSize) {
     }
     return isASCII;
 }
+
+// Reads the three coordinates of a normal or vertex, plain numbers in one go
+static const char *ReadVector(const char *sz, const char *bufferEnd, aiVector3D &v) {
+    ai_real values[3];
+    size_t numRead = fast_atoreal_array(sz, bufferEnd, values, 3);
+    for (; numRead < 3; ++numRead) {
+        SkipSpaces(&sz, bufferEnd);
+        sz = fast_atoreal_move(sz, values[numRead]);
+    }
+    v.Set(values[0], values[1], values[2]);
+    return sz;
+}
 } // namespace
 
 // ------------------------------------------------------------------------------------------------
@@ -148,12 +161,12 @@ const aiImporterDesc *STLImporter::GetInfo() const {
     return &desc;
 }
 
-void addFacesToMesh(aiMesh *pMesh) {
-    pMesh->mFaces = new aiFace[pMesh->mNumFaces];
+void addFacesToMesh(aiScene *pScene, aiMesh *pMesh, bool contiguous) {
+    unsigned int *arena = contiguous ? AllocateArenaFaceIndices(pScene, pMesh->mNumFaces * 3) : nullptr;
+    pMesh->AllocateFaces(pMesh->mNumFaces, 3, contiguous, arena);
     for (unsigned int i = 0, p = 0; i < pMesh->mNumFaces; ++i) {
 
         aiFace &face = pMesh->mFaces[i];
-        face.mIndices = new unsigned int[face.mNumIndices = 3];
         for (unsigned int o = 0; o < 3; ++o, ++p) {
             face.mIndices[o] = p;
         }
@@ -172,13 +185,17 @@ void STLImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 
     mFileSize = file->FileSize();
 
+    // binary files are read in place if the stream provides its memory, otherwise
     // allocate storage and copy the contents of the file to a memory buffer
     // (terminate it with zero)
     std::vector<char> buffer2;
-    TextFileToBuffer(file.get(), buffer2);
+    mBuffer = reinterpret_cast<const char *>(file->GetMemoryView());
+    if (nullptr == mBuffer || !IsBinarySTL(mBuffer, mFileSize)) {
+        TextFileToBuffer(file.get(), buffer2);
+        mBuffer = &buffer2[0];
+    }
 
     mScene = pScene;
-    mBuffer = &buffer2[0];
 
     // the default vertex color is light gray.
     mClrColorDefault.r = mClrColorDefault.g = mClrColorDefault.b = mClrColorDefault.a = 0.6f;
@@ -293,12 +310,7 @@ void STLImporter::LoadASCIIFile(aiNode *root) {
                     }
                     aiVector3D vn;
                     sz += 7;
-                    SkipSpaces(&sz, bufferEnd);
-                    sz = fast_atoreal_move(sz, vn.x);
-                    SkipSpaces(&sz, bufferEnd);
-                    sz = fast_atoreal_move(sz, vn.y);
-                    SkipSpaces(&sz, bufferEnd);
-                    sz = fast_atoreal_move(sz, vn.z);
+                    sz = ReadVector(sz, bufferEnd, vn);
                     normalBuffer.emplace_back(vn);
                     normalBuffer.emplace_back(vn);
                     normalBuffer.emplace_back(vn);
@@ -312,14 +324,8 @@ void STLImporter::LoadASCIIFile(aiNode *root) {
                         throw DeadlyImportError("STL: unexpected EOF while parsing facet");
                     }
                     sz += 7;
-                    SkipSpaces(&sz, bufferEnd);
                     positionBuffer.emplace_back();
-                    aiVector3D *vn = &positionBuffer.back();
-                    sz = fast_atoreal_move(sz, vn->x);
-                    SkipSpaces(&sz, bufferEnd);
-                    sz = fast_atoreal_move(sz, vn->y);
-                    SkipSpaces(&sz, bufferEnd);
-                    sz = fast_atoreal_move(sz, vn->z);
+                    sz = ReadVector(sz, bufferEnd, positionBuffer.back());
                     faceVertexCounter++;
                 }
             } else if (!::strncmp(sz, "endsolid", 8)) {
@@ -375,7 +381,7 @@ void STLImporter::LoadASCIIFile(aiNode *root) {
         }
 
         // now copy faces
-        addFacesToMesh(pMesh);
+        addFacesToMesh(mScene, pMesh, contiguousFaceIndices);
 
         // assign the meshes to the current node
         pushMeshesToNode(meshIndices, node);
@@ -529,7 +535,7 @@ bool STLImporter::LoadBinaryFile() {
     }
 
     // now copy faces
-    addFacesToMesh(pMesh);
+    addFacesToMesh(mScene, pMesh, contiguousFaceIndices);
 
     aiNode *root = mScene->mRootNode;
 
@@ -42,6 +42,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef INCLUDED_AI_STEPFILE_H
 #define INCLUDED_AI_STEPFILE_H
 
+#include <atomic>
 #include <bitset>
 #include <map>
 #include <memory>
@@ -575,7 +576,7 @@ private:
     const char *const type;
     DB &db;
     mutable const char *args;
-    mutable Object *obj;
+    mutable std::atomic<Object *> obj;
 };
 
 template <typename T>
@@ -747,14 +748,15 @@ class DB {
     friend DB *ReadFileHeader(std::shared_ptr<IOStream> stream);
     friend void ReadFile(DB &db, const EXPRESS::ConversionSchema &scheme,
             const char *const *types_to_track, size_t len,
-            const char *const *inverse_indices_to_track, size_t len2);
+            const char *const *inverse_indices_to_track, size_t len2,
+            unsigned int numThreads);
 
     friend class LazyObject;
 
 public:
     // objects indexed by ID - this can grow pretty large (i.e some hundred million
     // entries), so use raw pointers to avoid *any* overhead.
-    typedef std::map<uint64_t, const LazyObject *> ObjectMap;
+    typedef std::step_unordered_map<uint64_t, const LazyObject *> ObjectMap;
 
     // objects indexed by their declarative type, but only for those that we truly want
     typedef std::set<const LazyObject *> ObjectSet;
@@ -772,7 +774,7 @@ public:
 
 private:
     DB(const std::shared_ptr<StreamReaderLE> &reader) :
-            reader(reader), splitter(*reader, true, true), evaluated_count(), schema(nullptr) {}
+            reader(reader), splitter(*reader, true, true), data_begin(nullptr), evaluated_count(0), schema(nullptr), concurrent_evaluation(false) {}
 
 public:
     ~DB() {
@@ -793,6 +795,12 @@ public:
         return header;
     }
 
+    // allow objects to be evaluated from several threads at once. Their argument
+    // strings are kept until the DB is destroyed then, not released on evaluation.
+    void SetConcurrentEvaluation(bool concurrent) {
+        concurrent_evaluation = concurrent;
+    }
+
     const EXPRESS::ConversionSchema &GetSchema() const {
         return *schema;
     }
@@ -911,8 +919,11 @@ private:
     InverseWhitelist inv_whitelist;
     std::shared_ptr<StreamReaderLE> reader;
     LineSplitter splitter;
-    uint64_t evaluated_count;
+    // first line of the DATA section, set by ReadFileHeader()
+    const char *data_begin;
+    std::atomic<uint64_t> evaluated_count;
     const EXPRESS::ConversionSchema *schema;
+    bool concurrent_evaluation;
 };
 
 #ifdef _MSC_VER
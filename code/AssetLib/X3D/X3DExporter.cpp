@@ -16,6 +16,24 @@
 
 using namespace std;
 
+namespace {
+
+// Appends a real number, formatted independent of the current locale.
+template <typename T>
+void AppendReal(std::string &pTarget, const T pValue) {
+    char buffer[Assimp::BufferedTextWriter::MaxNumberLength];
+    pTarget.append(buffer, Assimp::BufferedTextWriter::format(buffer, pValue));
+}
+
+template <typename T>
+std::string RealToString(const T pValue) {
+    std::string str;
+    AppendReal(str, pValue);
+    return str;
+}
+
+} // namespace
+
 namespace Assimp {
 
 void ExportSceneX3D(const char *pFile, IOSystem *pIOSystem, const aiScene *pScene, const ExportProperties *pProperties) {
@@ -38,8 +56,7 @@ void X3DExporter::IndentationStringSet(const size_t pNewLevel) {
 }
 
 void X3DExporter::XML_Write(const string &pData) {
-    if (pData.size() == 0) return;
-    if (mOutFile->Write((void *)pData.data(), pData.length(), 1) != 1) throw DeadlyExportError("Failed to write scene data!");
+    mOutput << pData;
 }
 
 aiMatrix4x4 X3DExporter::Matrix_GlobalToCurrent(const aiNode &pNode) const {
@@ -65,64 +82,85 @@ aiMatrix4x4 X3DExporter::Matrix_GlobalToCurrent(const aiNode &pNode) const {
 }
 
 void X3DExporter::AttrHelper_FloatToString(const float pValue, std::string &pTargetString) {
-    pTargetString = to_string(pValue);
-    AttrHelper_CommaToPoint(pTargetString);
+    pTargetString = RealToString(pValue);
 }
 
 void X3DExporter::AttrHelper_Vec3DArrToString(const aiVector3D *pArray, const size_t pArray_Size, string &pTargetString) {
     pTargetString.clear();
     pTargetString.reserve(pArray_Size * 6); // (Number + space) * 3.
-    for (size_t idx = 0; idx < pArray_Size; idx++)
-        pTargetString.append(to_string(pArray[idx].x) + " " + to_string(pArray[idx].y) + " " + to_string(pArray[idx].z) + " ");
+    for (size_t idx = 0; idx < pArray_Size; idx++) {
+        AppendReal(pTargetString, pArray[idx].x);
+        pTargetString.push_back(' ');
+        AppendReal(pTargetString, pArray[idx].y);
+        pTargetString.push_back(' ');
+        AppendReal(pTargetString, pArray[idx].z);
+        pTargetString.push_back(' ');
+    }
 
     // remove last space symbol.
     pTargetString.resize(pTargetString.length() - 1);
-    AttrHelper_CommaToPoint(pTargetString);
 }
 
 void X3DExporter::AttrHelper_Vec2DArrToString(const aiVector2D *pArray, const size_t pArray_Size, std::string &pTargetString) {
     pTargetString.clear();
     pTargetString.reserve(pArray_Size * 4); // (Number + space) * 2.
-    for (size_t idx = 0; idx < pArray_Size; idx++)
-        pTargetString.append(to_string(pArray[idx].x) + " " + to_string(pArray[idx].y) + " ");
+    for (size_t idx = 0; idx < pArray_Size; idx++) {
+        AppendReal(pTargetString, pArray[idx].x);
+        pTargetString.push_back(' ');
+        AppendReal(pTargetString, pArray[idx].y);
+        pTargetString.push_back(' ');
+    }
 
     // remove last space symbol.
     pTargetString.resize(pTargetString.length() - 1);
-    AttrHelper_CommaToPoint(pTargetString);
 }
 
 void X3DExporter::AttrHelper_Vec3DAsVec2fArrToString(const aiVector3D *pArray, const size_t pArray_Size, string &pTargetString) {
     pTargetString.clear();
     pTargetString.reserve(pArray_Size * 4); // (Number + space) * 2.
-    for (size_t idx = 0; idx < pArray_Size; idx++)
-        pTargetString.append(to_string(pArray[idx].x) + " " + to_string(pArray[idx].y) + " ");
+    for (size_t idx = 0; idx < pArray_Size; idx++) {
+        AppendReal(pTargetString, pArray[idx].x);
+        pTargetString.push_back(' ');
+        AppendReal(pTargetString, pArray[idx].y);
+        pTargetString.push_back(' ');
+    }
 
     // remove last space symbol.
     pTargetString.resize(pTargetString.length() - 1);
-    AttrHelper_CommaToPoint(pTargetString);
 }
 
 void X3DExporter::AttrHelper_Col4DArrToString(const aiColor4D *pArray, const size_t pArray_Size, string &pTargetString) {
     pTargetString.clear();
     pTargetString.reserve(pArray_Size * 8); // (Number + space) * 4.
-    for (size_t idx = 0; idx < pArray_Size; idx++)
-        pTargetString.append(to_string(pArray[idx].r) + " " + to_string(pArray[idx].g) + " " + to_string(pArray[idx].b) + " " +
-                             to_string(pArray[idx].a) + " ");
+    for (size_t idx = 0; idx < pArray_Size; idx++) {
+        AppendReal(pTargetString, pArray[idx].r);
+        pTargetString.push_back(' ');
+        AppendReal(pTargetString, pArray[idx].g);
+        pTargetString.push_back(' ');
+        AppendReal(pTargetString, pArray[idx].b);
+        pTargetString.push_back(' ');
+        AppendReal(pTargetString, pArray[idx].a);
+        pTargetString.push_back(' ');
+    }
 
     // remove last space symbol.
     pTargetString.resize(pTargetString.length() - 1);
-    AttrHelper_CommaToPoint(pTargetString);
 }
 
 void X3DExporter::AttrHelper_Col3DArrToString(const aiColor3D *pArray, const size_t pArray_Size, std::string &pTargetString) {
     pTargetString.clear();
     pTargetString.reserve(pArray_Size * 6); // (Number + space) * 3.
-    for (size_t idx = 0; idx < pArray_Size; idx++)
-        pTargetString.append(to_string(pArray[idx].r) + " " + to_string(pArray[idx].g) + " " + to_string(pArray[idx].b) + " ");
+    for (size_t idx = 0; idx < pArray_Size; idx++) {
+        AppendReal(pTargetString, pArray[idx].r);
+        pTargetString.push_back(' ');
+        AppendReal(pTargetString, pArray[idx].g);
+        pTargetString.push_back(' ');
+        AppendReal(pTargetString, pArray[idx].b);
+        pTargetString.push_back(' ');
+    }
 
     // remove last space symbol.
     pTargetString.resize(pTargetString.length() - 1);
-    AttrHelper_CommaToPoint(pTargetString);
 }
 
 void X3DExporter::AttrHelper_Color3ToAttrList(std::list<SAttribute> &pList, const std::string &pName, const aiColor3D &pValue, const aiColor3D &pDefaultValue) {
@@ -148,10 +186,10 @@ void X3DExporter::NodeHelper_OpenNode(const string &pNodeName, const size_t pTab
     IndentationStringSet(pTabLevel);
     XML_Write(mIndentationString);
     // Begin of the element
-    XML_Write("<" + pNodeName);
+    mOutput << '<' << pNodeName;
     // Write attributes
     for (const SAttribute &attr : pAttrList) {
-        XML_Write(" " + attr.Name + "='" + attr.Value + "'");
+        mOutput << ' ' << attr.Name << "='" << attr.Value << '\'';
     }
 
     // End of the element
@@ -173,7 +211,7 @@ void X3DExporter::NodeHelper_CloseNode(const string &pNodeName, const size_t pTa
     IndentationStringSet(pTabLevel);
     XML_Write(mIndentationString);
     // Write element
-    XML_Write("</" + pNodeName + ">\n");
+    mOutput << "</" << pNodeName << ">\n";
 }
 
 void X3DExporter::Export_Node(const aiNode *pNode, const size_t pTabLevel) {
@@ -190,20 +228,12 @@ void X3DExporter::Export_Node(const aiNode *pNode, const size_t pTabLevel) {
 
     // Check if need <Transformation> node against <Group>.
     if (!pNode->mTransformation.IsIdentity()) {
-        auto Vector2String = [this](const aiVector3D pVector) -> string {
-            string tstr = to_string(pVector.x) + " " + to_string(pVector.y) + " " + to_string(pVector.z);
-
-            AttrHelper_CommaToPoint(tstr);
-
-            return tstr;
+        auto Vector2String = [](const aiVector3D pVector) -> string {
+            return RealToString(pVector.x) + " " + RealToString(pVector.y) + " " + RealToString(pVector.z);
         };
 
-        auto Rotation2String = [this](const aiVector3D pAxis, const ai_real pAngle) -> string {
-            string tstr = to_string(pAxis.x) + " " + to_string(pAxis.y) + " " + to_string(pAxis.z) + " " + to_string(pAngle);
-
-            AttrHelper_CommaToPoint(tstr);
-
-            return tstr;
+        auto Rotation2String = [](const aiVector3D pAxis, const ai_real pAngle) -> string {
+            return RealToString(pAxis.x) + " " + RealToString(pAxis.y) + " " + RealToString(pAxis.z) + " " + RealToString(pAngle);
         };
 
         aiVector3D scale, translate, rotate_axis;
@@ -529,7 +559,7 @@ void X3DExporter::Export_MetadataDouble(const aiString &pKey, const double pValu
     list<SAttribute> attr_list;
 
     attr_list.emplace_back( "name", pKey.C_Str() );
-    attr_list.emplace_back( "value", to_string(pValue) );
+    attr_list.emplace_back( "value", RealToString(pValue) );
     NodeHelper_OpenNode("MetadataDouble", pTabLevel, true, attr_list);
 }
 
@@ -537,7 +567,7 @@ void X3DExporter::Export_MetadataFloat(const aiString &pKey, const float pValue,
     list<SAttribute> attr_list;
 
     attr_list.emplace_back( "name", pKey.C_Str() );
-    attr_list.emplace_back( "value", to_string(pValue) );
+    attr_list.emplace_back( "value", RealToString(pValue) );
     NodeHelper_OpenNode("MetadataFloat", pTabLevel, true, attr_list);
 }
 
@@ -643,6 +673,7 @@ X3DExporter::X3DExporter(const char *pFileName, IOSystem *pIOSystem, const aiSce
 
     mOutFile = pIOSystem->Open(pFileName, "wt");
     if (mOutFile == nullptr) throw DeadlyExportError("Could not open output .x3d file: " + string(pFileName));
+    mOutput.setStream(mOutFile);
 
     // Begin document
     XML_Write("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
@@ -665,6 +696,7 @@ X3DExporter::X3DExporter(const char *pFileName, IOSystem *pIOSystem, const aiSce
     // Close Root node.
     NodeHelper_CloseNode("X3D", 0);
     // Cleanup
+    mOutput.flush();
     pIOSystem->Close(mOutFile);
     mOutFile = nullptr;
 }
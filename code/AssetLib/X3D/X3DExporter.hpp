@@ -12,6 +12,7 @@
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/Exporter.hpp>
+#include <assimp/BufferedTextWriter.h>
 
 // Header files, stdlib.
 #include <list>
@@ -71,6 +72,7 @@ class X3DExporter {
     /***********************************************/
 
     IOStream *mOutFile;
+    BufferedTextWriter mOutput;
     std::map<size_t, std::string> mDEF_Map_Mesh;
     std::map<size_t, std::string> mDEF_Map_Material;
 
@@ -97,15 +99,6 @@ private:
     /// \return calculated matrix.
     aiMatrix4x4 Matrix_GlobalToCurrent(const aiNode &pNode) const;
 
-    /// \fn void AttrHelper_CommaToPoint(std::string& pStringWithComma)
-    /// Convert commas in string to points. That's needed because "std::to_string" result depends on locale (regional settings).
-    /// \param [in, out] pStringWithComma - reference to string, which must be modified.
-    void AttrHelper_CommaToPoint(std::string &pStringWithComma) {
-        for (char &c : pStringWithComma) {
-            if (c == ',') c = '.';
-        }
-    }
-
     /// \fn void AttrHelper_FloatToString(const float pValue, std::string& pTargetString)
     /// Converts float to string.
     /// \param [in] pValue - value for converting.
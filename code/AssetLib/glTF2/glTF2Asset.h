@@ -500,6 +500,10 @@ public:
 
     bool LoadFromStream(IOStream &stream, size_t length = 0, size_t baseOffset = 0);
 
+    /// Same as above, but references the data in place if the stream provides its memory
+    /// (see IOStream::GetMemoryView()). The buffer keeps the stream alive in this case.
+    bool LoadFromStream(const shared_ptr<IOStream> &stream, size_t length = 0, size_t baseOffset = 0);
+
     /// \fn void EncodedRegion_Mark(const size_t pOffset, const size_t pEncodedData_Length, uint8_t* pDecodedData, const size_t pDecodedData_Length, const std::string& pID)
     /// Mark region of "bufferView" as encoded. When data is request from such region then "bufferView" use decoded data.
     /// \param [in] pOffset - offset from begin of "bufferView" to encoded region, in bytes.
@@ -607,6 +611,9 @@ struct Accessor : public Object {
             return GetValue<unsigned int>(i);
         }
 
+        //! Copies the first count values to out, same as calling GetUInt() for each of them
+        void GetUInts(size_t count, unsigned int *out);
+
         inline bool IsValid() const {
             return data != nullptr;
         }
@@ -924,6 +931,21 @@ struct Mesh : public Object {
     void Read(Value &pJSON_Object, Asset &pAsset_Root);
 };
 
+#ifdef ASSIMP_ENABLE_DRACO
+//! A Draco-compressed mesh primitive. They are gathered while the meshes are
+//! read and decoded together once the asset is loaded.
+struct DracoPrimitive {
+    std::string meshName;
+    unsigned int primitiveIndex = 0;
+    Mesh::Primitive *primitive = nullptr;
+    Ref<BufferView> bufferView;
+    std::vector<std::pair<Accessor *, uint32_t>> attributes; //!< The accessor and the Draco attribute id of each attribute
+
+    std::unique_ptr<Buffer> decodedIndices;
+    std::vector<std::unique_ptr<Buffer>> decodedAttributes;
+};
+#endif
+
 struct Node : public Object {
     std::vector<Ref<Node>> children;
     std::vector<Ref<Mesh>> meshes;
@@ -1128,6 +1150,7 @@ class Asset {
     template <class T>
     friend class LazyDict;
     friend struct Buffer; // To access OpenFile
+    friend struct Mesh; // To gather the Draco-compressed primitives
     friend class AssetWriter;
 
     std::vector<LazyDictBase *> mDicts;
@@ -1230,7 +1253,8 @@ public:
     }
 
     //! Main function
-    void Load(const std::string &file, bool isBinary = false);
+    //! \param numDracoThreads The number of threads decoding Draco-compressed primitives, 0 for the hardware threads
+    void Load(const std::string &file, bool isBinary = false, unsigned int numDracoThreads = 1);
 
     //! Parse the AssetMetadata and check that the version is 2.
     bool CanRead(const std::string &pFile, bool isBinary = false);
@@ -1259,6 +1283,10 @@ private:
 
     IOStream *OpenFile(const std::string &path, const char *mode, bool absolute = false);
 
+#ifdef ASSIMP_ENABLE_DRACO
+    void DecodeDracoPrimitives(unsigned int numThreads);
+#endif
+
 private:
     IOSystem *mIOSystem;
     rapidjson::IRemoteSchemaDocumentProvider *mSchemaDocumentProvider;
@@ -1268,6 +1296,9 @@ private:
     size_t mBodyLength;
     Ref<Buffer> mBodyBuffer;
     std::unordered_map<std::string, int> lastUsedID;
+#ifdef ASSIMP_ENABLE_DRACO
+    std::vector<DracoPrimitive> mDracoPrimitives;
+#endif
 };
 
 inline std::string getContextForErrorMessages(const std::string &id, const std::string &name) {
@@ -81,6 +81,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef DRACO_MESH_COMPRESSION_SUPPORTED
 #   error glTF: KHR_draco_mesh_compression: draco library must have DRACO_MESH_COMPRESSION_SUPPORTED
 #endif
+
+#include "Common/ThreadPool.h"
 #endif
 // clang-format on
 
@@ -280,12 +282,12 @@ inline void CopyFaceIndex_Draco(Buffer &decodedIndexBuffer, const draco::Mesh &d
     }
 }
 
-inline void SetDecodedIndexBuffer_Draco(const draco::Mesh &dracoMesh, Mesh::Primitive &prim) {
-    if (!prim.indices || dracoMesh.num_faces() == 0)
-        return;
+inline std::unique_ptr<Buffer> DecodeIndexBuffer_Draco(const draco::Mesh &dracoMesh, Accessor &indices) {
+    if (dracoMesh.num_faces() == 0)
+        return nullptr;
 
-    // Create a decoded Index buffer (if there is one)
-    size_t componentBytes = prim.indices->GetBytesPerComponent();
+    // Create a decoded Index buffer
+    size_t componentBytes = indices.GetBytesPerComponent();
 
     std::unique_ptr<Buffer> decodedIndexBuffer(new Buffer());
     decodedIndexBuffer->Grow(dracoMesh.num_faces() * 3 * componentBytes);
@@ -295,9 +297,7 @@ inline void SetDecodedIndexBuffer_Draco(const draco::Mesh &dracoMesh, Mesh::Prim
     // Usually uint32_t but shouldn't assume
     if (sizeof(dracoMesh.face(draco::FaceIndex(0))[0]) == componentBytes) {
         memcpy(decodedIndexBuffer->GetPointer(), &dracoMesh.face(draco::FaceIndex(0))[0], decodedIndexBuffer->byteLength);
-        // Assign this alternate data buffer to the accessor
-        prim.indices->decodedBuffer.swap(decodedIndexBuffer);
-        return;
+        return decodedIndexBuffer;
     }
 
     // Not same size, convert
@@ -316,8 +316,7 @@ inline void SetDecodedIndexBuffer_Draco(const draco::Mesh &dracoMesh, Mesh::Prim
         break;
     }
 
-    // Assign this alternate data buffer to the accessor
-    prim.indices->decodedBuffer.swap(decodedIndexBuffer);
+    return decodedIndexBuffer;
 }
 
 template <typename T>
@@ -339,7 +338,7 @@ static bool GetAttributeForAllPoints_Draco(const draco::Mesh &dracoMesh,
     return true;
 }
 
-inline void SetDecodedAttributeBuffer_Draco(const draco::Mesh &dracoMesh, uint32_t dracoAttribId, Accessor &accessor) {
+inline std::unique_ptr<Buffer> DecodeAttributeBuffer_Draco(const draco::Mesh &dracoMesh, uint32_t dracoAttribId, Accessor &accessor) {
     // Create decoded buffer
     const draco::PointAttribute *pDracoAttribute = dracoMesh.GetAttributeByUniqueId(dracoAttribId);
     if (pDracoAttribute == nullptr) {
@@ -375,8 +374,36 @@ inline void SetDecodedAttributeBuffer_Draco(const draco::Mesh &dracoMesh, uint32
         break;
     }
 
-    // Assign this alternate data buffer to the accessor
-    accessor.decodedBuffer.swap(decodedAttribBuffer);
+    return decodedAttribBuffer;
+}
+
+// Decodes a Draco-compressed primitive into buffers laid out like the accessors
+// of the primitive. Only reads the asset, so primitives can be decoded concurrently.
+inline void DecodePrimitive_Draco(DracoPrimitive &dracoPrim) {
+    BufferView &bufferView = *dracoPrim.bufferView;
+    const char *bufferViewData = reinterpret_cast<const char *>(bufferView.buffer->GetPointer() + bufferView.byteOffset);
+    draco::DecoderBuffer decoderBuffer;
+    decoderBuffer.Init(bufferViewData, bufferView.byteLength);
+    draco::Decoder decoder;
+    auto decodeResult = decoder.DecodeMeshFromBuffer(&decoderBuffer);
+    if (!decodeResult.ok()) {
+        // A corrupt Draco isn't actually fatal if the primitive data is also provided in a standard buffer, but does anyone do that?
+        throw DeadlyImportError("GLTF: Invalid Draco mesh compression in mesh: ", dracoPrim.meshName, " primitive: ", dracoPrim.primitiveIndex, ": ", decodeResult.status().error_msg_string());
+    }
+
+    // Now we have a draco mesh
+    const std::unique_ptr<draco::Mesh> &pDracoMesh = decodeResult.value();
+
+    // Indices
+    if (dracoPrim.primitive->indices) {
+        dracoPrim.decodedIndices = DecodeIndexBuffer_Draco(*pDracoMesh, *dracoPrim.primitive->indices);
+    }
+
+    // Vertex attributes
+    dracoPrim.decodedAttributes.resize(dracoPrim.attributes.size());
+    for (size_t i = 0; i < dracoPrim.attributes.size(); ++i) {
+        dracoPrim.decodedAttributes[i] = DecodeAttributeBuffer_Draco(*pDracoMesh, dracoPrim.attributes[i].second, *dracoPrim.attributes[i].first);
+    }
 }
 
 #endif // ASSIMP_ENABLE_DRACO
@@ -608,10 +635,9 @@ inline void Buffer::Read(Value &obj, Asset &r) {
         if (byteLength > 0) {
             std::string dir = !r.mCurrentAssetDir.empty() ? (r.mCurrentAssetDir.back() == '/' ? r.mCurrentAssetDir : r.mCurrentAssetDir + '/') : "";
 
-            IOStream *file = r.OpenFile(dir + uri, "rb");
+            shared_ptr<IOStream> file(r.OpenFile(dir + uri, "rb"));
             if (file) {
-                bool ok = LoadFromStream(*file, byteLength);
-                delete file;
+                bool ok = LoadFromStream(file, byteLength);
 
                 if (!ok)
                     throw DeadlyImportError("GLTF: error while reading referenced file \"", uri, "\"");
@@ -641,6 +667,25 @@ inline bool Buffer::LoadFromStream(IOStream &stream, size_t length, size_t baseO
     return true;
 }
 
+inline bool Buffer::LoadFromStream(const shared_ptr<IOStream> &stream, size_t length, size_t baseOffset) {
+    const uint8_t *view = stream->GetMemoryView();
+    if (nullptr == view) {
+        return LoadFromStream(*stream, length, baseOffset);
+    }
+
+    const size_t fileSize = stream->FileSize();
+    byteLength = length ? length : fileSize;
+
+    if (baseOffset > fileSize || byteLength > fileSize - baseOffset) {
+        throw DeadlyImportError("GLTF: Invalid byteLength exceeds size of actual data.");
+    }
+
+    // share ownership with the stream, so the memory stays valid as long as the buffer
+    mData = shared_ptr<uint8_t>(stream, const_cast<uint8_t *>(view + baseOffset));
+    ASSIMP_LOG_DEBUG("GLTF: buffer references ", byteLength, " bytes of stream memory at ", static_cast<const void *>(mData.get()));
+    return true;
+}
+
 inline void Buffer::EncodedRegion_Mark(const size_t pOffset, const size_t pEncodedData_Length, uint8_t *pDecodedData, const size_t pDecodedData_Length, const std::string &pID) {
     // Check pointer to data
     if (pDecodedData == nullptr) throw DeadlyImportError("GLTF: for marking encoded region pointer to decoded data must be provided.");
@@ -1117,6 +1162,47 @@ T Accessor::Indexer::GetValue(int i) {
     return value;
 }
 
+inline void Accessor::Indexer::GetUInts(size_t count, unsigned int *out) {
+    ai_assert(data);
+    if (0 == count) {
+        return;
+    }
+    // same range check as in GetValue(), but only for the last value
+    if ((count - 1) * stride >= accessor.GetMaxByteSize()) {
+        throw DeadlyImportError("GLTF: Invalid index ", count - 1, ", count out of range for buffer with stride ", stride, " and size ", accessor.GetMaxByteSize(), ".");
+    }
+
+    // Assume platform endianness matches GLTF binary data (which is little-endian).
+    switch (elemSize) {
+    case 1:
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = data[i * stride];
+        }
+        break;
+    case 2:
+        for (size_t i = 0; i < count; ++i) {
+            uint16_t value;
+            memcpy(&value, data + i * stride, sizeof(value));
+            out[i] = value;
+        }
+        break;
+    case 4:
+        if (stride == sizeof(unsigned int)) {
+            memcpy(out, data, count * sizeof(unsigned int));
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                memcpy(out + i, data + i * stride, sizeof(unsigned int));
+            }
+        }
+        break;
+    default:
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = GetValue<unsigned int>(static_cast<int>(i));
+        }
+        break;
+    }
+}
+
 inline Image::Image() :
         width(0),
         height(0),
@@ -1530,26 +1616,12 @@ inline void Mesh::Read(Value &pJSON_Object, Asset &pAsset_Root) {
                 // Skip if any missing
                 if (Value *dracoExt = FindExtension(primitive, "KHR_draco_mesh_compression")) {
                     if (Value *bufView = FindUInt(*dracoExt, "bufferView")) {
-                        // Attempt to load indices and attributes using draco compression
-                        auto bufferView = pAsset_Root.bufferViews.Retrieve(bufView->GetUint());
-                        // Attempt to perform the draco decode on the buffer data
-                        const char *bufferViewData = reinterpret_cast<const char *>(bufferView->buffer->GetPointer() + bufferView->byteOffset);
-                        draco::DecoderBuffer decoderBuffer;
-                        decoderBuffer.Init(bufferViewData, bufferView->byteLength);
-                        draco::Decoder decoder;
-                        auto decodeResult = decoder.DecodeMeshFromBuffer(&decoderBuffer);
-                        if (!decodeResult.ok()) {
-                            // A corrupt Draco isn't actually fatal if the primitive data is also provided in a standard buffer, but does anyone do that?
-                            throw DeadlyImportError("GLTF: Invalid Draco mesh compression in mesh: ", name, " primitive: ", i, ": ", decodeResult.status().error_msg_string());
-                        }
-
-                        // Now we have a draco mesh
-                        const std::unique_ptr<draco::Mesh> &pDracoMesh = decodeResult.value();
-
-                        // Redirect the accessors to the decoded data
-
-                        // Indices
-                        SetDecodedIndexBuffer_Draco(*pDracoMesh, prim);
+                        // The decoding is deferred until all meshes are read, see Asset::DecodeDracoPrimitives()
+                        DracoPrimitive dracoPrim;
+                        dracoPrim.meshName = name;
+                        dracoPrim.primitiveIndex = i;
+                        dracoPrim.primitive = &prim;
+                        dracoPrim.bufferView = pAsset_Root.bufferViews.Retrieve(bufView->GetUint());
 
                         // Vertex attributes
                         if (Value *attrs = FindObject(*dracoExt, "attributes")) {
@@ -1576,11 +1648,12 @@ inline void Mesh::Read(Value &pJSON_Object, Asset &pAsset_Root) {
                                         throw DeadlyImportError("GLTF: Invalid draco attribute in mesh: ", name, " primitive: ", i, " attrib: ", attr);
 
                                     // Redirect this accessor to the appropriate Draco vertex attribute data
-                                    const uint32_t dracoAttribId = it->value.GetUint();
-                                    SetDecodedAttributeBuffer_Draco(*pDracoMesh, dracoAttribId, attribAccessor);
+                                    dracoPrim.attributes.emplace_back(&attribAccessor, it->value.GetUint());
                                 }
                             }
                         }
+
+                        pAsset_Root.mDracoPrimitives.push_back(std::move(dracoPrim));
                     }
                 }
             }
@@ -2012,7 +2085,7 @@ inline rapidjson::Document Asset::ReadDocument(IOStream &stream, bool isBinary,
     return doc;
 }
 
-inline void Asset::Load(const std::string &pFile, bool isBinary)
+inline void Asset::Load(const std::string &pFile, bool isBinary, unsigned int numDracoThreads)
 {
     mCurrentAssetDir.clear();
     if (0 != strncmp(pFile.c_str(), AI_MEMORYIO_MAGIC_FILENAME, AI_MEMORYIO_MAGIC_FILENAME_LENGTH)) {
@@ -2045,7 +2118,7 @@ inline void Asset::Load(const std::string &pFile, bool isBinary)
 
     // Fill the buffer instance for the current file embedded contents
     if (mBodyLength > 0) {
-        if (!mBodyBuffer->LoadFromStream(*stream, mBodyLength, mBodyOffset)) {
+        if (!mBodyBuffer->LoadFromStream(stream, mBodyLength, mBodyOffset)) {
             throw DeadlyImportError("GLTF: Unable to read gltf file");
         }
     }
@@ -2101,12 +2174,45 @@ inline void Asset::Load(const std::string &pFile, bool isBinary)
         }
     }
 
+#ifdef ASSIMP_ENABLE_DRACO
+    DecodeDracoPrimitives(numDracoThreads);
+#else
+    (void)numDracoThreads;
+#endif
+
     // Clean up
     for (size_t i = 0; i < mDicts.size(); ++i) {
         mDicts[i]->DetachFromDocument();
     }
 }
 
+#ifdef ASSIMP_ENABLE_DRACO
+inline void Asset::DecodeDracoPrimitives(unsigned int numThreads) {
+    if (mDracoPrimitives.empty()) {
+        return;
+    }
+
+    Assimp::ThreadPool pool(std::min(numThreads ? numThreads : Assimp::ThreadPool::GetHardwareConcurrency(),
+            static_cast<unsigned int>(mDracoPrimitives.size())));
+    ASSIMP_LOG_DEBUG("GLTF: decoding ", mDracoPrimitives.size(), " Draco primitives on ", pool.GetNumThreads(), " threads");
+    pool.ParallelFor(mDracoPrimitives.size(), [this](size_t i) {
+        DecodePrimitive_Draco(mDracoPrimitives[i]);
+    });
+
+    // Redirect the accessors to the decoded data. This is done afterwards and in order,
+    // as primitives may share accessors.
+    for (DracoPrimitive &dracoPrim : mDracoPrimitives) {
+        if (dracoPrim.decodedIndices) {
+            dracoPrim.primitive->indices->decodedBuffer = std::move(dracoPrim.decodedIndices);
+        }
+        for (size_t i = 0; i < dracoPrim.attributes.size(); ++i) {
+            dracoPrim.attributes[i].first->decodedBuffer = std::move(dracoPrim.decodedAttributes[i]);
+        }
+    }
+    mDracoPrimitives.clear();
+}
+#endif
+
 inline bool Asset::CanRead(const std::string &pFile, bool isBinary) {
     try {
         shared_ptr<IOStream> stream(OpenFile(pFile.c_str(), "rb", true));
@@ -87,7 +87,7 @@ public:
 
     AssetWriter(Asset& asset);
 
-    void WriteFile(const char* path);
+    void WriteFile(const char* path, bool compact = false);
     void WriteGLBFile(const char* path);
 };
 
@@ -40,13 +40,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <assimp/Base64.hpp>
-#include <rapidjson/stringbuffer.h>
+#include <assimp/BufferedTextWriter.h>
 #include <rapidjson/writer.h>
 #include <rapidjson/prettywriter.h>
 
+#include <cmath>
+
 namespace glTF2 {
 
-    using rapidjson::StringBuffer;
+    using Assimp::BufferedTextWriter;
     using rapidjson::PrettyWriter;
     using rapidjson::Writer;
     using rapidjson::StringRef;
@@ -103,6 +105,56 @@ namespace glTF2 {
             obj.AddMember(StringRef(fieldId), lst, al);
         }
 
+        // rapidjson output stream which feeds a BufferedTextWriter,
+        // so the document is written to the file while it is serialized.
+        class JsonOutputStream {
+        public:
+            typedef char Ch;
+
+            explicit JsonOutputStream(BufferedTextWriter& out) : mOut(out) {}
+
+            void Put(Ch c) { mOut << c; }
+            void Flush() {} // the owner of the BufferedTextWriter flushes it
+
+        private:
+            BufferedTextWriter& mOut;
+        };
+
+        // All numbers in glTF are single precision, but rapidjson keeps them as
+        // double and writes 17 significant digits. Values which are exact floats
+        // are written with the shortest representation which reads back to the
+        // same float instead, e.g. 0.1 rather than 0.10000000149011612.
+        template<class BaseWriter>
+        class FloatWriter : public BaseWriter {
+        public:
+            explicit FloatWriter(JsonOutputStream& os) : BaseWriter(os) {}
+
+            bool Double(double d) {
+                const float f = static_cast<float>(d);
+                if (!std::isfinite(d) || static_cast<double>(f) != d) {
+                    return BaseWriter::Double(d);
+                }
+
+                char buffer[BufferedTextWriter::MaxNumberLength + 2];
+                size_t length = BufferedTextWriter::format(buffer, f);
+
+                // keep the value a real number for readers which care about the difference
+                if (std::find_if(buffer, buffer + length, [](char c) { return c == '.' || c == 'e'; }) == buffer + length) {
+                    buffer[length++] = '.';
+                    buffer[length++] = '0';
+                }
+                return BaseWriter::RawValue(buffer, length, rapidjson::kNumberType);
+            }
+        };
+
+        template<class BaseWriter>
+        inline void WriteDocument(Document& doc, BufferedTextWriter& out) {
+            JsonOutputStream os(out);
+            FloatWriter<BaseWriter> writer(os);
+            if (!doc.Accept(writer)) {
+                throw DeadlyExportError("Failed to write scene data!");
+            }
+        }
 
     }
 
@@ -849,7 +901,7 @@ namespace glTF2 {
         }
     }
 
-    inline void AssetWriter::WriteFile(const char* path)
+    inline void AssetWriter::WriteFile(const char* path, bool compact)
     {
         std::unique_ptr<IOStream> jsonOutFile(mAsset.OpenFile(path, "wt", true));
 
@@ -857,16 +909,13 @@ namespace glTF2 {
             throw DeadlyExportError("Could not open output file: " + std::string(path));
         }
 
-        StringBuffer docBuffer;
-
-        PrettyWriter<StringBuffer> writer(docBuffer);
-        if (!mDoc.Accept(writer)) {
-            throw DeadlyExportError("Failed to write scene data!");
-        }
-
-        if (jsonOutFile->Write(docBuffer.GetString(), docBuffer.GetSize(), 1) != 1) {
-            throw DeadlyExportError("Failed to write scene data!");
+        BufferedTextWriter out(jsonOutFile.get());
+        if (compact) {
+            WriteDocument<Writer<JsonOutputStream>>(mDoc, out);
+        } else {
+            WriteDocument<PrettyWriter<JsonOutputStream>>(mDoc, out);
         }
+        out.flush();
 
         // Write buffer data to separate .bin files
         for (unsigned int i = 0; i < mAsset.buffers.Size(); ++i) {
@@ -911,14 +960,18 @@ namespace glTF2 {
         // JSON chunk
         //
 
-        StringBuffer docBuffer;
-        Writer<StringBuffer> writer(docBuffer);
-        if (!mDoc.Accept(writer)) {
-            throw DeadlyExportError("Failed to write scene data!");
-        }
+        // The document is streamed behind the chunk header, which is
+        // written once the length of the document is known.
+        outfile->Seek(sizeof(GLB_Header) + sizeof(GLB_Chunk), aiOrigin_SET);
+
+        BufferedTextWriter out(outfile.get());
+        WriteDocument<Writer<JsonOutputStream>>(mDoc, out);
 
-        uint32_t jsonChunkLength = static_cast<uint32_t>((docBuffer.GetSize() + 3) & ~3); // Round up to next multiple of 4
-        auto paddingLength = jsonChunkLength - docBuffer.GetSize();
+        const size_t docLength = out.tell();
+        uint32_t jsonChunkLength = static_cast<uint32_t>((docLength + 3) & ~3); // Round up to next multiple of 4
+        auto paddingLength = jsonChunkLength - docLength;
+        out.write(reinterpret_cast<const char*>(&padding), paddingLength);
+        out.flush();
 
         GLB_Chunk jsonChunk;
         jsonChunk.chunkLength = jsonChunkLength;
@@ -929,12 +982,6 @@ namespace glTF2 {
         if (outfile->Write(&jsonChunk, 1, sizeof(GLB_Chunk)) != sizeof(GLB_Chunk)) {
             throw DeadlyExportError("Failed to write scene data header!");
         }
-        if (outfile->Write(docBuffer.GetString(), 1, docBuffer.GetSize()) != docBuffer.GetSize()) {
-            throw DeadlyExportError("Failed to write scene data!");
-        }
-        if (paddingLength && outfile->Write(&padding, 1, paddingLength) != paddingLength) {
-            throw DeadlyExportError("Failed to write scene data padding!");
-        }
 
         //
         // Binary chunk
@@ -131,7 +131,7 @@ glTF2Exporter::glTF2Exporter(const char *filename, IOSystem *pIOSystem, const ai
     if (isBinary) {
         writer.WriteGLBFile(filename);
     } else {
-        writer.WriteFile(filename);
+        writer.WriteFile(filename, mProperties->GetPropertyBool(AI_CONFIG_EXPORT_GLTF_COMPACT_JSON, false));
     }
 }
 
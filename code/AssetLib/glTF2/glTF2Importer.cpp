@@ -44,6 +44,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "glTF2Importer.h"
 #include "glTF2Asset.h"
 #include "PostProcessing/MakeVerboseFormat.h"
+#include "Common/ScenePrivate.h"
 
 #if !defined(ASSIMP_BUILD_NO_EXPORT)
 #   include "AssetLib/glTF2/glTF2AssetWriter.h"
@@ -409,35 +410,45 @@ void glTF2Importer::ImportMaterials(Asset &r) {
     }
 }
 
-static inline void SetFaceAndAdvance1(aiFace *&face, unsigned int numVertices, unsigned int a) {
+// Takes the indices from storage if it is set, see aiMesh::AllocateFaceIndexStorage()
+static inline unsigned int *AllocateFaceIndices(unsigned int *&storage, unsigned int numIndices) {
+    if (nullptr == storage) {
+        return new unsigned int[numIndices];
+    }
+    unsigned int *indices = storage;
+    storage += numIndices;
+    return indices;
+}
+
+static inline void SetFaceAndAdvance1(aiFace *&face, unsigned int *&storage, unsigned int numVertices, unsigned int a) {
     if (a >= numVertices) {
         return;
     }
     face->mNumIndices = 1;
-    face->mIndices = new unsigned int[1];
+    face->mIndices = AllocateFaceIndices(storage, 1);
     face->mIndices[0] = a;
     ++face;
 }
 
-static inline void SetFaceAndAdvance2(aiFace *&face, unsigned int numVertices,
+static inline void SetFaceAndAdvance2(aiFace *&face, unsigned int *&storage, unsigned int numVertices,
         unsigned int a, unsigned int b) {
     if ((a >= numVertices) || (b >= numVertices)) {
         return;
     }
     face->mNumIndices = 2;
-    face->mIndices = new unsigned int[2];
+    face->mIndices = AllocateFaceIndices(storage, 2);
     face->mIndices[0] = a;
     face->mIndices[1] = b;
     ++face;
 }
 
-static inline void SetFaceAndAdvance3(aiFace *&face, unsigned int numVertices, unsigned int a,
+static inline void SetFaceAndAdvance3(aiFace *&face, unsigned int *&storage, unsigned int numVertices, unsigned int a,
         unsigned int b, unsigned int c) {
     if ((a >= numVertices) || (b >= numVertices) || (c >= numVertices)) {
         return;
     }
     face->mNumIndices = 3;
-    face->mIndices = new unsigned int[3];
+    face->mIndices = AllocateFaceIndices(storage, 3);
     face->mIndices[0] = a;
     face->mIndices[1] = b;
     face->mIndices[2] = c;
@@ -525,9 +536,10 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
 
                 // Build the vertex remapping table and the modified index buffer (used later instead of the original one)
                 // In case no index buffer is used, the original vertex arrays are being used so no remapping is required in the first place.
+                data.GetUInts(count, indexBuffer.data());
                 const unsigned int unusedIndex = ~0u;
                 for (unsigned int i = 0; i < count; ++i) {
-                    unsigned int index = data.GetUInt(i);
+                    unsigned int index = indexBuffer[i];
                     if (index >= numAllVertices) {
                         // Out-of-range indices will be filtered out when adding the faces and then lead to a warning. At this stage, we just keep them.
                         indexBuffer[i] = index;
@@ -720,15 +732,24 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
             aiFace *facePtr = nullptr;
             size_t nFaces = 0;
 
+            // all faces of a primitive have the same number of indices
+            unsigned int *indexStorage = nullptr;
+            auto allocateFaces = [&](size_t numFaces, unsigned int numIndices) {
+                if (contiguousFaceIndices) {
+                    indexStorage = AllocateFaceIndexStorage(mScene, aim, static_cast<unsigned int>(numFaces * numIndices));
+                }
+                return new aiFace[numFaces];
+            };
+
             if (useIndexBuffer) {
                 size_t count = indexBuffer.size();
 
                 switch (prim.mode) {
                 case PrimitiveMode_POINTS: {
                     nFaces = count;
-                    facePtr = faces = new aiFace[nFaces];
+                    facePtr = faces = allocateFaces(nFaces, 1);
                     for (unsigned int i = 0; i < count; ++i) {
-                        SetFaceAndAdvance1(facePtr, aim->mNumVertices, indexBuffer[i]);
+                        SetFaceAndAdvance1(facePtr, indexStorage, aim->mNumVertices, indexBuffer[i]);
                     }
                     break;
                 }
@@ -739,9 +760,9 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                         ASSIMP_LOG_WARN("The number of vertices was not compatible with the LINES mode. Some vertices were dropped.");
                         count = nFaces * 2;
                     }
-                    facePtr = faces = new aiFace[nFaces];
+                    facePtr = faces = allocateFaces(nFaces, 2);
                     for (unsigned int i = 0; i < count; i += 2) {
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, indexBuffer[i], indexBuffer[i + 1]);
+                        SetFaceAndAdvance2(facePtr, indexStorage, aim->mNumVertices, indexBuffer[i], indexBuffer[i + 1]);
                     }
                     break;
                 }
@@ -749,13 +770,13 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                 case PrimitiveMode_LINE_LOOP:
                 case PrimitiveMode_LINE_STRIP: {
                     nFaces = count - ((prim.mode == PrimitiveMode_LINE_STRIP) ? 1 : 0);
-                    facePtr = faces = new aiFace[nFaces];
-                    SetFaceAndAdvance2(facePtr, aim->mNumVertices, indexBuffer[0], indexBuffer[1]);
+                    facePtr = faces = allocateFaces(nFaces, 2);
+                    SetFaceAndAdvance2(facePtr, indexStorage, aim->mNumVertices, indexBuffer[0], indexBuffer[1]);
                     for (unsigned int i = 2; i < count; ++i) {
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, indexBuffer[i - 1], indexBuffer[i]);
+                        SetFaceAndAdvance2(facePtr, indexStorage, aim->mNumVertices, indexBuffer[i - 1], indexBuffer[i]);
                     }
                     if (prim.mode == PrimitiveMode_LINE_LOOP) { // close the loop
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, indexBuffer[static_cast<int>(count) - 1], faces[0].mIndices[0]);
+                        SetFaceAndAdvance2(facePtr, indexStorage, aim->mNumVertices, indexBuffer[static_cast<int>(count) - 1], faces[0].mIndices[0]);
                     }
                     break;
                 }
@@ -766,33 +787,33 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                         ASSIMP_LOG_WARN("The number of vertices was not compatible with the TRIANGLES mode. Some vertices were dropped.");
                         count = nFaces * 3;
                     }
-                    facePtr = faces = new aiFace[nFaces];
+                    facePtr = faces = allocateFaces(nFaces, 3);
                     for (unsigned int i = 0; i < count; i += 3) {
-                        SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[i], indexBuffer[i + 1], indexBuffer[i + 2]);
+                        SetFaceAndAdvance3(facePtr, indexStorage, aim->mNumVertices, indexBuffer[i], indexBuffer[i + 1], indexBuffer[i + 2]);
                     }
                     break;
                 }
                 case PrimitiveMode_TRIANGLE_STRIP: {
                     nFaces = count - 2;
-                    facePtr = faces = new aiFace[nFaces];
+                    facePtr = faces = allocateFaces(nFaces, 3);
                     for (unsigned int i = 0; i < nFaces; ++i) {
                         // The ordering is to ensure that the triangles are all drawn with the same orientation
                         if ((i + 1) % 2 == 0) {
                             // For even n, vertices n + 1, n, and n + 2 define triangle n
-                            SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[i + 1], indexBuffer[i], indexBuffer[i + 2]);
+                            SetFaceAndAdvance3(facePtr, indexStorage, aim->mNumVertices, indexBuffer[i + 1], indexBuffer[i], indexBuffer[i + 2]);
                         } else {
                             // For odd n, vertices n, n+1, and n+2 define triangle n
-                            SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[i], indexBuffer[i + 1], indexBuffer[i + 2]);
+                            SetFaceAndAdvance3(facePtr, indexStorage, aim->mNumVertices, indexBuffer[i], indexBuffer[i + 1], indexBuffer[i + 2]);
                         }
                     }
                     break;
                 }
                 case PrimitiveMode_TRIANGLE_FAN:
                     nFaces = count - 2;
-                    facePtr = faces = new aiFace[nFaces];
-                    SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[0], indexBuffer[1], indexBuffer[2]);
+                    facePtr = faces = allocateFaces(nFaces, 3);
+                    SetFaceAndAdvance3(facePtr, indexStorage, aim->mNumVertices, indexBuffer[0], indexBuffer[1], indexBuffer[2]);
                     for (unsigned int i = 1; i < nFaces; ++i) {
-                        SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[0], indexBuffer[i + 1], indexBuffer[i + 2]);
+                        SetFaceAndAdvance3(facePtr, indexStorage, aim->mNumVertices, indexBuffer[0], indexBuffer[i + 1], indexBuffer[i + 2]);
                     }
                     break;
                 }
@@ -804,9 +825,9 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                 switch (prim.mode) {
                 case PrimitiveMode_POINTS: {
                     nFaces = count;
-                    facePtr = faces = new aiFace[nFaces];
+                    facePtr = faces = allocateFaces(nFaces, 1);
                     for (unsigned int i = 0; i < count; ++i) {
-                        SetFaceAndAdvance1(facePtr, aim->mNumVertices, i);
+                        SetFaceAndAdvance1(facePtr, indexStorage, aim->mNumVertices, i);
                     }
                     break;
                 }
@@ -817,9 +838,9 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                         ASSIMP_LOG_WARN("The number of vertices was not compatible with the LINES mode. Some vertices were dropped.");
                         count = (unsigned int)nFaces * 2;
                     }
-                    facePtr = faces = new aiFace[nFaces];
+                    facePtr = faces = allocateFaces(nFaces, 2);
                     for (unsigned int i = 0; i < count; i += 2) {
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, i, i + 1);
+                        SetFaceAndAdvance2(facePtr, indexStorage, aim->mNumVertices, i, i + 1);
                     }
                     break;
                 }
@@ -827,13 +848,13 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                 case PrimitiveMode_LINE_LOOP:
                 case PrimitiveMode_LINE_STRIP: {
                     nFaces = count - ((prim.mode == PrimitiveMode_LINE_STRIP) ? 1 : 0);
-                    facePtr = faces = new aiFace[nFaces];
-                    SetFaceAndAdvance2(facePtr, aim->mNumVertices, 0, 1);
+                    facePtr = faces = allocateFaces(nFaces, 2);
+                    SetFaceAndAdvance2(facePtr, indexStorage, aim->mNumVertices, 0, 1);
                     for (unsigned int i = 2; i < count; ++i) {
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, i - 1, i);
+                        SetFaceAndAdvance2(facePtr, indexStorage, aim->mNumVertices, i - 1, i);
                     }
                     if (prim.mode == PrimitiveMode_LINE_LOOP) { // close the loop
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, count - 1, 0);
+                        SetFaceAndAdvance2(facePtr, indexStorage, aim->mNumVertices, count - 1, 0);
                     }
                     break;
                 }
@@ -844,33 +865,33 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                         ASSIMP_LOG_WARN("The number of vertices was not compatible with the TRIANGLES mode. Some vertices were dropped.");
                         count = (unsigned int)nFaces * 3;
                     }
-                    facePtr = faces = new aiFace[nFaces];
+                    facePtr = faces = allocateFaces(nFaces, 3);
                     for (unsigned int i = 0; i < count; i += 3) {
-                        SetFaceAndAdvance3(facePtr, aim->mNumVertices, i, i + 1, i + 2);
+                        SetFaceAndAdvance3(facePtr, indexStorage, aim->mNumVertices, i, i + 1, i + 2);
                     }
                     break;
                 }
                 case PrimitiveMode_TRIANGLE_STRIP: {
                     nFaces = count - 2;
-                    facePtr = faces = new aiFace[nFaces];
+                    facePtr = faces = allocateFaces(nFaces, 3);
                     for (unsigned int i = 0; i < nFaces; ++i) {
                         // The ordering is to ensure that the triangles are all drawn with the same orientation
                         if ((i + 1) % 2 == 0) {
                             // For even n, vertices n + 1, n, and n + 2 define triangle n
-                            SetFaceAndAdvance3(facePtr, aim->mNumVertices, i + 1, i, i + 2);
+                            SetFaceAndAdvance3(facePtr, indexStorage, aim->mNumVertices, i + 1, i, i + 2);
                         } else {
                             // For odd n, vertices n, n+1, and n+2 define triangle n
-                            SetFaceAndAdvance3(facePtr, aim->mNumVertices, i, i + 1, i + 2);
+                            SetFaceAndAdvance3(facePtr, indexStorage, aim->mNumVertices, i, i + 1, i + 2);
                         }
                     }
                     break;
                 }
                 case PrimitiveMode_TRIANGLE_FAN:
                     nFaces = count - 2;
-                    facePtr = faces = new aiFace[nFaces];
-                    SetFaceAndAdvance3(facePtr, aim->mNumVertices, 0, 1, 2);
+                    facePtr = faces = allocateFaces(nFaces, 3);
+                    SetFaceAndAdvance3(facePtr, indexStorage, aim->mNumVertices, 0, 1, 2);
                     for (unsigned int i = 1; i < nFaces; ++i) {
-                        SetFaceAndAdvance3(facePtr, aim->mNumVertices, 0, i + 1, i + 2);
+                        SetFaceAndAdvance3(facePtr, indexStorage, aim->mNumVertices, 0, i + 1, i + 2);
                     }
                     break;
                 }
@@ -1717,7 +1738,8 @@ void glTF2Importer::InternReadFile(const std::string &pFile, aiScene *pScene, IO
     asset.Load(pFile,
                CheckMagicToken(
                    pIOHandler, pFile, AI_GLB_MAGIC_NUMBER, 1, 0,
-                   static_cast<unsigned int>(strlen(AI_GLB_MAGIC_NUMBER))));
+                   static_cast<unsigned int>(strlen(AI_GLB_MAGIC_NUMBER))),
+               mDracoThreads);
     if (asset.scene) {
         pScene->mName = asset.scene->name;
     }
@@ -1744,6 +1766,7 @@ void glTF2Importer::InternReadFile(const std::string &pFile, aiScene *pScene, IO
 
 void glTF2Importer::SetupProperties(const Importer *pImp) {
     mSchemaDocumentProvider = static_cast<rapidjson::IRemoteSchemaDocumentProvider *>(pImp->GetPropertyPointer(AI_CONFIG_IMPORT_SCHEMA_DOCUMENT_PROVIDER));
+    mDracoThreads = static_cast<unsigned int>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_GLTF_DRACO_THREADS, 1)));
 }
 
 #endif // ASSIMP_BUILD_NO_GLTF_IMPORTER
@@ -86,6 +86,9 @@ private:
 
     /// An instance of rapidjson::IRemoteSchemaDocumentProvider
     void *mSchemaDocumentProvider = nullptr;
+
+    /// The number of threads decoding Draco-compressed primitives
+    unsigned int mDracoThreads = 1;
 };
 
 } // namespace Assimp
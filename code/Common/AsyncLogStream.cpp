@@ -0,0 +1,169 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file  AsyncLogStream.cpp
+ *  @brief Implementation of AsyncLogStream
+ */
+
+#include <assimp/AsyncLogStream.hpp>
+#include <assimp/ai_assert.h>
+
+#include <string>
+
+namespace Assimp {
+
+// ----------------------------------------------------------------------------------
+// A queued message
+struct AsyncLogStream::Message {
+    Message *next;
+    std::string text;
+};
+
+// ----------------------------------------------------------------------------------
+AsyncLogStream::AsyncLogStream(LogStream *stream) :
+        mStream(stream),
+        mPending(nullptr),
+        mNumQueued(0),
+        mNumWritten(0)
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+        ,
+        mStop(false)
+#endif
+{
+    ai_assert(nullptr != stream);
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    mWriter = std::thread(&AsyncLogStream::WriterLoop, this);
+#endif
+}
+
+// ----------------------------------------------------------------------------------
+AsyncLogStream::~AsyncLogStream() {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+    }
+    mCondition.notify_one();
+    mWriter.join();
+#endif
+    WritePending();
+    delete mStream;
+}
+
+// ----------------------------------------------------------------------------------
+void AsyncLogStream::write(const char *message) {
+    if (nullptr == message) {
+        return;
+    }
+
+    Message *msg = new Message{ mPending.load(std::memory_order_relaxed), message };
+    ++mNumQueued;
+    while (!mPending.compare_exchange_weak(msg->next, msg, std::memory_order_release, std::memory_order_relaxed)) {
+        // msg->next has been updated to the current head, try again
+    }
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    // the writer only sleeps on an empty queue, so only the first message needs to
+    // wake it up. Notifying under the mutex can't slip in between its check and its wait.
+    if (nullptr == msg->next) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mCondition.notify_one();
+    }
+#else
+    WritePending();
+#endif
+}
+
+// ----------------------------------------------------------------------------------
+void AsyncLogStream::flush() {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    const size_t numQueued = mNumQueued;
+    std::unique_lock<std::mutex> lock(mMutex);
+    mCondition.notify_one();
+    mWritten.wait(lock, [this, numQueued] {
+        return mNumWritten >= numQueued;
+    });
+#else
+    WritePending();
+#endif
+}
+
+// ----------------------------------------------------------------------------------
+void AsyncLogStream::WriterLoop() {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    while (!mStop) {
+        WritePending();
+
+        std::unique_lock<std::mutex> lock(mMutex);
+        mWritten.notify_all();
+        mCondition.wait(lock, [this] {
+            return mStop || nullptr != mPending.load(std::memory_order_relaxed);
+        });
+    }
+#endif
+}
+
+// ----------------------------------------------------------------------------------
+void AsyncLogStream::WritePending() {
+    Message *msg = mPending.exchange(nullptr, std::memory_order_acquire);
+
+    // restore the order in which the messages have been queued
+    Message *ordered = nullptr;
+    while (nullptr != msg) {
+        Message *next = msg->next;
+        msg->next = ordered;
+        ordered = msg;
+        msg = next;
+    }
+
+    while (nullptr != ordered) {
+        Message *next = ordered->next;
+        mStream->write(ordered->text.c_str());
+        delete ordered;
+        ordered = next;
+        ++mNumWritten;
+    }
+}
+
+} // namespace Assimp
@@ -45,8 +45,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "FileSystemFilter.h"
 #include "Importer.h"
+#include "ScenePrivate.h"
+#include "ThreadPool.h"
 #include <assimp/BaseImporter.h>
 #include <assimp/ByteSwapper.h>
+#include <assimp/config.h>
 #include <assimp/ParsingUtils.h>
 #include <assimp/importerdesc.h>
 #include <assimp/postprocess.h>
@@ -58,6 +61,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <list>
 #include <memory>
 #include <sstream>
+#include <vector>
 
 namespace {
 // Checks whether the passed string is a gcs version.
@@ -118,6 +122,8 @@ aiScene *BaseImporter::ReadFile(Importer *pImp, const std::string &pFile, IOSyst
     ai_assert(m_progress);
 
     // Gather configuration properties for this run
+    const bool sceneArena = pImp->GetPropertyBool(AI_CONFIG_IMPORT_SCENE_ARENA, false);
+    contiguousFaceIndices = sceneArena || pImp->GetPropertyBool(AI_CONFIG_IMPORT_CONTIGUOUS_FACE_INDICES, false);
     SetupProperties(pImp);
 
     // Construct a file system filter to improve our success ratio at reading external files
@@ -125,6 +131,9 @@ aiScene *BaseImporter::ReadFile(Importer *pImp, const std::string &pFile, IOSyst
 
     // create a scene object to hold the data
     std::unique_ptr<aiScene> sc(new aiScene());
+    if (sceneArena) {
+        EnableSceneArena(sc.get());
+    }
 
     // dispatch importing
     try {
@@ -520,7 +529,7 @@ struct LoadRequest {
 // BatchLoader::pimpl data structure
 struct Assimp::BatchData {
     BatchData(IOSystem *pIO, bool validate) :
-            pIOSystem(pIO), pImporter(nullptr), next_id(0xffff), validate(validate) {
+            pIOSystem(pIO), pImporter(nullptr), next_id(0xffff), validate(validate), numThreads(1) {
         ai_assert(nullptr != pIO);
 
         pImporter = new Importer();
@@ -549,10 +558,99 @@ struct Assimp::BatchData {
 
     // Validation enabled state
     bool validate;
+
+    // Number of threads used by LoadAll, 0 for hardware concurrency
+    unsigned int numThreads;
 };
 
 typedef std::list<LoadRequest>::iterator LoadReqIt;
 
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// IO system handed to the importers running on the worker threads of the BatchLoader.
+// All file access is forwarded to the shared IO system, but every worker has its own
+// directory stack: importers push/pop directories while loading, which must not leak
+// into imports running concurrently.
+class BatchIOSystem : public IOSystem {
+public:
+    explicit BatchIOSystem(IOSystem *wrapped) :
+            mWrapped(wrapped) {
+        ai_assert(nullptr != mWrapped);
+
+        const std::string &cur = mWrapped->CurrentDirectory();
+        if (!cur.empty()) {
+            PushDirectory(cur);
+        }
+    }
+
+    ~BatchIOSystem() override = default;
+
+    bool Exists(const char *pFile) const override {
+        return mWrapped->Exists(pFile);
+    }
+
+    char getOsSeparator() const override {
+        return mWrapped->getOsSeparator();
+    }
+
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override {
+        return mWrapped->Open(pFile, pMode);
+    }
+
+    void Close(IOStream *pFile) override {
+        mWrapped->Close(pFile);
+    }
+
+    bool ComparePaths(const char *one, const char *second) const override {
+        return mWrapped->ComparePaths(one, second);
+    }
+
+    bool CreateDirectory(const std::string &path) override {
+        return mWrapped->CreateDirectory(path);
+    }
+
+    bool ChangeDirectory(const std::string &path) override {
+        return mWrapped->ChangeDirectory(path);
+    }
+
+    bool DeleteFile(const std::string &file) override {
+        return mWrapped->DeleteFile(file);
+    }
+
+private:
+    IOSystem *mWrapped;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Imports a single request using the given importer
+void ReadLoadRequest(Importer *importer, LoadRequest &req, bool validate) {
+    // force validation in debug builds
+    unsigned int pp = req.flags;
+    if (validate) {
+        pp |= aiProcess_ValidateDataStructure;
+    }
+
+    // setup config properties if necessary
+    ImporterPimpl *pimpl = importer->Pimpl();
+    pimpl->mFloatProperties = req.map.floats;
+    pimpl->mIntProperties = req.map.ints;
+    pimpl->mStringProperties = req.map.strings;
+    pimpl->mMatrixProperties = req.map.matrices;
+
+    if (!DefaultLogger::isNullLogger()) {
+        ASSIMP_LOG_INFO("%%% BEGIN EXTERNAL FILE %%%");
+        ASSIMP_LOG_INFO("File: ", req.file);
+    }
+    importer->ReadFile(req.file, pp);
+    req.scene = importer->GetOrphanedScene();
+    req.loaded = true;
+
+    ASSIMP_LOG_INFO("%%% END EXTERNAL FILE %%%");
+}
+
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 BatchLoader::BatchLoader(IOSystem *pIO, bool validate) {
     ai_assert(nullptr != pIO);
@@ -579,6 +677,16 @@ bool BatchLoader::getValidation() const {
     return m_data->validate;
 }
 
+// ------------------------------------------------------------------------------------------------
+void BatchLoader::setNumThreads(unsigned int numThreads) {
+    m_data->numThreads = numThreads;
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int BatchLoader::getNumThreads() const {
+    return m_data->numThreads;
+}
+
 // ------------------------------------------------------------------------------------------------
 unsigned int BatchLoader::AddLoadRequest(const std::string &file,
         unsigned int steps /*= 0*/, const PropertyMap *map /*= nullptr*/) {
@@ -622,29 +730,28 @@ aiScene *BatchLoader::GetImport(unsigned int which) {
 
 // ------------------------------------------------------------------------------------------------
 void BatchLoader::LoadAll() {
-    // no threaded implementation for the moment
-    for (LoadReqIt it = m_data->requests.begin(); it != m_data->requests.end(); ++it) {
-        // force validation in debug builds
-        unsigned int pp = (*it).flags;
-        if (m_data->validate) {
-            pp |= aiProcess_ValidateDataStructure;
+    if (1 != m_data->numThreads && m_data->requests.size() > 1) {
+        // Every request gets its own importer, so the importers don't share any state.
+        std::vector<LoadRequest *> pending;
+        for (LoadReqIt it = m_data->requests.begin(); it != m_data->requests.end(); ++it) {
+            if (!(*it).loaded) {
+                pending.push_back(&(*it));
+            }
         }
 
-        // setup config properties if necessary
-        ImporterPimpl *pimpl = m_data->pImporter->Pimpl();
-        pimpl->mFloatProperties = (*it).map.floats;
-        pimpl->mIntProperties = (*it).map.ints;
-        pimpl->mStringProperties = (*it).map.strings;
-        pimpl->mMatrixProperties = (*it).map.matrices;
+        ThreadPool pool(m_data->numThreads);
+        ASSIMP_LOG_DEBUG("BatchLoader: loading ", pending.size(), " files in parallel on ", pool.GetNumThreads(), " threads");
+        pool.ParallelFor(pending.size(), [this, &pending](size_t i) {
+            Importer importer;
+            importer.SetIOHandler(new BatchIOSystem(m_data->pIOSystem)); // owned by the importer
+            ReadLoadRequest(&importer, *pending[i], m_data->validate);
+        });
+        return;
+    }
 
-        if (!DefaultLogger::isNullLogger()) {
-            ASSIMP_LOG_INFO("%%% BEGIN EXTERNAL FILE %%%");
-            ASSIMP_LOG_INFO("File: ", (*it).file);
+    for (LoadReqIt it = m_data->requests.begin(); it != m_data->requests.end(); ++it) {
+        if (!(*it).loaded) {
+            ReadLoadRequest(m_data->pImporter, *it, m_data->validate);
         }
-        m_data->pImporter->ReadFile((*it).file, pp);
-        (*it).scene = m_data->pImporter->GetOrphanedScene();
-        (*it).loaded = true;
-
-        ASSIMP_LOG_INFO("%%% END EXTERNAL FILE %%%");
     }
 }
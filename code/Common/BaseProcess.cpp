@@ -43,17 +43,21 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "BaseProcess.h"
 #include "Importer.h"
+#include "ThreadPool.h"
 #include <assimp/BaseImporter.h>
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
 
+#include <atomic>
+
 using namespace Assimp;
 
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 BaseProcess::BaseProcess() AI_NO_EXCEPT
         : shared(),
-          progress() {
+          progress(),
+          threadPool() {
     // empty
 }
 
@@ -76,6 +80,7 @@ void BaseProcess::ExecuteOnScene(Importer *pImp) {
     }
 
     SetupProperties(pImp);
+    threadPool = pImp->Pimpl()->mThreadPool;
 
     // catch exceptions thrown inside the PostProcess-Step
     try {
@@ -101,3 +106,32 @@ void BaseProcess::SetupProperties(const Importer * /*pImp*/) {
 bool BaseProcess::RequireVerboseFormat() const {
     return true;
 }
+
+// ------------------------------------------------------------------------------------------------
+bool BaseProcess::ExecutePerMesh(aiScene * /*pScene*/, unsigned int /*meshIndex*/) {
+    // the default implementation does nothing
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int BaseProcess::ExecuteOnAllMeshes(aiScene *pScene) {
+    ai_assert(nullptr != pScene);
+
+    if (nullptr == threadPool || pScene->mNumMeshes < 2) {
+        unsigned int numModified = 0;
+        for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+            if (ExecutePerMesh(pScene, a)) {
+                ++numModified;
+            }
+        }
+        return numModified;
+    }
+
+    std::atomic<unsigned int> numModified(0);
+    threadPool->ParallelFor(pScene->mNumMeshes, [this, pScene, &numModified](size_t a) {
+        if (ExecutePerMesh(pScene, static_cast<unsigned int>(a))) {
+            ++numModified;
+        }
+    });
+    return numModified;
+}
@@ -52,6 +52,7 @@ struct aiScene;
 namespace Assimp {
 
 class Importer;
+class ThreadPool;
 
 // ---------------------------------------------------------------------------
 /** Helper class to allow post-processing steps to interact with each other.
@@ -226,6 +227,19 @@ public:
      */
     virtual void Execute(aiScene *pScene) = 0;
 
+    // -------------------------------------------------------------------
+    /**
+     * @brief Executes the post processing step on a single mesh.
+     * Steps which process all meshes independently of each other implement
+     * this function and call ExecuteOnAllMeshes() from Execute(). Since the
+     * meshes may be processed concurrently, an implementation must not
+     * modify anything but the given mesh.
+     * @param pScene The imported data to work at.
+     * @param meshIndex Index of the mesh to process.
+     * @return true if the mesh has been modified.
+     */
+    virtual bool ExecutePerMesh(aiScene *pScene, unsigned int meshIndex);
+
     // -------------------------------------------------------------------
     /** Assign a new SharedPostProcessInfo to the step. This object
      *  allows multiple post-process steps to share data.
@@ -242,12 +256,25 @@ public:
         return shared;
     }
 
+protected:
+    // -------------------------------------------------------------------
+    /** Calls ExecutePerMesh() for all meshes of the scene. The meshes are
+     *  distributed over the worker threads of the importer, if it has
+     *  been configured to use any (#AI_CONFIG_GLOB_POSTPROCESS_THREADS).
+     * @param pScene The imported data to work at.
+     * @return The number of meshes for which ExecutePerMesh() returned true.
+     */
+    unsigned int ExecuteOnAllMeshes(aiScene *pScene);
+
 protected:
     /** See the doc of #SharedPostProcessInfo for more details */
     SharedPostProcessInfo *shared;
 
     /** Currently active progress handler */
     ProgressHandler *progress;
+
+    /** Worker threads for per-mesh execution, may be nullptr */
+    ThreadPool *threadPool;
 };
 
 } // end of namespace Assimp
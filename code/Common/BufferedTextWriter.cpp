@@ -0,0 +1,136 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file  BufferedTextWriter.cpp
+ *  @brief Implementation of the buffered text writer for exporters
+ */
+
+#include <assimp/BufferedTextWriter.h>
+#include <assimp/Exceptional.h>
+#include <assimp/IOStream.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+
+namespace Assimp {
+
+namespace {
+
+template <typename T>
+size_t FormatReal(char *buffer, T value) {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    // shortest representation which reads back to the same value
+    return static_cast<size_t>(std::to_chars(buffer, buffer + BufferedTextWriter::MaxNumberLength, value).ptr - buffer);
+#else
+    // max_digits10 digits are enough to read back the same value
+    const int length = ::snprintf(buffer, BufferedTextWriter::MaxNumberLength, "%.*g",
+            std::numeric_limits<T>::max_digits10, static_cast<double>(value));
+    if (length <= 0) {
+        return 0;
+    }
+    // snprintf respects the decimal point of the current C locale
+    std::replace(buffer, buffer + length, ',', '.');
+    return static_cast<size_t>(length);
+#endif
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+BufferedTextWriter::BufferedTextWriter(IOStream *stream, size_t bufferSize) :
+        mStream(stream),
+        mBuffer(std::max(bufferSize, MaxNumberLength)),
+        mPos(0),
+        mFlushed(0) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+void BufferedTextWriter::setStream(IOStream *stream) {
+    flush();
+    mStream = stream;
+}
+
+// ------------------------------------------------------------------------------------------------
+void BufferedTextWriter::flush() {
+    if (mPos == 0) {
+        return;
+    }
+    if (mStream == nullptr) {
+        throw DeadlyExportError("BufferedTextWriter: no output stream to write to");
+    }
+    if (mStream->Write(mBuffer.data(), mPos, 1) != 1) {
+        throw DeadlyExportError("BufferedTextWriter: failed to write to the output stream");
+    }
+    mFlushed += mPos;
+    mPos = 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+void BufferedTextWriter::writeLarge(const char *data, size_t length) {
+    flush();
+    if (length < mBuffer.size()) {
+        ::memcpy(mBuffer.data(), data, length);
+        mPos = length;
+        return;
+    }
+    // too big for the buffer, no need to copy it
+    if (mStream == nullptr) {
+        throw DeadlyExportError("BufferedTextWriter: no output stream to write to");
+    }
+    if (mStream->Write(data, length, 1) != 1) {
+        throw DeadlyExportError("BufferedTextWriter: failed to write to the output stream");
+    }
+    mFlushed += length;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t BufferedTextWriter::format(char *buffer, float value) {
+    return FormatReal(buffer, value);
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t BufferedTextWriter::format(char *buffer, double value) {
+    return FormatReal(buffer, value);
+}
+
+} // namespace Assimp
@@ -172,6 +172,26 @@ size_t Compression::decompress(const void *data, size_t in, std::vector<char> &u
     return total;
 }
 
+size_t Compression::decompress(const void *data, size_t in, char *out, size_t availableOut) {
+    ai_assert(mImpl != nullptr);
+    ai_assert(mImpl->mFlushMode == FlushMode::Finish);
+    if (data == nullptr || in == 0 || out == nullptr || availableOut == 0) {
+        return 0l;
+    }
+
+    mImpl->mZSstream.next_in = (Bytef *)(data);
+    mImpl->mZSstream.avail_in = (uInt)in;
+    mImpl->mZSstream.next_out = reinterpret_cast<Bytef *>(out);
+    mImpl->mZSstream.avail_out = static_cast<uInt>(availableOut);
+
+    const int ret = inflate(&mImpl->mZSstream, Z_FINISH);
+    if (ret != Z_STREAM_END && ret != Z_OK) {
+        throw DeadlyImportError("Compression", "Failure decompressing this file using gzip.");
+    }
+
+    return availableOut - mImpl->mZSstream.avail_out;
+}
+
 size_t Compression::decompressBlock(const void *data, size_t in, char *out, size_t availableOut) {
     ai_assert(mImpl != nullptr);
     if (data == nullptr || in == 0 || out == nullptr || availableOut == 0) {
@@ -101,6 +101,15 @@ public:
     /// @param[out uncompressed A std::vector containing the decompressed data.
     size_t decompress(const void *data, size_t in, std::vector<char> &uncompressed);
 
+    /// @brief Will decompress the data buffer in one step into a buffer of known size.
+    ///        Requires FlushMode::Finish.
+    /// @param[in]  data         The compressed data
+    /// @param[in]  in           The size of the data buffer
+    /// @param[out] out          The output buffer
+    /// @param[in]  availableOut The size of the output buffer.
+    /// @return The size of the decompressed data.
+    size_t decompress(const void *data, size_t in, char *out, size_t availableOut);
+
     /// @brief Will decompress the data buffer block-wise.
     /// @param[in]  data         The compressed data
     /// @param[in]  in           The size of the data buffer
@@ -330,11 +330,13 @@ bool DefaultLogger::attachStream(LogStream *pStream, unsigned int severity) {
             ++it) {
         if ((*it)->m_pStream == pStream) {
             (*it)->m_uiErrorSeverity |= severity;
+            m_streamSeverities |= severity;
             return true;
         }
     }
 
     m_StreamArray.push_back(new LogStreamInfo(severity, pStream));
+    m_streamSeverities |= severity;
 
     return true;
 }
@@ -363,19 +365,31 @@ bool DefaultLogger::detachStream(LogStream *pStream, unsigned int severity) {
                 (**it).m_pStream = nullptr;
                 delete *it;
                 m_StreamArray.erase(it);
-                res = true;
-                break;
             }
-            return true;
+            res = true;
+            break;
         }
     }
+
+    unsigned int streamSeverities = 0;
+    for (const LogStreamInfo *info : m_StreamArray) {
+        streamSeverities |= info->m_uiErrorSeverity;
+    }
+    m_streamSeverities = streamSeverities;
+
     return res;
 }
 
+// ----------------------------------------------------------------------------------
+//  Checks whether a message would be written to any stream
+bool DefaultLogger::isEnabled(ErrorSeverity severity, LogSeverity level) const {
+    return m_Severity >= level && 0 != (m_streamSeverities & severity);
+}
+
 // ----------------------------------------------------------------------------------
 //  Constructor
 DefaultLogger::DefaultLogger(LogSeverity severity) :
-        Logger(severity), noRepeatMsg(false), lastLen(0) {
+        Logger(severity), m_streamSeverities(0), noRepeatMsg(false), lastLen(0) {
     lastMsg[0] = '\0';
 }
 
@@ -0,0 +1,271 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file  HeaderCacheIOSystem.cpp
+ *  @brief Implementation of the header caching IOSystem wrapper.
+ */
+
+#include "HeaderCacheIOSystem.h"
+
+#include <assimp/ai_assert.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+namespace Assimp {
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// Only plain read modes can be served from the cache
+bool IsReadMode(const char *pMode) {
+    return nullptr != pMode && 'r' == pMode[0] && nullptr == ::strpbrk(pMode, "+t");
+}
+
+// ---------------------------------------------------------------------------
+// Stream used by HeaderCacheIOSystem. Reads inside the header are served from
+// the cache, the file is opened for the first read behind it. The stream shares
+// the cached header, so it stays valid if it outlives the HeaderCacheIOSystem.
+class HeaderCacheIOStream : public IOStream {
+public:
+    HeaderCacheIOStream(IOSystem *wrapped, const std::string &file, const std::string &mode,
+            const std::shared_ptr<const std::vector<uint8_t>> &header, size_t fileSize) :
+            mWrapped(wrapped), mFile(file), mMode(mode), mHeader(header), mFileSize(fileSize), mPos(0), mStream(nullptr) {
+        ai_assert(nullptr != mHeader);
+    }
+
+    ~HeaderCacheIOStream() override {
+        if (nullptr != mStream) {
+            mWrapped->Close(mStream);
+        }
+    }
+
+    size_t Read(void *pvBuffer, size_t pSize, size_t pCount) override {
+        ai_assert(nullptr != pvBuffer);
+        if (0 == pSize || 0 == pCount) {
+            return 0;
+        }
+
+        const size_t cnt = std::min(pCount, (mFileSize - mPos) / pSize);
+        const size_t ofs = pSize * cnt;
+        if (mPos + ofs <= mHeader->size()) {
+            ::memcpy(pvBuffer, mHeader->data() + mPos, ofs);
+            mPos += ofs;
+            return cnt;
+        }
+
+        if (nullptr == mStream) {
+            mStream = mWrapped->Open(mFile.c_str(), mMode.c_str());
+            if (nullptr == mStream) {
+                return 0;
+            }
+        }
+        if (AI_SUCCESS != mStream->Seek(mPos, aiOrigin_SET)) {
+            return 0;
+        }
+        const size_t read = mStream->Read(pvBuffer, pSize, cnt);
+        mPos += read * pSize;
+        return read;
+    }
+
+    size_t Write(const void *, size_t, size_t) override {
+        return 0;
+    }
+
+    aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override {
+        if (aiOrigin_SET == pOrigin) {
+            if (pOffset > mFileSize) {
+                return AI_FAILURE;
+            }
+            mPos = pOffset;
+        } else if (aiOrigin_END == pOrigin) {
+            if (pOffset > mFileSize) {
+                return AI_FAILURE;
+            }
+            mPos = mFileSize - pOffset;
+        } else {
+            if (pOffset > mFileSize - mPos) {
+                return AI_FAILURE;
+            }
+            mPos += pOffset;
+        }
+        return AI_SUCCESS;
+    }
+
+    size_t Tell() const override {
+        return mPos;
+    }
+
+    size_t FileSize() const override {
+        return mFileSize;
+    }
+
+    void Flush() override {
+        // empty
+    }
+
+private:
+    IOSystem *mWrapped;
+    const std::string mFile;
+    const std::string mMode;
+    const std::shared_ptr<const std::vector<uint8_t>> mHeader;
+    const size_t mFileSize;
+    size_t mPos;
+    IOStream *mStream;
+};
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+HeaderCacheIOSystem::HeaderCacheIOSystem(IOSystem *wrapped, const std::string &file, size_t headerSize) :
+        mWrapped(wrapped), mFile(file), mHeaderSize(headerSize), mHeader(), mFileSize(0) {
+    ai_assert(nullptr != mWrapped);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool HeaderCacheIOSystem::LoadHeader() {
+    if (nullptr != mHeader) {
+        return true;
+    }
+
+    IOStream *stream = mWrapped->Open(mFile.c_str(), "rb");
+    if (nullptr == stream) {
+        return false;
+    }
+
+    mFileSize = stream->FileSize();
+    std::shared_ptr<std::vector<uint8_t>> header = std::make_shared<std::vector<uint8_t>>(std::min(mHeaderSize, mFileSize));
+    if (!header->empty()) {
+        header->resize(stream->Read(header->data(), 1, header->size()));
+    }
+    mWrapped->Close(stream);
+
+    mHeader = header;
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t HeaderCacheIOSystem::GetFileSize() {
+    if (nullptr != mHeader) {
+        return mFileSize;
+    }
+
+    IOStream *stream = mWrapped->Open(mFile.c_str(), "rb");
+    if (nullptr == stream) {
+        return 0;
+    }
+    const size_t fileSize = stream->FileSize();
+    mWrapped->Close(stream);
+    return fileSize;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool HeaderCacheIOSystem::Exists(const char *pFile) const {
+    if (nullptr != mHeader && mFile == pFile) {
+        return true;
+    }
+    return mWrapped->Exists(pFile);
+}
+
+// ------------------------------------------------------------------------------------------------
+char HeaderCacheIOSystem::getOsSeparator() const {
+    return mWrapped->getOsSeparator();
+}
+
+// ------------------------------------------------------------------------------------------------
+IOStream *HeaderCacheIOSystem::Open(const char *pFile, const char *pMode) {
+    if (IsReadMode(pMode) && mFile == pFile && LoadHeader()) {
+        return new HeaderCacheIOStream(mWrapped, mFile, pMode, mHeader, mFileSize);
+    }
+    return mWrapped->Open(pFile, pMode);
+}
+
+// ------------------------------------------------------------------------------------------------
+void HeaderCacheIOSystem::Close(IOStream *pFile) {
+    if (nullptr != dynamic_cast<HeaderCacheIOStream *>(pFile)) {
+        delete pFile;
+        return;
+    }
+    mWrapped->Close(pFile);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool HeaderCacheIOSystem::ComparePaths(const char *one, const char *second) const {
+    return mWrapped->ComparePaths(one, second);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool HeaderCacheIOSystem::PushDirectory(const std::string &path) {
+    return mWrapped->PushDirectory(path);
+}
+
+// ------------------------------------------------------------------------------------------------
+const std::string &HeaderCacheIOSystem::CurrentDirectory() const {
+    return mWrapped->CurrentDirectory();
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t HeaderCacheIOSystem::StackSize() const {
+    return mWrapped->StackSize();
+}
+
+// ------------------------------------------------------------------------------------------------
+bool HeaderCacheIOSystem::PopDirectory() {
+    return mWrapped->PopDirectory();
+}
+
+// ------------------------------------------------------------------------------------------------
+bool HeaderCacheIOSystem::CreateDirectory(const std::string &path) {
+    return mWrapped->CreateDirectory(path);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool HeaderCacheIOSystem::ChangeDirectory(const std::string &path) {
+    return mWrapped->ChangeDirectory(path);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool HeaderCacheIOSystem::DeleteFile(const std::string &file) {
+    return mWrapped->DeleteFile(file);
+}
+
+} // namespace Assimp
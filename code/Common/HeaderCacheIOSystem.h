@@ -0,0 +1,117 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------
+*/
+
+/** @file  HeaderCacheIOSystem.h
+ *  @brief IOSystem wrapper which serves the signature checks of the importers
+ *      from a single read of the file header.
+ */
+#pragma once
+#ifndef AI_HEADERCACHEIOSYSTEM_H_INC
+#define AI_HEADERCACHEIOSYSTEM_H_INC
+
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** @brief IOSystem wrapper which reads the header of one file once and hands
+ *  out streams reading from that copy.
+ *
+ *  Importer::ReadFile() passes it to BaseImporter::CanRead(), so probing
+ *  several importers doesn't open and read the file again for every one of
+ *  them. The header is read when the file is opened for the first time, so
+ *  there is no extra IO if no signature check is needed. Reads behind the
+ *  cached header open the file on demand, all other files and calls are
+ *  forwarded to the wrapped IOSystem. All streams of the wrapped IOSystem are
+ *  closed through it.
+ *
+ *  This is an internal helper of the Importer and not part of the public API.
+ */
+class HeaderCacheIOSystem : public IOSystem {
+public:
+    /// @brief  The number of bytes cached by default, enough for all
+    ///         signature checks of the built-in importers.
+    static const size_t DefaultHeaderSize = 4096;
+
+    /// @brief  The class constructor, does not access the file yet.
+    /// @param  wrapped     The IOSystem to forward to, must not be nullptr.
+    /// @param  file        The file to cache.
+    /// @param  headerSize  The number of bytes to cache.
+    HeaderCacheIOSystem(IOSystem *wrapped, const std::string &file, size_t headerSize = DefaultHeaderSize);
+
+    /// @brief  The class destructor.
+    ~HeaderCacheIOSystem() override = default;
+
+    /// @brief  Returns the size of the cached file, 0 if it can't be opened.
+    ///         Doesn't read the header if it hasn't been read yet.
+    size_t GetFileSize();
+
+    bool Exists(const char *pFile) const override;
+    char getOsSeparator() const override;
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override;
+    void Close(IOStream *pFile) override;
+    bool ComparePaths(const char *one, const char *second) const override;
+    bool PushDirectory(const std::string &path) override;
+    const std::string &CurrentDirectory() const override;
+    size_t StackSize() const override;
+    bool PopDirectory() override;
+    bool CreateDirectory(const std::string &path) override;
+    bool ChangeDirectory(const std::string &path) override;
+    bool DeleteFile(const std::string &file) override;
+
+private:
+    bool LoadHeader();
+
+private:
+    IOSystem *mWrapped;
+    std::string mFile;
+    size_t mHeaderSize;
+    std::shared_ptr<const std::vector<uint8_t>> mHeader; //!< Shared with the streams handed out, nullptr until read
+    size_t mFileSize;
+};
+
+} // namespace Assimp
+
+#endif // AI_HEADERCACHEIOSYSTEM_H_INC
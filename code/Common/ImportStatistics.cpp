@@ -0,0 +1,249 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file  ImportStatistics.cpp
+ *  @brief Implementation of the import statistics helpers.
+ */
+
+#include "ImportStatistics.h"
+#include "BaseProcess.h"
+
+#include <assimp/ai_assert.h>
+
+#include <typeinfo>
+
+#if defined(_WIN32)
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   include <windows.h>
+#   include <psapi.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#   include <sys/resource.h>
+#endif
+
+#if defined(__GNUC__)
+#   include <cxxabi.h>
+#   include <cstdlib>
+#endif
+
+namespace Assimp {
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// Stream wrapper used by CountingIOSystem. Deleting the wrapper closes the
+// wrapped stream, so importers may either delete the stream or close it.
+class CountingIOStream : public IOStream {
+public:
+    CountingIOStream(IOStream *wrapped, IOSystem *system, std::atomic<uint64_t> &counter) :
+            mWrapped(wrapped), mSystem(system), mCounter(counter), mViewCounted(false) {
+        ai_assert(nullptr != mWrapped);
+    }
+
+    ~CountingIOStream() override {
+        mSystem->Close(mWrapped);
+    }
+
+    size_t Read(void *pvBuffer, size_t pSize, size_t pCount) override {
+        const size_t read = mWrapped->Read(pvBuffer, pSize, pCount);
+        mCounter += static_cast<uint64_t>(read) * pSize;
+        return read;
+    }
+
+    size_t Write(const void *pvBuffer, size_t pSize, size_t pCount) override {
+        return mWrapped->Write(pvBuffer, pSize, pCount);
+    }
+
+    aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override {
+        return mWrapped->Seek(pOffset, pOrigin);
+    }
+
+    size_t Tell() const override {
+        return mWrapped->Tell();
+    }
+
+    size_t FileSize() const override {
+        return mWrapped->FileSize();
+    }
+
+    void Flush() override {
+        mWrapped->Flush();
+    }
+
+    const uint8_t *GetMemoryView() const override {
+        const uint8_t *view = mWrapped->GetMemoryView();
+        // reading through the view bypasses Read(), so count the whole file once
+        if (nullptr != view && !mViewCounted) {
+            mCounter += static_cast<uint64_t>(mWrapped->FileSize());
+            mViewCounted = true;
+        }
+        return view;
+    }
+
+private:
+    IOStream *mWrapped;
+    IOSystem *mSystem;
+    std::atomic<uint64_t> &mCounter;
+    mutable bool mViewCounted;
+};
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+CountingIOSystem::CountingIOSystem(IOSystem *wrapped) :
+        mWrapped(wrapped), mBytesRead(0) {
+    ai_assert(nullptr != mWrapped);
+}
+
+// ------------------------------------------------------------------------------------------------
+uint64_t CountingIOSystem::GetBytesRead() const {
+    return mBytesRead;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool CountingIOSystem::Exists(const char *pFile) const {
+    return mWrapped->Exists(pFile);
+}
+
+// ------------------------------------------------------------------------------------------------
+char CountingIOSystem::getOsSeparator() const {
+    return mWrapped->getOsSeparator();
+}
+
+// ------------------------------------------------------------------------------------------------
+IOStream *CountingIOSystem::Open(const char *pFile, const char *pMode) {
+    IOStream *stream = mWrapped->Open(pFile, pMode);
+    if (nullptr == stream) {
+        return nullptr;
+    }
+    return new CountingIOStream(stream, mWrapped, mBytesRead);
+}
+
+// ------------------------------------------------------------------------------------------------
+void CountingIOSystem::Close(IOStream *pFile) {
+    delete pFile;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool CountingIOSystem::ComparePaths(const char *one, const char *second) const {
+    return mWrapped->ComparePaths(one, second);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool CountingIOSystem::PushDirectory(const std::string &path) {
+    return mWrapped->PushDirectory(path);
+}
+
+// ------------------------------------------------------------------------------------------------
+const std::string &CountingIOSystem::CurrentDirectory() const {
+    return mWrapped->CurrentDirectory();
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t CountingIOSystem::StackSize() const {
+    return mWrapped->StackSize();
+}
+
+// ------------------------------------------------------------------------------------------------
+bool CountingIOSystem::PopDirectory() {
+    return mWrapped->PopDirectory();
+}
+
+// ------------------------------------------------------------------------------------------------
+bool CountingIOSystem::CreateDirectory(const std::string &path) {
+    return mWrapped->CreateDirectory(path);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool CountingIOSystem::ChangeDirectory(const std::string &path) {
+    return mWrapped->ChangeDirectory(path);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool CountingIOSystem::DeleteFile(const std::string &file) {
+    return mWrapped->DeleteFile(file);
+}
+
+// ------------------------------------------------------------------------------------------------
+uint64_t GetPeakResidentMemory() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<uint64_t>(counters.PeakWorkingSetSize);
+    }
+    return 0;
+#elif defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+    if (0 != getrusage(RUSAGE_SELF, &usage)) {
+        return 0;
+    }
+#   if defined(__APPLE__)
+    return static_cast<uint64_t>(usage.ru_maxrss); // bytes
+#   else
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024u; // kilobytes
+#   endif
+#else
+    return 0;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string GetProcessName(const BaseProcess &process) {
+    const char *raw = typeid(process).name();
+    std::string name = raw;
+#if defined(__GNUC__)
+    int status = 0;
+    char *demangled = abi::__cxa_demangle(raw, nullptr, nullptr, &status);
+    if (0 == status && nullptr != demangled) {
+        name = demangled;
+    }
+    std::free(demangled);
+#endif
+    // strip namespaces and MSVC's "class " prefix
+    const std::string::size_type pos = name.find_last_of(": ");
+    if (std::string::npos != pos) {
+        name.erase(0, pos + 1);
+    }
+    return name;
+}
+
+} // namespace Assimp
@@ -0,0 +1,114 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------
+*/
+
+/** @file  ImportStatistics.h
+ *  @brief Helpers to collect the runtime statistics of an import,
+ *      see Importer::GetImportStatistics().
+ */
+#pragma once
+#ifndef AI_IMPORTSTATISTICS_H_INC
+#define AI_IMPORTSTATISTICS_H_INC
+
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace Assimp {
+
+class BaseProcess;
+
+// ---------------------------------------------------------------------------
+/** @brief IOSystem wrapper which counts the number of bytes read through
+ *  the streams it has opened. All other calls are forwarded to the wrapped
+ *  IOSystem.
+ */
+class CountingIOSystem : public IOSystem {
+public:
+    /// @brief  The class constructor.
+    /// @param  wrapped     The IOSystem to forward to, must not be nullptr.
+    explicit CountingIOSystem(IOSystem *wrapped);
+
+    /// @brief  The class destructor.
+    ~CountingIOSystem() override = default;
+
+    /// @brief  Returns the number of bytes read so far.
+    uint64_t GetBytesRead() const;
+
+    bool Exists(const char *pFile) const override;
+    char getOsSeparator() const override;
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override;
+    void Close(IOStream *pFile) override;
+    bool ComparePaths(const char *one, const char *second) const override;
+    bool PushDirectory(const std::string &path) override;
+    const std::string &CurrentDirectory() const override;
+    size_t StackSize() const override;
+    bool PopDirectory() override;
+    bool CreateDirectory(const std::string &path) override;
+    bool ChangeDirectory(const std::string &path) override;
+    bool DeleteFile(const std::string &file) override;
+
+private:
+    IOSystem *mWrapped;
+    std::atomic<uint64_t> mBytesRead;
+};
+
+// ---------------------------------------------------------------------------
+/** @brief  Returns the peak resident memory of the process.
+ *
+ *  This is the high-water mark since the process has been started,
+ *  it never decreases.
+ *  @return The size in bytes, 0 if not supported on this platform.
+ */
+uint64_t GetPeakResidentMemory();
+
+// ---------------------------------------------------------------------------
+/** @brief  Returns a readable name for a post-processing step, e.g.
+ *      "TriangulateProcess".
+ *  @param  process     The post-processing step.
+ *  @return The name of the step's class.
+ */
+std::string GetProcessName(const BaseProcess &process);
+
+} // namespace Assimp
+
+#endif // AI_IMPORTSTATISTICS_H_INC
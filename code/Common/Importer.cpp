@@ -68,6 +68,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PostProcessing/ProcessHelper.h"
 #include "Common/ScenePreprocessor.h"
 #include "Common/ScenePrivate.h"
+#include "Common/ThreadPool.h"
+#include "Common/ImportStatistics.h"
+#include "Common/HeaderCacheIOSystem.h"
 
 #include <assimp/BaseImporter.h>
 #include <assimp/GenericProperty.h>
@@ -82,6 +85,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <set>
 #include <memory>
 #include <cctype>
+#include <locale>
+#include <sstream>
 
 #include <assimp/DefaultIOStream.h>
 #include <assimp/DefaultIOSystem.h>
@@ -144,6 +149,53 @@ void AllocateFromAssimpHeap::operator delete[] ( void* data)    {
     return ::operator delete[](data);
 }
 
+// ------------------------------------------------------------------------------------------------
+// Builds the lookup table for the file extensions of all registered importers
+static void UpdateExtensionIndex(ImporterPimpl *pimpl) {
+    pimpl->mExtensionIndex.clear();
+
+    std::set<std::string> extensions;
+    for (unsigned int a = 0; a < pimpl->mImporter.size(); ++a) {
+        extensions.clear();
+        pimpl->mImporter[a]->GetExtensionList(extensions);
+        for (const std::string &ext : extensions) {
+            // extensions may contain dots (e.g. mesh.xml), index them by their last part
+            const std::string lowerExt = ai_tolower(ext);
+            const std::string::size_type pos = lowerExt.find_last_of('.');
+            const std::string key = (pos == std::string::npos) ? lowerExt : lowerExt.substr(pos + 1);
+            pimpl->mExtensionIndex[key].push_back({ a, lowerExt });
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Collects the indices of all importers claiming the extension of the given file
+static void FindImportersByExtension(const ImporterPimpl *pimpl, const std::string &file, std::vector<unsigned int> &out) {
+    const std::string ext = BaseImporter::GetExtension(file);
+    if (ext.empty()) {
+        return;
+    }
+
+    ImporterPimpl::ExtensionIndexMap::const_iterator it = pimpl->mExtensionIndex.find(ext);
+    if (it == pimpl->mExtensionIndex.end()) {
+        return;
+    }
+
+    for (const ImporterPimpl::ExtensionIndexEntry &entry : it->second) {
+        if (!out.empty() && out.back() == entry.importerIndex) {
+            continue;
+        }
+        // extensions with dots need to match the entire end of the file name
+        if (entry.extension.length() != ext.length()) {
+            const std::set<std::string> extensions = { entry.extension };
+            if (!BaseImporter::HasExtension(file, extensions)) {
+                continue;
+            }
+        }
+        out.push_back(entry.importerIndex);
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 // Importer constructor.
 Importer::Importer()
@@ -160,6 +212,7 @@ Importer::Importer()
     pimpl->mIsDefaultProgressHandler = true;
 
     GetImporterInstanceList(pimpl->mImporter);
+    UpdateExtensionIndex(pimpl);
     GetPostProcessingStepInstanceList(pimpl->mPostProcessingSteps);
 
     // Allocate a SharedPostProcessInfo object and store pointers to it in all post-process steps in the list.
@@ -193,6 +246,12 @@ Importer::~Importer() {
     // Delete shared post-processing data
     delete pimpl->mPPShared;
 
+    // Stop the post-processing worker threads
+    delete pimpl->mThreadPool;
+
+    // Delete the timings of the last import
+    delete pimpl->mProfiler;
+
     // and finally the pimpl itself
     delete pimpl;
 }
@@ -240,6 +299,7 @@ aiReturn Importer::RegisterLoader(BaseImporter* pImp) {
 
     // add the loader
     pimpl->mImporter.push_back(pImp);
+    UpdateExtensionIndex(pimpl);
     ASSIMP_LOG_INFO("Registering custom importer for these file extensions: ", baked);
     ASSIMP_END_EXCEPTION_REGION(aiReturn);
 
@@ -260,6 +320,7 @@ aiReturn Importer::UnregisterLoader(BaseImporter* pImp) {
 
     if (it != pimpl->mImporter.end())   {
         pimpl->mImporter.erase(it);
+        UpdateExtensionIndex(pimpl);
         ASSIMP_LOG_INFO("Unregistering custom importer: ");
         return AI_SUCCESS;
     }
@@ -582,6 +643,51 @@ void WriteLogOpening(const std::string& file) {
     ASSIMP_LOG_DEBUG(stream.str());
 }
 
+// ------------------------------------------------------------------------------------------------
+// Drops the statistics of the previous import and starts a new measurement if requested
+static void ResetImportStatistics(ImporterPimpl *pimpl, bool measureTime) {
+    delete pimpl->mProfiler;
+    pimpl->mProfiler = measureTime ? new Profiler() : nullptr;
+    pimpl->mBytesRead = 0;
+    pimpl->mStatistics = aiImportStatistics();
+    pimpl->mStatisticsRegions.clear();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Copies the timings collected so far into the public statistics structure
+static void UpdateImportStatistics(ImporterPimpl *pimpl) {
+    const Profiler *profiler = pimpl->mProfiler;
+    if (nullptr == profiler) {
+        return;
+    }
+
+    aiImportStatistics &stats = pimpl->mStatistics;
+    stats = aiImportStatistics();
+    pimpl->mStatisticsRegions.clear();
+    for (const Profiler::Region &region : profiler->GetRegions()) {
+        if (!region.mFinished) {
+            continue;
+        }
+        aiProfileRegion entry;
+        entry.name.Set(region.mName);
+        entry.depth = region.mDepth;
+        entry.seconds = region.mSeconds;
+        pimpl->mStatisticsRegions.push_back(entry);
+
+        if (0 == region.mDepth) {
+            stats.totalTime += region.mSeconds;
+        }
+    }
+
+    stats.importTime = profiler->GetSeconds("import");
+    stats.preprocessTime = profiler->GetSeconds("preprocess");
+    stats.postprocessTime = profiler->GetSeconds("postprocess");
+    stats.bytesRead = pimpl->mBytesRead;
+    stats.processPeakMemory = GetPeakResidentMemory();
+    stats.numRegions = static_cast<unsigned int>(pimpl->mStatisticsRegions.size());
+    stats.regions = pimpl->mStatisticsRegions.empty() ? nullptr : pimpl->mStatisticsRegions.data();
+}
+
 // ------------------------------------------------------------------------------------------------
 // Reads the given file and returns its contents if successful.
 const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
@@ -618,7 +724,8 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
             return nullptr;
         }
 
-        std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
+        ResetImportStatistics(pimpl, GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) != 0);
+        Profiler *profiler = pimpl->mProfiler;
         if (profiler) {
             profiler->BeginRegion("total");
         }
@@ -626,39 +733,28 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
         // Find an worker class which can handle the file extension.
         // Multiple importers may be able to handle the same extension (.xml!); gather them all.
         SetPropertyInteger("importerIndex", -1);
-        struct ImporterAndIndex {
-            BaseImporter * importer;
-            unsigned int   index;
-        };
-        std::vector<ImporterAndIndex> possibleImporters;
-        for (unsigned int a = 0; a < pimpl->mImporter.size(); a++)  {
-
-            // Every importer has a list of supported extensions.
-            std::set<std::string> extensions;
-            pimpl->mImporter[a]->GetExtensionList(extensions);
-
-            if (BaseImporter::HasExtension(pFile, extensions)) {
-                ImporterAndIndex candidate = { pimpl->mImporter[a], a };
-                possibleImporters.push_back(candidate);
-            }
-        }
+        std::vector<unsigned int> possibleImporters;
+        FindImportersByExtension(pimpl, pFile, possibleImporters);
+
+        // Read the file header once, all signature checks below are served from it
+        HeaderCacheIOSystem headerCache(pimpl->mIOHandler, pFile);
 
         // If just one importer supports this extension, pick it and close the case.
         BaseImporter* imp = nullptr;
         if (1 == possibleImporters.size()) {
-            imp = possibleImporters[0].importer;
-            SetPropertyInteger("importerIndex", possibleImporters[0].index);
+            imp = pimpl->mImporter[possibleImporters[0]];
+            SetPropertyInteger("importerIndex", possibleImporters[0]);
         }
         // If multiple importers claim this file extension, ask them to look at the actual file data to decide.
         // This can happen e.g. with XML (COLLADA vs. Irrlicht).
         else {
-            for (std::vector<ImporterAndIndex>::const_iterator it = possibleImporters.begin(); it < possibleImporters.end(); ++it) {
-                BaseImporter & importer = *it->importer;
+            for (unsigned int index : possibleImporters) {
+                BaseImporter & importer = *pimpl->mImporter[index];
 
                 ASSIMP_LOG_INFO("Found a possible importer: " + std::string(importer.GetInfo()->mName) + "; trying signature-based detection");
-                if (importer.CanRead( pFile, pimpl->mIOHandler, true)) {
+                if (importer.CanRead( pFile, &headerCache, true)) {
                     imp = &importer;
-                    SetPropertyInteger("importerIndex", it->index);
+                    SetPropertyInteger("importerIndex", index);
                     break;
                 }
 
@@ -670,7 +766,7 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
             // not so bad yet ... try format auto detection.
             ASSIMP_LOG_INFO("File extension not known, trying signature-based detection");
             for( unsigned int a = 0; a < pimpl->mImporter.size(); a++)  {
-                if( pimpl->mImporter[a]->CanRead( pFile, pimpl->mIOHandler, true)) {
+                if( pimpl->mImporter[a]->CanRead( pFile, &headerCache, true)) {
                     imp = pimpl->mImporter[a];
                     SetPropertyInteger("importerIndex", a);
                     break;
@@ -685,13 +781,7 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
         }
 
         // Get file size for progress handler
-        IOStream * fileIO = pimpl->mIOHandler->Open( pFile );
-        uint32_t fileSize = 0;
-        if (fileIO)
-        {
-            fileSize = static_cast<uint32_t>(fileIO->FileSize());
-            pimpl->mIOHandler->Close( fileIO );
-        }
+        const uint32_t fileSize = static_cast<uint32_t>(headerCache.GetFileSize());
 
         // Dispatch the reading to the worker class for this format
         const aiImporterDesc *desc( imp->GetInfo() );
@@ -706,7 +796,14 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
             profiler->BeginRegion("import");
         }
 
-        pimpl->mScene = imp->ReadFile( this, pFile, pimpl->mIOHandler);
+        if (profiler) {
+            // count the bytes the importer reads, wrapping is cheap compared to file IO
+            CountingIOSystem countingIOHandler(pimpl->mIOHandler);
+            pimpl->mScene = imp->ReadFile( this, pFile, &countingIOHandler);
+            pimpl->mBytesRead += countingIOHandler.GetBytesRead();
+        } else {
+            pimpl->mScene = imp->ReadFile( this, pFile, pimpl->mIOHandler);
+        }
         pimpl->mProgressHandler->UpdateFileRead( fileSize, fileSize );
 
         if (profiler) {
@@ -761,6 +858,7 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
 
         if (profiler) {
             profiler->EndRegion("total");
+            UpdateImportStatistics(pimpl);
         }
     }
 #ifdef ASSIMP_CATCH_GLOBAL_EXCEPTIONS
@@ -785,6 +883,36 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
 }
 
 
+// ------------------------------------------------------------------------------------------------
+// Creates or releases the worker threads used by post-processing steps
+static void SetupPostProcessingThreads(ImporterPimpl *pimpl, int numThreads) {
+    if (1 == numThreads || numThreads < 0) {
+        delete pimpl->mThreadPool;
+        pimpl->mThreadPool = nullptr;
+        return;
+    }
+
+    const unsigned int requested = numThreads ? static_cast<unsigned int>(numThreads) : ThreadPool::GetHardwareConcurrency();
+    if (nullptr != pimpl->mThreadPool && pimpl->mThreadPool->GetNumThreads() == requested) {
+        return;
+    }
+    delete pimpl->mThreadPool;
+    pimpl->mThreadPool = new ThreadPool(requested);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Returns the profiler for a post-processing run. Timings are appended to the ones of the
+// last import, so post-processing applied after ReadFile() is part of its statistics.
+static Profiler *BeginPostProcessingStatistics(ImporterPimpl *pimpl, bool measureTime) {
+    if (!measureTime) {
+        return nullptr;
+    }
+    if (nullptr == pimpl->mProfiler) {
+        ResetImportStatistics(pimpl, true);
+    }
+    return pimpl->mProfiler;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Apply post-processing to the currently bound scene
 const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
@@ -830,19 +958,25 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
     }
 #endif // ! DEBUG
 
-    std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
+    SetupPostProcessingThreads(pimpl, GetPropertyInteger(AI_CONFIG_GLOB_POSTPROCESS_THREADS, 1));
+
+    Profiler *profiler = BeginPostProcessingStatistics(pimpl, GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) != 0);
+    if (profiler) {
+        profiler->BeginRegion("postprocess");
+    }
     for( unsigned int a = 0; a < pimpl->mPostProcessingSteps.size(); a++)   {
         BaseProcess* process = pimpl->mPostProcessingSteps[a];
         pimpl->mProgressHandler->UpdatePostProcess(static_cast<int>(a), static_cast<int>(pimpl->mPostProcessingSteps.size()) );
         if( process->IsActive( pFlags)) {
+            const std::string name = profiler ? GetProcessName(*process) : std::string();
             if (profiler) {
-                profiler->BeginRegion("postprocess");
+                profiler->BeginRegion(name);
             }
 
             process->ExecuteOnScene ( this );
 
             if (profiler) {
-                profiler->EndRegion("postprocess");
+                profiler->EndRegion(name);
             }
         }
         if( !pimpl->mScene) {
@@ -867,6 +1001,11 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
     pimpl->mProgressHandler->UpdatePostProcess( static_cast<int>(pimpl->mPostProcessingSteps.size()),
         static_cast<int>(pimpl->mPostProcessingSteps.size()) );
 
+    if (profiler) {
+        profiler->EndRegion("postprocess");
+        UpdateImportStatistics(pimpl);
+    }
+
     // update private scene flags
     if( pimpl->mScene ) {
       ScenePriv(pimpl->mScene)->mPPStepsApplied |= pFlags;
@@ -925,16 +1064,22 @@ const aiScene* Importer::ApplyCustomizedPostProcessing( BaseProcess *rootProcess
     }
 #endif // ! DEBUG
 
-    std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
+    SetupPostProcessingThreads(pimpl, GetPropertyInteger(AI_CONFIG_GLOB_POSTPROCESS_THREADS, 1));
+
+    Profiler *profiler = BeginPostProcessingStatistics(pimpl, GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) != 0);
+    const std::string name = profiler ? GetProcessName(*rootProcess) : std::string();
 
     if ( profiler ) {
         profiler->BeginRegion( "postprocess" );
+        profiler->BeginRegion( name );
     }
 
     rootProcess->ExecuteOnScene( this );
 
     if ( profiler ) {
+        profiler->EndRegion( name );
         profiler->EndRegion( "postprocess" );
+        UpdateImportStatistics(pimpl);
     }
 
 #ifndef ASSIMP_BUILD_NO_VALIDATEDS_PROCESS
@@ -1017,14 +1162,12 @@ size_t Importer::GetImporterIndex (const char* szExtension) const {
         return static_cast<size_t>(-1);
     }
     ext = ai_tolower(ext);
-    std::set<std::string> str;
-    for (std::vector<BaseImporter*>::const_iterator i =  pimpl->mImporter.begin();i != pimpl->mImporter.end();++i)  {
-        str.clear();
-
-        (*i)->GetExtensionList(str);
-        for (std::set<std::string>::const_iterator it = str.begin(); it != str.end(); ++it) {
-            if (ext == *it) {
-                return std::distance(static_cast< std::vector<BaseImporter*>::const_iterator >(pimpl->mImporter.begin()), i);
+    const std::string::size_type pos = ext.find_last_of('.');
+    ImporterPimpl::ExtensionIndexMap::const_iterator it = pimpl->mExtensionIndex.find(pos == std::string::npos ? ext : ext.substr(pos + 1));
+    if (it != pimpl->mExtensionIndex.end()) {
+        for (const ImporterPimpl::ExtensionIndexEntry &entry : it->second) {
+            if (ext == entry.extension) {
+                return entry.importerIndex;
             }
         }
     }
@@ -1277,3 +1420,44 @@ void Importer::GetMemoryRequirements(aiMemoryInfo& in) const {
 
     in.total += in.materials;
 }
+
+// ------------------------------------------------------------------------------------------------
+// Get the runtime statistics of the last import
+void Importer::GetImportStatistics(aiImportStatistics& in) const {
+    ai_assert(nullptr != pimpl);
+
+    in = pimpl->mStatistics;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Get the runtime statistics of the last import as JSON object
+std::string Importer::GetImportStatisticsJSON() const {
+    ai_assert(nullptr != pimpl);
+
+    const aiImportStatistics &stats = pimpl->mStatistics;
+    std::ostringstream out;
+    out.imbue(std::locale::classic());
+    out.precision(9);
+    out << "{\"totalTime\":" << stats.totalTime
+        << ",\"importTime\":" << stats.importTime
+        << ",\"preprocessTime\":" << stats.preprocessTime
+        << ",\"postprocessTime\":" << stats.postprocessTime
+        << ",\"bytesRead\":" << stats.bytesRead
+        << ",\"processPeakMemory\":" << stats.processPeakMemory
+        << ",\"regions\":[";
+    for (unsigned int i = 0; i < stats.numRegions; ++i) {
+        const aiProfileRegion &region = stats.regions[i];
+        out << (i ? "," : "") << "{\"name\":\"";
+        for (const char *c = region.name.C_Str(); *c; ++c) {
+            if ('"' == *c || '\\' == *c) {
+                out << '\\';
+            }
+            out << *c;
+        }
+        out << "\",\"depth\":" << region.depth
+            << ",\"seconds\":" << region.seconds << "}";
+    }
+    out << "]}";
+
+    return out.str();
+}
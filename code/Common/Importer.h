@@ -46,9 +46,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <exception>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <string>
 #include <assimp/matrix4x4.h>
+#include <assimp/types.h>
 
 struct aiScene;
 
@@ -58,6 +60,11 @@ namespace Assimp {
     class BaseImporter;
     class BaseProcess;
     class SharedPostProcessInfo;
+    class ThreadPool;
+
+    namespace Profiling {
+        class Profiler;
+    }
 
 
 //! @cond never
@@ -80,6 +87,15 @@ public:
     using MatrixPropertyMap = std::map<KeyType, aiMatrix4x4>;
     using PointerPropertyMap = std::map<KeyType, void*>;
 
+    // An importer claiming a file extension
+    struct ExtensionIndexEntry {
+        unsigned int importerIndex;
+        std::string extension;
+    };
+
+    // Importers by the part of their extensions behind the last dot, in registration order
+    using ExtensionIndexMap = std::unordered_map<std::string, std::vector<ExtensionIndexEntry>>;
+
     /** IO handler to use for all file accesses. */
     IOSystem* mIOHandler;
     bool mIsDefaultHandler;
@@ -91,6 +107,9 @@ public:
     /** Format-specific importer worker objects - one for each format we can read.*/
     std::vector< BaseImporter* > mImporter;
 
+    /** Lookup table for the file extensions of mImporter, rebuilt whenever it changes. */
+    ExtensionIndexMap mExtensionIndex;
+
     /** Post processing steps we can apply at the imported data. */
     std::vector< BaseProcess* > mPostProcessingSteps;
 
@@ -126,6 +145,21 @@ public:
     /** Used by post-process steps to share data */
     SharedPostProcessInfo* mPPShared;
 
+    /** Worker threads for post-process steps, nullptr if they run serially */
+    ThreadPool* mThreadPool;
+
+    /** Timings of the last import, nullptr if AI_CONFIG_GLOB_MEASURE_TIME is not set */
+    Profiling::Profiler* mProfiler;
+
+    /** Number of bytes read by the last import */
+    uint64_t mBytesRead;
+
+    /** Statistics of the last import, see Importer::GetImportStatistics() */
+    aiImportStatistics mStatistics;
+
+    /** Storage for the regions referenced by mStatistics */
+    std::vector<aiProfileRegion> mStatisticsRegions;
+
     /// The default class constructor.
     ImporterPimpl() AI_NO_EXCEPT;
 
@@ -139,6 +173,7 @@ inline ImporterPimpl::ImporterPimpl() AI_NO_EXCEPT :
         mProgressHandler( nullptr ),
         mIsDefaultProgressHandler( false ),
         mImporter(),
+        mExtensionIndex(),
         mPostProcessingSteps(),
         mScene( nullptr ),
         mErrorString(),
@@ -149,7 +184,12 @@ inline ImporterPimpl::ImporterPimpl() AI_NO_EXCEPT :
         mMatrixProperties(),
         mPointerProperties(),
         bExtraVerbose( false ),
-        mPPShared( nullptr ) {
+        mPPShared( nullptr ),
+        mThreadPool( nullptr ),
+        mProfiler( nullptr ),
+        mBytesRead( 0 ),
+        mStatistics(),
+        mStatisticsRegions() {
     // empty
 }
 //! @endcond
@@ -160,8 +200,9 @@ struct BatchData;
 /** FOR IMPORTER PLUGINS ONLY: A helper class to the pleasure of importers
  *  that need to load many external meshes recursively.
  *
- *  The class uses several threads to load these meshes (or at least it
- *  could, this has not yet been implemented at the moment).
+ *  By default all meshes are loaded one after another by a single importer.
+ *  If more than one thread is requested (see setNumThreads()), every load
+ *  request is processed by its own importer instance on a worker pool.
  *
  *  @note The class may not be used by more than one thread*/
 class ASSIMP_API BatchLoader {
@@ -210,6 +251,20 @@ public:
      */
     bool getValidation() const;
 
+    // -------------------------------------------------------------------
+    /** Sets the number of threads used by LoadAll().
+     *  @param  numThreads  1 for serial loading (the default), 0 for the
+     *          number of hardware threads.
+     *  @see AI_CONFIG_IMPORT_BATCH_LOADER_THREADS
+     */
+    void setNumThreads( unsigned int numThreads );
+
+    // -------------------------------------------------------------------
+    /** Returns the number of threads used by LoadAll().
+     *  @return The number of threads, 0 for the number of hardware threads.
+     */
+    unsigned int getNumThreads() const;
+
     // -------------------------------------------------------------------
     /** Add a new file to the list of files to be loaded.
      *  @param file File to be loaded
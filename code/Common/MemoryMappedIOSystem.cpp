@@ -0,0 +1,284 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+/** @file Implementation of IOSystem which memory-maps files opened for reading */
+
+#include <assimp/MemoryMappedIOSystem.h>
+#include <assimp/ai_assert.h>
+#include <assimp/DefaultLogger.hpp>
+
+#include <cstring>
+#include <algorithm>
+
+#ifdef _WIN32
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+using namespace Assimp;
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Only read-only binary modes are mapped, everything else goes to the fallback system
+bool CanMapMode(const char *strMode) {
+    if (nullptr == strMode || 'r' != strMode[0]) {
+        return false;
+    }
+#ifdef _WIN32
+    // "r" opens in text mode here, which translates line endings
+    if (nullptr == ::strchr(strMode, 'b')) {
+        return false;
+    }
+#endif
+    return nullptr == ::strpbrk(strMode, "wa+t");
+}
+
+#ifdef _WIN32
+// ------------------------------------------------------------------------------------------------
+std::wstring Utf8ToWide(const char *in) {
+    int size = MultiByteToWideChar(CP_UTF8, 0, in, -1, nullptr, 0);
+    if (size <= 0) {
+        return std::wstring();
+    }
+    std::wstring out(static_cast<size_t>(size) - 1, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, in, -1, &out[0], size);
+    return out;
+}
+
+// ------------------------------------------------------------------------------------------------
+uint8_t *MapFile(const char *strFile, size_t &size) {
+    const std::wstring name = Utf8ToWide(strFile);
+    if (name.empty()) {
+        return nullptr;
+    }
+
+    HANDLE file = ::CreateFileW(name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (INVALID_HANDLE_VALUE == file) {
+        return nullptr;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!::GetFileSizeEx(file, &fileSize) || 0 == fileSize.QuadPart ||
+            static_cast<unsigned long long>(fileSize.QuadPart) > SIZE_MAX) {
+        ::CloseHandle(file);
+        return nullptr;
+    }
+
+    // the view keeps the mapping and the file alive, so both handles can be closed right away
+    HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    ::CloseHandle(file);
+    if (nullptr == mapping) {
+        return nullptr;
+    }
+    void *data = ::MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    ::CloseHandle(mapping);
+    if (nullptr == data) {
+        return nullptr;
+    }
+
+    size = static_cast<size_t>(fileSize.QuadPart);
+    return static_cast<uint8_t *>(data);
+}
+
+// ------------------------------------------------------------------------------------------------
+void UnmapFile(uint8_t *data, size_t) {
+    ::UnmapViewOfFile(data);
+}
+#else
+// ------------------------------------------------------------------------------------------------
+uint8_t *MapFile(const char *strFile, size_t &size) {
+    const int fd = ::open(strFile, O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat statbuf;
+    if (0 != ::fstat(fd, &statbuf) || !S_ISREG(statbuf.st_mode) || 0 == statbuf.st_size) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    // map copy-on-write, so accidental writes by an importer never reach the file
+    const size_t fileSize = static_cast<size_t>(statbuf.st_size);
+    void *data = ::mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (MAP_FAILED == data) {
+        return nullptr;
+    }
+#ifdef POSIX_MADV_SEQUENTIAL
+    ::posix_madvise(data, fileSize, POSIX_MADV_SEQUENTIAL);
+#endif
+
+    size = fileSize;
+    return static_cast<uint8_t *>(data);
+}
+
+// ------------------------------------------------------------------------------------------------
+void UnmapFile(uint8_t *data, size_t size) {
+    ::munmap(data, size);
+}
+#endif
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+MemoryMappedIOStream::MemoryMappedIOStream(uint8_t *data, size_t size) AI_NO_EXCEPT :
+        mData(data),
+        mSize(size),
+        mPos(0) {
+    ai_assert(nullptr != data);
+}
+
+// ------------------------------------------------------------------------------------------------
+MemoryMappedIOStream::~MemoryMappedIOStream() {
+    UnmapFile(mData, mSize);
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::Read(void *pvBuffer, size_t pSize, size_t pCount) {
+    ai_assert(nullptr != pvBuffer);
+    if (0 == pSize || 0 == pCount) {
+        return 0;
+    }
+
+    const size_t cnt = std::min(pCount, (mSize - mPos) / pSize);
+    const size_t ofs = pSize * cnt;
+    ::memcpy(pvBuffer, mData + mPos, ofs);
+    mPos += ofs;
+
+    return cnt;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::Write(const void *, size_t, size_t) {
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+aiReturn MemoryMappedIOStream::Seek(size_t pOffset, aiOrigin pOrigin) {
+    if (aiOrigin_SET == pOrigin) {
+        if (pOffset > mSize) {
+            return AI_FAILURE;
+        }
+        mPos = pOffset;
+    } else if (aiOrigin_END == pOrigin) {
+        if (pOffset > mSize) {
+            return AI_FAILURE;
+        }
+        mPos = mSize - pOffset;
+    } else {
+        if (pOffset > mSize - mPos) {
+            return AI_FAILURE;
+        }
+        mPos += pOffset;
+    }
+    return AI_SUCCESS;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::Tell() const {
+    return mPos;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::FileSize() const {
+    return mSize;
+}
+
+// ------------------------------------------------------------------------------------------------
+void MemoryMappedIOStream::Flush() {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+const uint8_t *MemoryMappedIOStream::GetMemoryView() const {
+    return mData;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Tests for the existence of a file at the given path.
+bool MemoryMappedIOSystem::Exists(const char *pFile) const {
+    return mFallback.Exists(pFile);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Returns the operation specific directory separator
+char MemoryMappedIOSystem::getOsSeparator() const {
+    return mFallback.getOsSeparator();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Open a new file with a given path.
+IOStream *MemoryMappedIOSystem::Open(const char *strFile, const char *strMode) {
+    ai_assert(strFile != nullptr);
+    ai_assert(strMode != nullptr);
+
+    if (CanMapMode(strMode)) {
+        size_t size = 0;
+        uint8_t *data = MapFile(strFile, size);
+        if (nullptr != data) {
+            return new MemoryMappedIOStream(data, size);
+        }
+        ASSIMP_LOG_VERBOSE_DEBUG("Unable to map ", strFile, ", falling back to buffered IO");
+    }
+
+    return mFallback.Open(strFile, strMode);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Closes the given file and releases all resources associated with it.
+void MemoryMappedIOSystem::Close(IOStream *pFile) {
+    delete pFile;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Compare two paths
+bool MemoryMappedIOSystem::ComparePaths(const char *one, const char *second) const {
+    return mFallback.ComparePaths(one, second);
+}
@@ -882,24 +882,46 @@ void SceneCombiner::MergeMeshes(aiMesh **_out, unsigned int /*flags*/,
 
     if (out->mNumFaces) // just for safety
     {
-        // copy faces
+        // copy faces. If any of the meshes keeps its indices in one block, the
+        // output does so, too. The indices are copied to the new block then,
+        // otherwise the index arrays of the faces are reused.
         out->mFaces = new aiFace[out->mNumFaces];
         aiFace *pf2 = out->mFaces;
 
+        unsigned int *storage = nullptr;
+        for (std::vector<aiMesh *>::const_iterator it = begin; it != end; ++it) {
+            if (nullptr != (*it)->mFaceIndexStorage) {
+                unsigned int numIndices = 0;
+                for (std::vector<aiMesh *>::const_iterator it2 = begin; it2 != end; ++it2) {
+                    for (unsigned int m = 0; m < (*it2)->mNumFaces; ++m) {
+                        numIndices += (*it2)->mFaces[m].mNumIndices;
+                    }
+                }
+                storage = out->AllocateFaceIndexStorage(numIndices);
+                break;
+            }
+        }
+
         unsigned int ofs = 0;
         for (std::vector<aiMesh *>::const_iterator it = begin; it != end; ++it) {
             for (unsigned int m = 0; m < (*it)->mNumFaces; ++m, ++pf2) {
                 aiFace &face = (*it)->mFaces[m];
                 pf2->mNumIndices = face.mNumIndices;
-                pf2->mIndices = face.mIndices;
+                if (nullptr == storage) {
+                    pf2->mIndices = face.mIndices;
+                    face.mIndices = nullptr;
+                } else if (face.mNumIndices) {
+                    pf2->mIndices = storage;
+                    ::memcpy(storage, face.mIndices, face.mNumIndices * sizeof(unsigned int));
+                    storage += face.mNumIndices;
+                }
 
                 if (ofs) {
                     // add the offset to the vertex
-                    for (unsigned int q = 0; q < face.mNumIndices; ++q) {
-                        face.mIndices[q] += ofs;
+                    for (unsigned int q = 0; q < pf2->mNumIndices; ++q) {
+                        pf2->mIndices[q] += ofs;
                     }
                 }
-                face.mIndices = nullptr;
             }
             ofs += (*it)->mNumVertices;
         }
@@ -1098,8 +1120,25 @@ void SceneCombiner::Copy(aiMesh **_dest, const aiMesh *src) {
     // make a deep copy of all bones
     CopyPtrArray(dest->mBones, dest->mBones, dest->mNumBones);
 
-    // make a deep copy of all faces
-    GetArrayCopy(dest->mFaces, dest->mNumFaces);
+    // make a deep copy of all faces, faces in the shared index storage
+    // are moved to a copy of the storage
+    if (nullptr != src->mFaceIndexStorage) {
+        dest->mFaces = new aiFace[dest->mNumFaces];
+        dest->mFaceIndexStorage = nullptr;
+        unsigned int *storage = dest->AllocateFaceIndexStorage(src->mNumFaceIndexStorage);
+        ::memcpy(storage, src->mFaceIndexStorage, src->mNumFaceIndexStorage * sizeof(unsigned int));
+        for (unsigned int i = 0; i < dest->mNumFaces; ++i) {
+            const aiFace &face = src->mFaces[i];
+            if (src->IsInFaceIndexStorage(face)) {
+                dest->mFaces[i].mNumIndices = face.mNumIndices;
+                dest->mFaces[i].mIndices = storage + (face.mIndices - src->mFaceIndexStorage);
+            } else {
+                dest->mFaces[i] = face;
+            }
+        }
+    } else {
+        GetArrayCopy(dest->mFaces, dest->mNumFaces);
+    }
 
     // make a deep copy of all blend shapes
     CopyPtrArray(dest->mAnimMeshes, dest->mAnimMeshes, dest->mNumAnimMeshes);
@@ -48,15 +48,21 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/ai_assert.h>
 #include <assimp/scene.h>
 
+#include <mutex>
+
 namespace Assimp {
 
 // Forward declarations
 class Importer;
+class StackAllocator;
 
 struct ScenePrivateData {
     //  The struct constructor.
     ScenePrivateData() AI_NO_EXCEPT;
 
+    //  The struct destructor, releases the memory arena.
+    ~ScenePrivateData();
+
     // Importer that originally loaded the scene though the C-API
     // If set, this object is owned by this private data instance.
     Assimp::Importer* mOrigImporter;
@@ -70,13 +76,21 @@ struct ScenePrivateData {
     // and mOrigImporter are no longer safe to rely on and only
     // serve informative purposes.
     bool mIsCopy;
+
+    // Memory arena for data owned by the scene as a whole, see
+    // AI_CONFIG_IMPORT_SCENE_ARENA. nullptr if the scene doesn't use one.
+    StackAllocator* mArena;
+
+    // Serializes allocations from mArena.
+    std::mutex mArenaMutex;
 };
 
 inline
 ScenePrivateData::ScenePrivateData() AI_NO_EXCEPT
 : mOrigImporter( nullptr )
 , mPPStepsApplied( 0 )
-, mIsCopy( false ) {
+, mIsCopy( false )
+, mArena( nullptr ) {
     // empty
 }
 
@@ -99,6 +113,17 @@ const ScenePrivateData* ScenePriv(const aiScene* in) {
     return static_cast<const ScenePrivateData*>(in->mPrivate);
 }
 
+// Give the scene a memory arena, if it has none yet
+void EnableSceneArena(aiScene* in);
+
+// Allocate numIndices face indices in the memory arena of the scene.
+// Returns nullptr if the scene is nullptr or has no arena.
+unsigned int* AllocateArenaFaceIndices(aiScene* in, unsigned int numIndices);
+
+// Same as aiMesh::AllocateFaceIndexStorage(), but the storage is taken
+// from the memory arena of the scene if it has one.
+unsigned int* AllocateFaceIndexStorage(aiScene* in, aiMesh* mesh, unsigned int numIndices);
+
 } // Namespace Assimp
 
 #endif // AI_SCENEPRIVATE_H_INCLUDED
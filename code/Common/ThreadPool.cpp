@@ -0,0 +1,202 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file  ThreadPool.cpp
+ *  @brief Implementation of the ThreadPool helper class.
+ */
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace Assimp {
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// State shared between the caller of ParallelFor and the jobs it has queued.
+// Jobs may be dequeued after ParallelFor has returned, so the state is kept
+// alive by the jobs themselves.
+struct ParallelForState {
+    ParallelForState(size_t count, const std::function<void(size_t)> &func) :
+            mCount(count), mNext(0), mFunc(func), mRunning(0), mClosed(false), mError() {
+        // empty
+    }
+
+    // Processes work items until there are none left.
+    void Drain() {
+        for (size_t i = mNext++; i < mCount; i = mNext++) {
+            try {
+                mFunc(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mMutex);
+                if (!mError) {
+                    mError = std::current_exception();
+                }
+                mNext = mCount;
+            }
+        }
+    }
+
+    const size_t mCount;
+    std::atomic<size_t> mNext;
+    const std::function<void(size_t)> &mFunc;
+
+    std::mutex mMutex;
+    std::condition_variable mDone;
+    unsigned int mRunning;
+    bool mClosed;
+    std::exception_ptr mError;
+};
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+ThreadPool::ThreadPool(unsigned int numThreads) :
+        mWorkers(), mJobs(), mMutex(), mCondition(), mStop(false) {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    if (0 == numThreads) {
+        numThreads = GetHardwareConcurrency();
+    }
+
+    // the calling thread does its share of the work as well
+    for (unsigned int i = 1; i < numThreads; ++i) {
+        mWorkers.emplace_back(&ThreadPool::WorkerLoop, this);
+    }
+#else
+    (void)numThreads;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+    }
+    mCondition.notify_all();
+    for (std::thread &worker : mWorkers) {
+        worker.join();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int ThreadPool::GetNumThreads() const {
+    return static_cast<unsigned int>(mWorkers.size()) + 1;
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int ThreadPool::GetHardwareConcurrency() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// ------------------------------------------------------------------------------------------------
+void ThreadPool::ParallelFor(size_t count, const std::function<void(size_t)> &func) {
+    if (mWorkers.empty() || count < 2) {
+        for (size_t i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    auto state = std::make_shared<ParallelForState>(count, func);
+    const size_t numJobs = std::min(mWorkers.size(), count - 1);
+    for (size_t i = 0; i < numJobs; ++i) {
+        Enqueue([state]() {
+            {
+                // Jobs which are picked up after the caller has finished do
+                // nothing: the caller has already stopped waiting for them and
+                // mFunc may be gone.
+                std::lock_guard<std::mutex> lock(state->mMutex);
+                if (state->mClosed) {
+                    return;
+                }
+                ++state->mRunning;
+            }
+            state->Drain();
+            {
+                std::lock_guard<std::mutex> lock(state->mMutex);
+                --state->mRunning;
+            }
+            state->mDone.notify_all();
+        });
+    }
+
+    state->Drain();
+
+    std::unique_lock<std::mutex> lock(state->mMutex);
+    state->mClosed = true;
+    state->mDone.wait(lock, [&state]() { return 0 == state->mRunning; });
+    if (state->mError) {
+        std::rethrow_exception(state->mError);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ThreadPool::Enqueue(std::function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mJobs.emplace_back(std::move(job));
+    }
+    mCondition.notify_one();
+}
+
+// ------------------------------------------------------------------------------------------------
+void ThreadPool::WorkerLoop() {
+    for (;;) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondition.wait(lock, [this]() { return mStop || !mJobs.empty(); });
+            if (mStop && mJobs.empty()) {
+                return;
+            }
+            job = std::move(mJobs.front());
+            mJobs.pop_front();
+        }
+        job();
+    }
+}
+
+} // namespace Assimp
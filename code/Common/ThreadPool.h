@@ -0,0 +1,121 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------
+*/
+
+
+/** @file  ThreadPool.h
+ *  @brief A small fixed-size worker pool used to run independent work
+ *      items (external files, meshes, array blocks, ...) concurrently.
+ */
+#pragma once
+#ifndef AI_THREADPOOL_H_INC
+#define AI_THREADPOOL_H_INC
+
+#include <assimp/defs.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** @brief A very bare-bone thread pool.
+ *
+ *  The pool owns a fixed number of worker threads. Work is handed out through
+ *  ParallelFor(), which blocks until all work items have been processed. The
+ *  calling thread takes part in the work, so ParallelFor() may safely be
+ *  nested (e.g. called from within a work item).
+ *
+ *  If assimp has been built with ASSIMP_BUILD_SINGLETHREADED (a CMake option,
+ *  off by default) no worker threads are spawned and all work is executed on
+ *  the calling thread.
+ */
+class ASSIMP_API ThreadPool {
+public:
+    /// @brief  The class constructor.
+    /// @param  numThreads  The total number of threads working on a ParallelFor()
+    ///         call, including the calling thread. 0 selects the number of
+    ///         hardware threads.
+    explicit ThreadPool(unsigned int numThreads = 0);
+
+    /// @brief  The class destructor, joins all worker threads.
+    ~ThreadPool();
+
+    // non copyable
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /// @brief  Returns the number of threads taking part in a ParallelFor()
+    ///         call, including the calling thread.
+    /// @return The number of threads, at least 1.
+    unsigned int GetNumThreads() const;
+
+    /// @brief  Calls func(i) for every i in [0, count). The order in which the
+    ///         items are processed is unspecified.
+    ///
+    /// The first exception thrown by a work item stops the distribution of
+    /// further items and is rethrown on the calling thread once all running
+    /// items have finished.
+    /// @param  count   The number of work items.
+    /// @param  func    The work item callback.
+    void ParallelFor(size_t count, const std::function<void(size_t)> &func);
+
+    /// @brief  Returns the number of hardware threads, at least 1.
+    static unsigned int GetHardwareConcurrency();
+
+private:
+    void WorkerLoop();
+    void Enqueue(std::function<void()> job);
+
+private:
+    std::vector<std::thread> mWorkers;
+    std::deque<std::function<void()>> mJobs;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mStop;
+};
+
+} // namespace Assimp
+
+#endif // AI_THREADPOOL_H_INC
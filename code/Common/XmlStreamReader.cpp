@@ -0,0 +1,719 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file  XmlStreamReader.cpp
+ *  @brief Implementation of the pull based xml reader
+ */
+
+#include <assimp/XmlStreamReader.h>
+#include <assimp/Exceptional.h>
+#include <assimp/IOStream.hpp>
+#include <assimp/StringUtils.h>
+#include <assimp/fast_atof.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace Assimp {
+
+namespace {
+
+// Longest entity which is decoded, "&#x10FFFF;"
+constexpr size_t MaxEntityLength = 10;
+
+inline bool IsXmlSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+inline bool IsNameEnd(char c) {
+    return IsXmlSpace(c) || c == '/' || c == '>' || c == '=';
+}
+
+void AppendUtf8(unsigned long cp, std::string &out) {
+    if (cp < 0x80) {
+        out += static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        out += static_cast<char>(0xC0 | (cp >> 6));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        out += static_cast<char>(0xE0 | (cp >> 12));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (cp >> 18));
+        out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+// Decodes the entity c points to and returns the position behind it. Unknown
+// entities are kept as they are, just like pugixml does it.
+const char *DecodeEntity(const char *c, const char *end, std::string &out) {
+    const char *limit = (static_cast<size_t>(end - c) > MaxEntityLength) ? c + MaxEntityLength : end;
+    const char *semicolon = c + 1;
+    while (semicolon != limit && *semicolon != ';') {
+        ++semicolon;
+    }
+    if (semicolon == limit) {
+        out += '&';
+        return c + 1;
+    }
+
+    const std::string name(c + 1, semicolon);
+    if (name == "lt") {
+        out += '<';
+    } else if (name == "gt") {
+        out += '>';
+    } else if (name == "amp") {
+        out += '&';
+    } else if (name == "quot") {
+        out += '"';
+    } else if (name == "apos") {
+        out += '\'';
+    } else if (name.size() > 1 && name[0] == '#') {
+        char *numberEnd = nullptr;
+        const bool hex = name[1] == 'x';
+        const unsigned long cp = std::strtoul(name.c_str() + (hex ? 2 : 1), &numberEnd, hex ? 16 : 10);
+        if (*numberEnd != '\0' || cp > 0x10FFFF) {
+            out.append(c, semicolon + 1);
+        } else {
+            AppendUtf8(cp, out);
+        }
+    } else {
+        out.append(c, semicolon + 1);
+    }
+    return semicolon + 1;
+}
+
+// Decodes an attribute value, whitespace characters are normalized to spaces
+void DecodeAttribute(const char *c, const char *end, std::string &out) {
+    out.clear();
+    while (c != end) {
+        if (*c == '&') {
+            c = DecodeEntity(c, end, out);
+        } else if (*c == '\r') {
+            out += ' ';
+            if (++c != end && *c == '\n') {
+                ++c;
+            }
+        } else if (*c == '\n' || *c == '\t') {
+            out += ' ';
+            ++c;
+        } else {
+            out += *c++;
+        }
+    }
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+XmlStreamReader::XmlStreamReader(IOStream *stream, size_t blockSize) :
+        mStream(stream),
+        mBlockSize(std::max<size_t>(blockSize, 64)),
+        mPos(0),
+        mEnd(0),
+        mEof(nullptr == stream),
+        mEvent(EndOfDocument),
+        mNumAttributes(0),
+        mIsEmpty(false),
+        mPendingEnd(false),
+        mPendingPop(false),
+        mTagBegin(0),
+        mTagEnd(0),
+        mCapture(nullptr),
+        mCaptureFrom(0) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+bool XmlStreamReader::isSupportedEncoding() {
+    available(4);
+    const unsigned char *data = reinterpret_cast<const unsigned char *>(mBuffer.data()) + mPos;
+    const size_t size = mEnd - mPos;
+    if (size >= 3 && data[0] == 0xEF && data[1] == 0xBB && data[2] == 0xBF) {
+        // UTF-8 byte order mark
+        mPos += 3;
+        mCaptureFrom = mPos;
+        return isSupportedEncoding();
+    }
+    if (size >= 2 && ((data[0] == 0xFE && data[1] == 0xFF) || (data[0] == 0xFF && data[1] == 0xFE))) {
+        return false;
+    }
+    if (size >= 2 && (data[0] == 0 || data[1] == 0)) {
+        // UTF-16 or UTF-32 without byte order mark
+        return false;
+    }
+
+    // look at the encoding given in the xml declaration
+    static constexpr char Declaration[] = "<?xml";
+    if (size < 5 || 0 != std::strncmp(mBuffer.data() + mPos, Declaration, 5)) {
+        return true;
+    }
+    const char *begin = mBuffer.data() + mPos;
+    const char *end = mBuffer.data() + mEnd;
+    static constexpr char DeclarationEnd[] = "?>";
+    const std::string declaration(begin, std::search(begin, end, DeclarationEnd, DeclarationEnd + 2));
+    size_t pos = declaration.find("encoding");
+    if (pos == std::string::npos || (pos = declaration.find_first_of("\"'", pos)) == std::string::npos) {
+        return true;
+    }
+    const size_t close = declaration.find(declaration[pos], pos + 1);
+    const std::string encoding = ai_tolower(declaration.substr(pos + 1, close - pos - 1));
+    return encoding == "utf-8" || encoding == "utf8" || encoding == "us-ascii" || encoding == "ascii";
+}
+
+// ------------------------------------------------------------------------------------------------
+XmlStreamReader::EventType XmlStreamReader::next() {
+    for (;;) {
+        mText.clear();
+        const EventType event = nextEvent(&mText);
+        if (event != Text || mText.find_first_not_of(" \t\r\n") != std::string::npos) {
+            return event;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+XmlStreamReader::EventType XmlStreamReader::getEvent() const {
+    return mEvent;
+}
+
+// ------------------------------------------------------------------------------------------------
+const std::string &XmlStreamReader::getName() const {
+    return mName;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t XmlStreamReader::getDepth() const {
+    return mPath.size();
+}
+
+// ------------------------------------------------------------------------------------------------
+const std::vector<std::string> &XmlStreamReader::getPath() const {
+    return mPath;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool XmlStreamReader::isEmptyElement() const {
+    return mIsEmpty;
+}
+
+// ------------------------------------------------------------------------------------------------
+const std::string &XmlStreamReader::getText() const {
+    return mText;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool XmlStreamReader::hasAttribute(const char *name) const {
+    return nullptr != findAttribute(name);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool XmlStreamReader::getStdStrAttribute(const char *name, std::string &val) const {
+    const Attribute *attribute = findAttribute(name);
+    if (nullptr == attribute) {
+        return false;
+    }
+
+    val = attribute->second;
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool XmlStreamReader::getUIntAttribute(const char *name, unsigned int &val) const {
+    const Attribute *attribute = findAttribute(name);
+    if (nullptr == attribute) {
+        return false;
+    }
+
+    const char *c = attribute->second.c_str();
+    while (IsXmlSpace(*c)) {
+        ++c;
+    }
+    val = (c[0] == '0' && (c[1] == 'x' || c[1] == 'X')) ? strtoul16(c + 2) : strtoul10(c);
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool XmlStreamReader::getIntAttribute(const char *name, int &val) const {
+    const Attribute *attribute = findAttribute(name);
+    if (nullptr == attribute) {
+        return false;
+    }
+
+    const char *c = attribute->second.c_str();
+    while (IsXmlSpace(*c)) {
+        ++c;
+    }
+    val = strtol10(c);
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool XmlStreamReader::getRealAttribute(const char *name, ai_real &val) const {
+    const Attribute *attribute = findAttribute(name);
+    if (nullptr == attribute) {
+        return false;
+    }
+
+    val = static_cast<ai_real>(std::strtod(attribute->second.c_str(), nullptr));
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void XmlStreamReader::readElementText(std::string &text) {
+    ai_assert(mEvent == StartElement);
+    text.clear();
+    for (;;) {
+        const EventType event = nextEvent(&text);
+        if (event == StartElement) {
+            skipElement();
+        } else if (event == EndElement) {
+            return;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void XmlStreamReader::skipElement() {
+    ai_assert(mEvent == StartElement);
+    const size_t depth = mPath.size();
+    while (nextEvent(nullptr) != EndElement || mPath.size() != depth) {
+        // empty
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+XmlNode XmlStreamReader::readSubtree(pugi::xml_document &doc) {
+    ai_assert(mEvent == StartElement);
+    std::string xml(mBuffer.data() + mTagBegin, mTagEnd - mTagBegin);
+    if (mIsEmpty) {
+        nextEvent(nullptr);
+    } else {
+        // the children are captured into the text of the element, and handed on to
+        // an outer capture afterwards
+        std::string *outer = mCapture;
+        flushCapture();
+        mCapture = &xml;
+        const size_t bodyBegin = xml.size();
+        skipElement();
+        flushCapture();
+        mCapture = outer;
+        if (nullptr != outer) {
+            outer->append(xml, bodyBegin, std::string::npos);
+        }
+    }
+
+    doc.reset();
+    const pugi::xml_parse_result result = doc.load_buffer(xml.data(), xml.size(), pugi::parse_full);
+    if (result.status != pugi::status_ok) {
+        throw DeadlyImportError("XML: unable to read <", mName, ">: ", result.description());
+    }
+    return doc.first_child();
+}
+
+// ------------------------------------------------------------------------------------------------
+void XmlStreamReader::setCapture(std::string *sink) {
+    flushCapture();
+    mCapture = sink;
+}
+
+// ------------------------------------------------------------------------------------------------
+XmlStreamReader::EventType XmlStreamReader::nextEvent(std::string *text) {
+    if (mPendingPop) {
+        mPath.pop_back();
+        mPendingPop = false;
+    }
+    if (mPendingEnd) {
+        // the synthetic end tag of an empty element
+        mPendingEnd = false;
+        mPendingPop = true;
+        return mEvent = EndElement;
+    }
+
+    for (;;) {
+        if (mPos == mEnd && 0 == fill()) {
+            if (!mPath.empty()) {
+                throw DeadlyImportError("XML: unexpected end of file, <", mPath.back(), "> is not closed.");
+            }
+            return mEvent = EndOfDocument;
+        }
+
+        if (mBuffer[mPos] != '<') {
+            // text outside of the root element is ignored
+            readText(mPath.empty() ? nullptr : text);
+            if (mPath.empty()) {
+                continue;
+            }
+            return mEvent = Text;
+        }
+
+        if (!available(2)) {
+            throw DeadlyImportError("XML: unexpected end of file.");
+        }
+        const char kind = mBuffer[mPos + 1];
+        if (kind == '?') {
+            skipPast("?>", nullptr);
+            continue;
+        }
+        if (kind == '!') {
+            available(9);
+            const char *markup = mBuffer.data() + mPos;
+            const size_t size = mEnd - mPos;
+            if (size >= 4 && 0 == std::strncmp(markup, "<!--", 4)) {
+                mPos += 4;
+                skipPast("-->", nullptr);
+                continue;
+            }
+            if (size >= 9 && 0 == std::strncmp(markup, "<![CDATA[", 9)) {
+                mPos += 9;
+                skipPast("]]>", mPath.empty() ? nullptr : text);
+                if (mPath.empty()) {
+                    continue;
+                }
+                return mEvent = Text;
+            }
+            if (size >= 9 && 0 == std::strncmp(markup, "<!DOCTYPE", 9)) {
+                mPos += 9;
+                skipDoctype();
+                continue;
+            }
+            throw DeadlyImportError("XML: unsupported markup declaration.");
+        }
+
+        const size_t tagEnd = findTagEnd();
+        if (kind == '/') {
+            parseEndTag(tagEnd);
+            mPendingPop = true;
+            return mEvent = EndElement;
+        }
+        parseStartTag(tagEnd);
+        return mEvent = StartElement;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t XmlStreamReader::fill() {
+    if (mEof) {
+        return 0;
+    }
+
+    // everything in front of the read position has been consumed
+    flushCapture();
+    if (mPos != 0) {
+        std::memmove(mBuffer.data(), mBuffer.data() + mPos, mEnd - mPos);
+        mEnd -= mPos;
+        mPos = 0;
+        mCaptureFrom = 0;
+    }
+    if (mBuffer.size() < mEnd + mBlockSize) {
+        mBuffer.resize(mEnd + mBlockSize);
+    }
+
+    const size_t numRead = mStream->Read(mBuffer.data() + mEnd, 1, mBlockSize);
+    if (0 == numRead) {
+        mEof = true;
+    }
+    mEnd += numRead;
+    return numRead;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool XmlStreamReader::available(size_t count) {
+    while (mEnd - mPos < count) {
+        if (0 == fill()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void XmlStreamReader::flushCapture() {
+    if (nullptr != mCapture && mPos > mCaptureFrom) {
+        mCapture->append(mBuffer.data() + mCaptureFrom, mPos - mCaptureFrom);
+    }
+    mCaptureFrom = mPos;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t XmlStreamReader::findTagEnd() {
+    // the whole tag is kept in the buffer, so it can be parsed in one go
+    size_t offset = 1;
+    char quote = 0;
+    for (;;) {
+        for (; mPos + offset < mEnd; ++offset) {
+            const char c = mBuffer[mPos + offset];
+            if (quote != 0) {
+                if (c == quote) {
+                    quote = 0;
+                }
+            } else if (c == '"' || c == '\'') {
+                quote = c;
+            } else if (c == '>') {
+                return mPos + offset;
+            }
+        }
+        if (0 == fill()) {
+            throw DeadlyImportError("XML: unexpected end of file in a tag.");
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void XmlStreamReader::parseStartTag(size_t tagEnd) {
+    const char *c = mBuffer.data() + mPos + 1;
+    const char *end = mBuffer.data() + tagEnd;
+    const bool empty = end[-1] == '/';
+    if (empty) {
+        --end;
+    }
+
+    const char *nameEnd = c;
+    while (nameEnd != end && !IsNameEnd(*nameEnd)) {
+        ++nameEnd;
+    }
+    if (nameEnd == c) {
+        throw DeadlyImportError("XML: element without a name.");
+    }
+    mName.assign(c, nameEnd);
+
+    mNumAttributes = 0;
+    for (c = nameEnd;;) {
+        while (c != end && IsXmlSpace(*c)) {
+            ++c;
+        }
+        if (c == end) {
+            break;
+        }
+
+        const char *attributeName = c;
+        while (c != end && !IsNameEnd(*c)) {
+            ++c;
+        }
+        const char *attributeNameEnd = c;
+        while (c != end && IsXmlSpace(*c)) {
+            ++c;
+        }
+        if (attributeName == attributeNameEnd || c == end || *c != '=') {
+            throw DeadlyImportError("XML: malformed attribute in <", mName, ">.");
+        }
+        ++c;
+        while (c != end && IsXmlSpace(*c)) {
+            ++c;
+        }
+        if (c == end || (*c != '"' && *c != '\'')) {
+            throw DeadlyImportError("XML: attribute value without quotes in <", mName, ">.");
+        }
+        const char quote = *c++;
+        const char *value = c;
+        while (c != end && *c != quote) {
+            ++c;
+        }
+        if (c == end) {
+            throw DeadlyImportError("XML: unterminated attribute value in <", mName, ">.");
+        }
+
+        // the strings of the attributes are reused to avoid allocations
+        if (mNumAttributes == mAttributes.size()) {
+            mAttributes.emplace_back();
+        }
+        Attribute &attribute = mAttributes[mNumAttributes++];
+        attribute.first.assign(attributeName, attributeNameEnd);
+        DecodeAttribute(value, c, attribute.second);
+        ++c;
+    }
+
+    mPath.push_back(mName);
+    mIsEmpty = empty;
+    mPendingEnd = empty;
+    mTagBegin = mPos;
+    mTagEnd = tagEnd + 1;
+    mPos = tagEnd + 1;
+}
+
+// ------------------------------------------------------------------------------------------------
+void XmlStreamReader::parseEndTag(size_t tagEnd) {
+    const char *c = mBuffer.data() + mPos + 2;
+    const char *end = mBuffer.data() + tagEnd;
+    const char *nameEnd = c;
+    while (nameEnd != end && !IsNameEnd(*nameEnd)) {
+        ++nameEnd;
+    }
+    mName.assign(c, nameEnd);
+    for (c = nameEnd; c != end; ++c) {
+        if (!IsXmlSpace(*c)) {
+            throw DeadlyImportError("XML: malformed end tag </", mName, ">.");
+        }
+    }
+    if (mPath.empty() || mPath.back() != mName) {
+        throw DeadlyImportError("XML: end tag </", mName, "> doesn't match the open element.");
+    }
+
+    mIsEmpty = false;
+    mNumAttributes = 0;
+    mPos = tagEnd + 1;
+}
+
+// ------------------------------------------------------------------------------------------------
+void XmlStreamReader::readText(std::string *text) {
+    for (;;) {
+        if (mPos == mEnd && 0 == fill()) {
+            return;
+        }
+
+        const char *begin = mBuffer.data() + mPos;
+        const char *end = mBuffer.data() + mEnd;
+        if (nullptr == text) {
+            const char *lt = static_cast<const char *>(std::memchr(begin, '<', end - begin));
+            if (nullptr != lt) {
+                mPos += lt - begin;
+                return;
+            }
+            mPos = mEnd;
+            continue;
+        }
+
+        const char *c = begin;
+        while (c != end && *c != '<' && *c != '&' && *c != '\r') {
+            ++c;
+        }
+        text->append(begin, c);
+        mPos += c - begin;
+        if (c == end) {
+            continue;
+        }
+        if (*c == '<') {
+            return;
+        }
+        if (*c == '\r') {
+            // line endings are normalized to '\n'
+            text->push_back('\n');
+            ++mPos;
+            if (available(1) && mBuffer[mPos] == '\n') {
+                ++mPos;
+            }
+            continue;
+        }
+
+        available(MaxEntityLength);
+        const char *entity = mBuffer.data() + mPos;
+        mPos = DecodeEntity(entity, mBuffer.data() + mEnd, *text) - mBuffer.data();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void XmlStreamReader::skipPast(const char *terminator, std::string *text) {
+    const size_t length = std::strlen(terminator);
+    for (;;) {
+        const char *begin = mBuffer.data() + mPos;
+        const char *end = mBuffer.data() + mEnd;
+        const char *found = static_cast<const char *>(std::memchr(begin, terminator[0], end - begin));
+        if (nullptr == found) {
+            if (nullptr != text) {
+                text->append(begin, end);
+            }
+            mPos = mEnd;
+            if (0 == fill()) {
+                throw DeadlyImportError("XML: unexpected end of file, missing \"", terminator, "\".");
+            }
+            continue;
+        }
+
+        if (nullptr != text) {
+            text->append(begin, found);
+        }
+        mPos += found - begin;
+        if (!available(length)) {
+            throw DeadlyImportError("XML: unexpected end of file, missing \"", terminator, "\".");
+        }
+        if (0 == std::strncmp(mBuffer.data() + mPos, terminator, length)) {
+            mPos += length;
+            return;
+        }
+        if (nullptr != text) {
+            text->push_back(mBuffer[mPos]);
+        }
+        ++mPos;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void XmlStreamReader::skipDoctype() {
+    int depth = 0;
+    char quote = 0;
+    for (;;) {
+        if (mPos == mEnd && 0 == fill()) {
+            throw DeadlyImportError("XML: unexpected end of file in the doctype.");
+        }
+
+        const char c = mBuffer[mPos++];
+        if (quote != 0) {
+            if (c == quote) {
+                quote = 0;
+            }
+        } else if (c == '"' || c == '\'') {
+            quote = c;
+        } else if (c == '[') {
+            ++depth;
+        } else if (c == ']') {
+            --depth;
+        } else if (c == '>' && depth <= 0) {
+            return;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+const XmlStreamReader::Attribute *XmlStreamReader::findAttribute(const char *name) const {
+    ai_assert(nullptr != name);
+    for (size_t i = 0; i < mNumAttributes; ++i) {
+        if (mAttributes[i].first == name) {
+            return &mAttributes[i];
+        }
+    }
+    return nullptr;
+}
+
+} // namespace Assimp
@@ -41,6 +41,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 
 #include "ScenePrivate.h"
+#include "StackAllocator.h"
 
 aiScene::aiScene() :
         mFlags(0),
@@ -121,6 +122,35 @@ aiScene::~aiScene() {
     delete static_cast<Assimp::ScenePrivateData *>(mPrivate);
 }
 
+Assimp::ScenePrivateData::~ScenePrivateData() {
+    delete mArena;
+}
+
+void Assimp::EnableSceneArena(aiScene *in) {
+    ScenePrivateData *priv = ScenePriv(in);
+    if (nullptr != priv && nullptr == priv->mArena) {
+        priv->mArena = new StackAllocator();
+    }
+}
+
+unsigned int *Assimp::AllocateArenaFaceIndices(aiScene *in, unsigned int numIndices) {
+    ScenePrivateData *priv = nullptr != in ? ScenePriv(in) : nullptr;
+    if (nullptr == priv || nullptr == priv->mArena) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(priv->mArenaMutex);
+    return static_cast<unsigned int *>(priv->mArena->Allocate(numIndices * sizeof(unsigned int)));
+}
+
+unsigned int *Assimp::AllocateFaceIndexStorage(aiScene *in, aiMesh *mesh, unsigned int numIndices) {
+    unsigned int *storage = AllocateArenaFaceIndices(in, numIndices);
+    if (nullptr == storage) {
+        return mesh->AllocateFaceIndexStorage(numIndices);
+    }
+    mesh->SetFaceIndexStorage(storage, numIndices, true);
+    return storage;
+}
+
 aiNode::aiNode() :
         mName(""),
         mParent(nullptr),
@@ -50,10 +50,171 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/material.h>
 #include <assimp/types.h>
 #include <assimp/DefaultLogger.hpp>
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ------------------------------------------------------------------------------------------------
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#endif
+// ------------------------------------------------------------------------------------------------
 
 using namespace Assimp;
 
+namespace {
+
+// Materials with fewer properties are searched linearly, building an index doesn't pay off
+const unsigned int PropertyIndexMinProperties = 16;
+
+// ------------------------------------------------------------------------------------------------
+// Combines the key, semantic and index of a property into a hash value
+uint32_t ComputePropertyHash(const char *pKey, uint32_t keyLength, unsigned int type, unsigned int index) {
+    uint32_t hash = SuperFastHash(pKey, keyLength);
+    hash = SuperFastHash((const char *)&type, sizeof(unsigned int), hash);
+    return SuperFastHash((const char *)&index, sizeof(unsigned int), hash);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Hash index over the properties of a material. We're bound to the C layout of aiMaterial,
+// so the indices are kept in a table aside, keyed by the material.
+struct PropertyIndex {
+    // The property array the index was built for, to detect changes made to it directly
+    aiMaterialProperty **properties = nullptr;
+    unsigned int numProperties = 0;
+
+    // Position of each property in the array, by ComputePropertyHash()
+    std::unordered_multimap<uint32_t, unsigned int> positions;
+
+    // All keys, sorted. aiGetMaterialProperty() also matches keys which start with
+    // the requested key, these are found next to each other.
+    std::vector<std::string> keys;
+
+    // Returns true if the index covers the current property array of the material
+    bool IsCurrent(const aiMaterial *pMat) const {
+        return properties == pMat->mProperties && numProperties == pMat->mNumProperties;
+    }
+
+    // Brings the index up to date. Properties appended to the same array, by AddBinaryProperty()
+    // or by filling the array directly (SceneCombiner), are added, otherwise it is rebuilt.
+    void Update(const aiMaterial *pMat) {
+        const bool rebuild = properties != pMat->mProperties || numProperties > pMat->mNumProperties;
+        if (rebuild) {
+            positions.clear();
+            keys.clear();
+            numProperties = 0;
+            properties = pMat->mProperties;
+        }
+
+        for (unsigned int i = numProperties; i < pMat->mNumProperties; ++i) {
+            const aiMaterialProperty *prop = pMat->mProperties[i];
+            if (nullptr == prop) {
+                continue;
+            }
+            positions.emplace(ComputePropertyHash(prop->mKey.data, prop->mKey.length, prop->mSemantic, prop->mIndex), i);
+
+            const std::string key(prop->mKey.data);
+            if (rebuild) {
+                keys.push_back(key);
+                continue;
+            }
+            std::vector<std::string>::iterator it = std::lower_bound(keys.begin(), keys.end(), key);
+            if (it == keys.end() || *it != key) {
+                keys.insert(it, key);
+            }
+        }
+        if (rebuild) {
+            std::sort(keys.begin(), keys.end());
+            keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        }
+        numProperties = pMat->mNumProperties;
+    }
+
+    // Looks up a property, the first one in the property array wins
+    const aiMaterialProperty *Find(const aiMaterial *pMat, const char *pKey, unsigned int type, unsigned int idx) const {
+        const size_t keyLength = strlen(pKey);
+        unsigned int first = UINT_MAX;
+
+        // usually just the requested key, but all keys starting with it match
+        for (auto key = std::lower_bound(keys.begin(), keys.end(), pKey);
+                key != keys.end() && 0 == key->compare(0, keyLength, pKey); ++key) {
+            const uint32_t hash = ComputePropertyHash(key->c_str(), static_cast<uint32_t>(key->length()), type, idx);
+            const auto range = positions.equal_range(hash);
+            for (auto it = range.first; it != range.second; ++it) {
+                const aiMaterialProperty *prop = pMat->mProperties[it->second];
+                if (it->second < first && prop->mSemantic == type && prop->mIndex == idx && *key == prop->mKey.data) {
+                    first = it->second;
+                }
+            }
+        }
+
+        return UINT_MAX != first ? pMat->mProperties[first] : nullptr;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// The indices of all materials which have been looked up. An index is built by the first lookup
+// of its material, RemoveProperty(), Clear(), CopyPropertyList() and the destructor drop it.
+class PropertyIndexTable {
+public:
+    // Never destroyed, materials may still be deleted during static destruction
+    static PropertyIndexTable &Get() {
+        static PropertyIndexTable *table = new PropertyIndexTable();
+        return *table;
+    }
+
+    // Looks up a property in the index of the material, building or updating it if needed
+    const aiMaterialProperty *Find(const aiMaterial *pMat, const char *pKey, unsigned int type, unsigned int index) {
+        {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+            std::shared_lock<std::shared_mutex> lock(mMutex);
+#endif
+            IndexMap::const_iterator it = mIndices.find(pMat);
+            if (it != mIndices.end() && it->second.IsCurrent(pMat)) {
+                return it->second.Find(pMat, pKey, type, index);
+            }
+        }
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+        std::unique_lock<std::shared_mutex> lock(mMutex);
+#endif
+        PropertyIndex &propertyIndex = mIndices[pMat];
+        propertyIndex.Update(pMat);
+        mEmpty = false;
+        return propertyIndex.Find(pMat, pKey, type, index);
+    }
+
+    // Drops the index of a material, it is rebuilt by the next lookup
+    void Remove(const aiMaterial *pMat) {
+        // most materials are never looked up while they are built
+        if (mEmpty) {
+            return;
+        }
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+        std::unique_lock<std::shared_mutex> lock(mMutex);
+#endif
+        mIndices.erase(pMat);
+        mEmpty = mIndices.empty();
+    }
+
+private:
+    using IndexMap = std::unordered_map<const aiMaterial *, PropertyIndex>;
+
+    IndexMap mIndices;
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    std::shared_mutex mMutex;
+    std::atomic<bool> mEmpty{ true };
+#else
+    bool mEmpty = true;
+#endif
+};
+
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 // Get a specific property from a material
 aiReturn aiGetMaterialProperty(const aiMaterial *pMat,
@@ -65,10 +226,14 @@ aiReturn aiGetMaterialProperty(const aiMaterial *pMat,
     ai_assert(pKey != nullptr);
     ai_assert(pPropOut != nullptr);
 
-    /*  Just search for a property with exactly this name ..
-     *  could be improved by hashing, but it's possibly
-     *  no worth the effort (we're bound to C structures,
-     *  thus std::map or derivates are not applicable. */
+    // Materials with many properties are looked up in a hash index. UINT_MAX
+    // is a wild-card for the semantic and the index, these need the linear search.
+    if (pMat->mNumProperties >= PropertyIndexMinProperties && UINT_MAX != type && UINT_MAX != index) {
+        *pPropOut = PropertyIndexTable::Get().Find(pMat, pKey, type, index);
+        return nullptr != *pPropOut ? AI_SUCCESS : AI_FAILURE;
+    }
+
+    /*  Otherwise just search for a property with exactly this name .. */
     for (unsigned int i = 0; i < pMat->mNumProperties; ++i) {
         aiMaterialProperty *prop = pMat->mProperties[i];
 
@@ -429,6 +594,7 @@ aiMaterial::aiMaterial() :
 
 // ------------------------------------------------------------------------------------------------
 aiMaterial::~aiMaterial() {
+    PropertyIndexTable::Get().Remove(this);
     Clear();
 
     delete[] mProperties;
@@ -444,6 +610,7 @@ aiString aiMaterial::GetName() const {
 
 // ------------------------------------------------------------------------------------------------
 void aiMaterial::Clear() {
+    PropertyIndexTable::Get().Remove(this);
     for (unsigned int i = 0; i < mNumProperties; ++i) {
         // delete this entry
         delete mProperties[i];
@@ -463,6 +630,9 @@ aiReturn aiMaterial::RemoveProperty(const char *pKey, unsigned int type, unsigne
 
         if (prop && !strcmp(prop->mKey.data, pKey) &&
                 prop->mSemantic == type && prop->mIndex == index) {
+            // the positions behind it change
+            PropertyIndexTable::Get().Remove(this);
+
             // Delete this entry
             delete mProperties[i];
 
@@ -522,6 +692,8 @@ aiReturn aiMaterial::AddBinaryProperty(const void *pInput,
     ai_assert(AI_MAXLEN > pcNew->mKey.length);
     strcpy(pcNew->mKey.data, pKey);
 
+    // Replacing a property keeps its position, appending one is picked up by the next
+    // lookup, so the index of the material stays valid
     if (UINT_MAX != iOutIndex) {
         mProperties[iOutIndex] = pcNew.release();
         return AI_SUCCESS;
@@ -595,6 +767,8 @@ void aiMaterial::CopyPropertyList(aiMaterial *const pcDest,
     ai_assert(pcDest->mNumProperties <= pcDest->mNumAllocated);
     ai_assert(pcSrc->mNumProperties <= pcSrc->mNumAllocated);
 
+    PropertyIndexTable::Get().Remove(pcDest);
+
     const unsigned int iOldNum = pcDest->mNumProperties;
     pcDest->mNumAllocated += pcSrc->mNumAllocated;
     pcDest->mNumProperties += pcSrc->mNumProperties;
@@ -86,10 +86,7 @@ void CalcTangentsProcess::Execute(aiScene *pScene) {
 
     ASSIMP_LOG_DEBUG("CalcTangentsProcess begin");
 
-    bool bHas = false;
-    for (unsigned int a = 0; a < pScene->mNumMeshes; a++) {
-        if (ProcessMesh(pScene->mMeshes[a], a)) bHas = true;
-    }
+    const bool bHas = ExecuteOnAllMeshes(pScene) > 0;
 
     if (bHas) {
         ASSIMP_LOG_INFO("CalcTangentsProcess finished. Tangents have been calculated");
@@ -98,6 +95,12 @@ void CalcTangentsProcess::Execute(aiScene *pScene) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Executes the post processing step on a single mesh.
+bool CalcTangentsProcess::ExecutePerMesh(aiScene *pScene, unsigned int meshIndex) {
+    return ProcessMesh(pScene->mMeshes[meshIndex], meshIndex);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Calculates tangents and bi-tangents for the given mesh
 bool CalcTangentsProcess::ProcessMesh(aiMesh *pMesh, unsigned int meshIndex) {
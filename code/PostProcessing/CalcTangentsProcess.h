@@ -98,6 +98,14 @@ protected:
     */
     void Execute( aiScene* pScene) override;
 
+    // -------------------------------------------------------------------
+    /** Executes the post processing step on a single mesh of the scene.
+    * @param pScene The imported data to work at.
+    * @param meshIndex Index of the mesh to process.
+    * @return true if the mesh has been modified.
+    */
+    bool ExecutePerMesh( aiScene* pScene, unsigned int meshIndex) override;
+
 private:
     /** Configuration option: maximum smoothing angle, in radians*/
     float configMaxAngle;
@@ -240,7 +240,9 @@ bool FindDegeneratesProcess::ExecuteOnMesh(aiMesh *mesh) {
                 }
             } else {
                 // Otherwise delete it if we don't need this face
-                delete[] face_src.mIndices;
+                if (!mesh->IsInFaceIndexStorage(face_src)) {
+                    delete[] face_src.mIndices;
+                }
                 face_src.mIndices = nullptr;
                 face_src.mNumIndices = 0;
             }
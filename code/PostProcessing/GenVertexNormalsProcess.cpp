@@ -84,11 +84,7 @@ void GenVertexNormalsProcess::Execute(aiScene *pScene) {
         throw DeadlyImportError("Post-processing order mismatch: expecting pseudo-indexed (\"verbose\") vertices here");
     }
 
-    bool bHas = false;
-    for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
-        if (GenMeshVertexNormals(pScene->mMeshes[a], a))
-            bHas = true;
-    }
+    const bool bHas = ExecuteOnAllMeshes(pScene) > 0;
 
     if (bHas) {
         ASSIMP_LOG_INFO("GenVertexNormalsProcess finished. "
@@ -99,6 +95,12 @@ void GenVertexNormalsProcess::Execute(aiScene *pScene) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Executes the post processing step on a single mesh.
+bool GenVertexNormalsProcess::ExecutePerMesh(aiScene *pScene, unsigned int meshIndex) {
+    return GenMeshVertexNormals(pScene->mMeshes[meshIndex], meshIndex);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 bool GenVertexNormalsProcess::GenMeshVertexNormals(aiMesh *pMesh, unsigned int meshIndex) {
@@ -87,6 +87,14 @@ public:
     */
     void Execute( aiScene* pScene) override;
 
+    // -------------------------------------------------------------------
+    /** Executes the post processing step on a single mesh of the scene.
+    * @param pScene The imported data to work at.
+    * @param meshIndex Index of the mesh to process.
+    * @return true if the mesh has been modified.
+    */
+    bool ExecutePerMesh( aiScene* pScene, unsigned int meshIndex) override;
+
     // setter for configMaxAngle
     inline void SetMaxSmoothAngle(ai_real f) {
         configMaxAngle =f;
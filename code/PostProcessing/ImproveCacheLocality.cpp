@@ -89,10 +89,13 @@ void ImproveCacheLocalityProcess::Execute(aiScene *pScene) {
 
     ASSIMP_LOG_DEBUG("ImproveCacheLocalityProcess begin");
 
+    mMeshACMR.assign(pScene->mNumMeshes, 0.f);
+    ExecuteOnAllMeshes(pScene);
+
     float out = 0.f;
     unsigned int numf = 0, numm = 0;
     for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
-        const float res = ProcessMesh(pScene->mMeshes[a], a);
+        const float res = mMeshACMR[a];
         if (res) {
             numf += pScene->mMeshes[a]->mNumFaces;
             out += res;
@@ -107,6 +110,14 @@ void ImproveCacheLocalityProcess::Execute(aiScene *pScene) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Executes the post processing step on a single mesh.
+bool ImproveCacheLocalityProcess::ExecutePerMesh(aiScene *pScene, unsigned int meshIndex) {
+    ai_assert(meshIndex < mMeshACMR.size());
+    mMeshACMR[meshIndex] = ProcessMesh(pScene->mMeshes[meshIndex], meshIndex);
+    return mMeshACMR[meshIndex] != 0.f;
+}
+
 // ------------------------------------------------------------------------------------------------
 static ai_real calculateInputACMR(aiMesh *pMesh, const aiFace *const pcEnd,
         unsigned int configCacheDepth, unsigned int meshNum) {
@@ -48,6 +48,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/types.h>
 
+#include <vector>
+
 struct aiMesh;
 
 namespace Assimp {
@@ -74,6 +76,10 @@ public:
     // Executes the pp step on a given scene
     void Execute( aiScene* pScene) override;
 
+    // -------------------------------------------------------------------
+    // Executes the pp step on a single mesh of the given scene
+    bool ExecutePerMesh( aiScene* pScene, unsigned int meshIndex) override;
+
     // -------------------------------------------------------------------
     // Configures the pp step
     void SetupProperties(const Importer* pImp) override;
@@ -90,6 +96,9 @@ private:
     //! Configuration parameter: specifies the size of the cache to
     //! optimize the vertex data for.
     unsigned int mConfigCacheDepth;
+
+    //! Output ACMR of each mesh, written by ExecutePerMesh()
+    std::vector<ai_real> mMeshACMR;
 };
 
 } // end of namespace Assimp
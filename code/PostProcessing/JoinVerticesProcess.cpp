@@ -77,15 +77,20 @@ void JoinVerticesProcess::Execute( aiScene* pScene) {
     }
 
     // execute the step
-    int iNumVertices = 0;
-    for( unsigned int a = 0; a < pScene->mNumMeshes; a++) {
-        iNumVertices += ProcessMesh( pScene->mMeshes[a],a);
-    }
+    ExecuteOnAllMeshes(pScene);
 
     pScene->mFlags |= AI_SCENE_FLAGS_NON_VERBOSE_FORMAT;
 
     // if logging is active, print detailed statistics
     if (!DefaultLogger::isNullLogger()) {
+        int iNumVertices = 0;
+        for( unsigned int a = 0; a < pScene->mNumMeshes; a++) {
+            const aiMesh *pMesh = pScene->mMeshes[a];
+            if (pMesh->HasPositions() && pMesh->HasFaces()) {
+                iNumVertices += pMesh->mNumVertices;
+            }
+        }
+
         if (iNumOldVertices == iNumVertices) {
             ASSIMP_LOG_DEBUG("JoinVerticesProcess finished ");
             return;
@@ -98,6 +103,12 @@ void JoinVerticesProcess::Execute( aiScene* pScene) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Executes the post processing step on a single mesh.
+bool JoinVerticesProcess::ExecutePerMesh( aiScene* pScene, unsigned int meshIndex) {
+    return ProcessMesh( pScene->mMeshes[meshIndex], meshIndex) > 0;
+}
+
 namespace {
 
 struct CompareVerticesAlmostEqual {
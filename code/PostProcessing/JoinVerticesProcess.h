@@ -82,6 +82,14 @@ public:
     */
     void Execute( aiScene* pScene) override;
 
+    // -------------------------------------------------------------------
+    /** Executes the post processing step on a single mesh of the scene.
+    * @param pScene The imported data to work at.
+    * @param meshIndex Index of the mesh to process.
+    * @return true if the mesh has been modified.
+    */
+    bool ExecutePerMesh( aiScene* pScene, unsigned int meshIndex) override;
+
     // -------------------------------------------------------------------
     /** Unites identical vertices in the given mesh.
      * @param pMesh The mesh to process.
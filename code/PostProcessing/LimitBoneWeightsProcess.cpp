@@ -71,13 +71,19 @@ void LimitBoneWeightsProcess::Execute( aiScene* pScene) {
 
     ASSIMP_LOG_DEBUG("LimitBoneWeightsProcess begin");
 
-    for (unsigned int m = 0; m < pScene->mNumMeshes; ++m) {
-        ProcessMesh(pScene->mMeshes[m]);
-    }
+    ExecuteOnAllMeshes(pScene);
 
     ASSIMP_LOG_DEBUG("LimitBoneWeightsProcess end");
 }
 
+// ------------------------------------------------------------------------------------------------
+// Executes the post processing step on a single mesh.
+bool LimitBoneWeightsProcess::ExecutePerMesh( aiScene* pScene, unsigned int meshIndex) {
+    aiMesh *pMesh = pScene->mMeshes[meshIndex];
+    ProcessMesh(pMesh);
+    return pMesh->HasBones();
+}
+
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void LimitBoneWeightsProcess::SetupProperties(const Importer* pImp) {
@@ -234,7 +234,7 @@ void PretransformVertices::CollectData(const aiScene *pcScene, const aiNode *pcN
 				f_dst.mNumIndices = num_idx;
 
 				unsigned int *pi;
-				if (!num_ref) { /* if last time the mesh is referenced -> no reallocation */
+				if (!num_ref && !pcMesh->IsInFaceIndexStorage(f_src)) { /* if last time the mesh is referenced -> no reallocation */
 					pi = f_dst.mIndices = f_src.mIndices;
 
 					// offset all vertex indices
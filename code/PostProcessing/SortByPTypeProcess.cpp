@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // internal headers
 #include "SortByPTypeProcess.h"
 #include "ProcessHelper.h"
+#include "Common/ScenePrivate.h"
 #include <assimp/Exceptional.h>
 
 using namespace Assimp;
@@ -303,6 +304,13 @@ void SortByPTypeProcess::Execute(aiScene *pScene) {
                 tempBones[q].reserve(mesh->mBones[q]->mNumWeights / (num - 1));
             }
 
+            // the index arrays are reused, unless the mesh keeps its indices in one block. The output
+            // gets a block of its own then, it has one index per vertex.
+            unsigned int *outStorage = nullptr;
+            if (nullptr != mesh->mFaceIndexStorage) {
+                outStorage = AllocateFaceIndexStorage(pScene, out, out->mNumVertices);
+            }
+
             unsigned int outIdx = 0;
             unsigned int amIdx = 0; // AnimMesh index
             for (unsigned int m = 0; m < mesh->mNumFaces; ++m) {
@@ -312,7 +320,11 @@ void SortByPTypeProcess::Execute(aiScene *pScene) {
                 }
 
                 outFaces->mNumIndices = in.mNumIndices;
-                outFaces->mIndices = in.mIndices;
+                if (nullptr == outStorage) {
+                    outFaces->mIndices = in.mIndices;
+                } else if (in.mNumIndices) {
+                    outFaces->mIndices = outStorage + outIdx;
+                }
 
                 for (unsigned int q = 0; q < in.mNumIndices; ++q) {
                     unsigned int idx = in.mIndices[q];
@@ -372,10 +384,12 @@ void SortByPTypeProcess::Execute(aiScene *pScene) {
                     if (pp == mesh->mNumAnimMeshes)
                         ++amIdx;
 
-                    in.mIndices[q] = outIdx++;
+                    outFaces->mIndices[q] = outIdx++;
                 }
 
-                in.mIndices = nullptr;
+                if (nullptr == outStorage) {
+                    in.mIndices = nullptr;
+                }
                 ++outFaces;
             }
             ai_assert(outFaces == out->mFaces + out->mNumFaces);
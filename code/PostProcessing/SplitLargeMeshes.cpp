@@ -44,6 +44,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // internal headers of the post-processing framework
 #include "SplitLargeMeshes.h"
 #include "ProcessHelper.h"
+#include "Common/ScenePrivate.h"
 
 using namespace Assimp;
 
@@ -69,7 +70,7 @@ void SplitLargeMeshesProcess_Triangle::Execute( aiScene* pScene) {
     std::vector<std::pair<aiMesh*, unsigned int> > avList;
 
     for( unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
-        this->SplitMesh(a, pScene->mMeshes[a],avList);
+        this->SplitMesh(a, pScene->mMeshes[a], avList, pScene);
     }
 
     if (avList.size() == pScene->mNumMeshes) {
@@ -136,7 +137,8 @@ void SplitLargeMeshesProcess_Triangle::UpdateNode(aiNode* pcNode, const std::vec
 void SplitLargeMeshesProcess_Triangle::SplitMesh(
         unsigned int a,
         aiMesh* pMesh,
-        std::vector<std::pair<aiMesh*, unsigned int> >& avList) {
+        std::vector<std::pair<aiMesh*, unsigned int> >& avList,
+        aiScene* pScene) {
     if (pMesh->mNumFaces > SplitLargeMeshesProcess_Triangle::LIMIT) {
         ASSIMP_LOG_INFO("Mesh exceeds the triangle limit. It will be split ...");
 
@@ -246,7 +248,12 @@ void SplitLargeMeshesProcess_Triangle::SplitMesh(
                 }
             }
 
-            // (we will also need to copy the array of indices)
+            // (we will also need to copy the array of indices, keep them in one
+            // block if the source mesh does so)
+            unsigned int* piStorage = nullptr;
+            if (nullptr != pMesh->mFaceIndexStorage) {
+                piStorage = AllocateFaceIndexStorage(pScene, pcMesh, iCnt);
+            }
             unsigned int iCurrent = 0;
             for (unsigned int p = 0; p < pcMesh->mNumFaces;++p) {
                 pcMesh->mFaces[p].mNumIndices = 3;
@@ -257,7 +264,8 @@ void SplitLargeMeshesProcess_Triangle::SplitMesh(
                 // setup face type and number of indices
                 pcMesh->mFaces[p].mNumIndices = iNumIndices;
                 unsigned int* pi = pMesh->mFaces[iTemp].mIndices;
-                unsigned int* piOut = pcMesh->mFaces[p].mIndices = new unsigned int[iNumIndices];
+                unsigned int* piOut = pcMesh->mFaces[p].mIndices = (nullptr == piStorage || 0 == iNumIndices) ?
+                        new unsigned int[iNumIndices] : piStorage + iCurrent;
 
                 // need to update the output primitive types
                 switch (iNumIndices) {
@@ -353,7 +361,7 @@ void SplitLargeMeshesProcess_Vertex::Execute( aiScene* pScene) {
     }
 
     for( unsigned int a = 0; a < pScene->mNumMeshes; ++a ) {
-        this->SplitMesh(a, pScene->mMeshes[a], avList);
+        this->SplitMesh(a, pScene->mMeshes[a], avList, pScene);
     }
 
     if (avList.size() != pScene->mNumMeshes) {
@@ -385,7 +393,8 @@ void SplitLargeMeshesProcess_Vertex::SetupProperties( const Importer* pImp) {
 void SplitLargeMeshesProcess_Vertex::SplitMesh(
         unsigned int a,
         aiMesh* pMesh,
-        std::vector<std::pair<aiMesh*, unsigned int> >& avList) {
+        std::vector<std::pair<aiMesh*, unsigned int> >& avList,
+        aiScene* pScene) {
     if (pMesh->mNumVertices > SplitLargeMeshesProcess_Vertex::LIMIT) {
         typedef std::vector< std::pair<unsigned int,float> > VertexWeightTable;
 
@@ -432,8 +441,9 @@ void SplitLargeMeshesProcess_Vertex::SplitMesh(
                 }
             }
 
-            // output vectors
-            std::vector<aiFace> vFaces;
+            // output vectors, the indices of all faces in a row
+            std::vector<unsigned int> vFaceSizes;
+            std::vector<unsigned int> vIndices;
 
             // reserve enough storage for most cases
             if (pMesh->HasPositions()) {
@@ -453,7 +463,8 @@ void SplitLargeMeshesProcess_Vertex::SplitMesh(
                 pcMesh->mNumUVComponents[c] = pMesh->mNumUVComponents[c];
                 pcMesh->mTextureCoords[c] = new aiVector3D[iOutVertexNum];
             }
-            vFaces.reserve(iEstimatedSize);
+            vFaceSizes.reserve(iEstimatedSize);
+            vIndices.reserve(iEstimatedSize * 3);
 
             // (we will also need to copy the array of indices)
             while (iBase < pMesh->mNumFaces) {
@@ -475,15 +486,13 @@ void SplitLargeMeshesProcess_Vertex::SplitMesh(
                     break;
                 }
 
-                vFaces.emplace_back();
-                aiFace& rFace = vFaces.back();
-
                 // setup face type and number of indices
-                rFace.mNumIndices = iNumIndices;
-                rFace.mIndices = new unsigned int[iNumIndices];
+                vFaceSizes.push_back(iNumIndices);
+                const size_t iFirstIndex = vIndices.size();
+                vIndices.resize(iFirstIndex + iNumIndices);
 
                 // need to update the output primitive types
-                switch (rFace.mNumIndices) {
+                switch (iNumIndices) {
                 case 1:
                     pcMesh->mPrimitiveTypes |= aiPrimitiveType_POINT;
                     break;
@@ -503,7 +512,7 @@ void SplitLargeMeshesProcess_Vertex::SplitMesh(
 
                     // check whether we do already have this vertex
                     if (0xFFFFFFFF != avWasCopied[iIndex]) {
-                        rFace.mIndices[v] = avWasCopied[iIndex];
+                        vIndices[iFirstIndex + v] = avWasCopied[iIndex];
                         continue;
                     }
 
@@ -534,7 +543,7 @@ void SplitLargeMeshesProcess_Vertex::SplitMesh(
                         }
                     }
                     // check whether we have bone weights assigned to this vertex
-                    rFace.mIndices[v] = pcMesh->mNumVertices;
+                    vIndices[iFirstIndex + v] = pcMesh->mNumVertices;
                     if (avPerVertexWeights) {
                         VertexWeightTable& table = avPerVertexWeights[ pcMesh->mNumVertices ];
                         if( !table.empty() ) {
@@ -588,11 +597,17 @@ void SplitLargeMeshesProcess_Vertex::SplitMesh(
             }
 
             // copy the face list to the mesh
-            pcMesh->mFaces = new aiFace[vFaces.size()];
-            pcMesh->mNumFaces = (unsigned int)vFaces.size();
+            const bool contiguous = nullptr != pMesh->mFaceIndexStorage;
+            pcMesh->AllocateFaces((unsigned int)vFaceSizes.size(), vFaceSizes.data(), contiguous,
+                    contiguous ? AllocateArenaFaceIndices(pScene, (unsigned int)vIndices.size()) : nullptr);
 
+            const unsigned int* piIndex = vIndices.data();
             for (unsigned int p = 0; p < pcMesh->mNumFaces;++p) {
-                pcMesh->mFaces[p] = vFaces[p];
+                aiFace& rFace = pcMesh->mFaces[p];
+                if (rFace.mNumIndices) {
+                    ::memcpy(rFace.mIndices, piIndex, rFace.mNumIndices * sizeof(unsigned int));
+                    piIndex += rFace.mNumIndices;
+                }
             }
 
             // add the newly created mesh to the list
@@ -124,9 +124,11 @@ public:
     void Execute( aiScene* pScene) override;
 
     // -------------------------------------------------------------------
-    //! Apply the algorithm to a given mesh
+    //! Apply the algorithm to a given mesh. The face indices of the new
+    //! meshes are taken from the memory arena of pScene if it has one.
     void SplitMesh (unsigned int a, aiMesh* pcMesh,
-        std::vector<std::pair<aiMesh*, unsigned int> >& avList);
+        std::vector<std::pair<aiMesh*, unsigned int> >& avList,
+        aiScene* pScene = nullptr);
 
     // -------------------------------------------------------------------
     //! Update a node in the asset after a few of its meshes
@@ -181,9 +183,11 @@ public:
     void Execute( aiScene* pScene) override;
 
     // -------------------------------------------------------------------
-    //! Apply the algorithm to a given mesh
+    //! Apply the algorithm to a given mesh. The face indices of the new
+    //! meshes are taken from the memory arena of pScene if it has one.
     void SplitMesh (unsigned int a, aiMesh* pcMesh,
-        std::vector<std::pair<aiMesh*, unsigned int> >& avList);
+        std::vector<std::pair<aiMesh*, unsigned int> >& avList,
+        aiScene* pScene = nullptr);
 
     // NOTE: Reuse SplitLargeMeshesProcess_Triangle::UpdateNode()
 
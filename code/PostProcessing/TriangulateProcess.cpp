@@ -185,15 +185,7 @@ bool TriangulateProcess::IsActive( unsigned int pFlags) const {
 void TriangulateProcess::Execute( aiScene* pScene) {
     ASSIMP_LOG_DEBUG("TriangulateProcess begin");
 
-    bool bHas = false;
-    for( unsigned int a = 0; a < pScene->mNumMeshes; a++)
-    {
-        if (pScene->mMeshes[ a ]) {
-            if ( TriangulateMesh( pScene->mMeshes[ a ] ) ) {
-                bHas = true;
-            }
-        }
-    }
+    const bool bHas = ExecuteOnAllMeshes( pScene ) > 0;
     if ( bHas ) {
         ASSIMP_LOG_INFO( "TriangulateProcess finished. All polygons have been triangulated." );
     } else {
@@ -201,6 +193,13 @@ void TriangulateProcess::Execute( aiScene* pScene) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Executes the post processing step on a single mesh.
+bool TriangulateProcess::ExecutePerMesh( aiScene* pScene, unsigned int meshIndex) {
+    aiMesh *pMesh = pScene->mMeshes[ meshIndex ];
+    return nullptr != pMesh && TriangulateMesh( pMesh );
+}
+
 // ------------------------------------------------------------------------------------------------
 // Triangulates the given mesh.
 bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh) {
@@ -487,7 +486,9 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh) {
             ++f;
         }
 
-        delete[] face.mIndices;
+        if (!pMesh->IsInFaceIndexStorage(face)) {
+            delete[] face.mIndices;
+        }
         face.mIndices = nullptr;
     }
 
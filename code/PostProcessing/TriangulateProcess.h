@@ -80,6 +80,14 @@ public:
     */
     void Execute( aiScene* pScene) override;
 
+    // -------------------------------------------------------------------
+    /** Executes the post processing step on a single mesh of the scene.
+    * @param pScene The imported data to work at.
+    * @param meshIndex Index of the mesh to process.
+    * @return true if the mesh has been modified.
+    */
+    bool ExecutePerMesh( aiScene* pScene, unsigned int meshIndex) override;
+
     // -------------------------------------------------------------------
     /** Triangulates the given mesh.
      * @param pMesh The mesh to triangulate.
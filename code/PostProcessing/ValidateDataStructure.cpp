@@ -50,6 +50,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/BaseImporter.h>
 #include <assimp/fast_atof.h>
 #include <memory>
+#include <unordered_map>
 
 // CRT headers
 #include <stdarg.h>
@@ -96,12 +97,16 @@ void ValidateDSProcess::ReportWarning(const char *msg, ...) {
 }
 
 // ------------------------------------------------------------------------------------------------
-inline int HasNameMatch(const aiString &in, aiNode *node) {
-    int result = (node->mName == in ? 1 : 0);
-    for (unsigned int i = 0; i < node->mNumChildren; ++i) {
-        result += HasNameMatch(in, node->mChildren[i]);
+inline std::string ToStdString(const aiString &in) {
+    return std::string(in.data, in.length);
+}
+
+// ------------------------------------------------------------------------------------------------
+void ValidateDSProcess::CollectNodeNames(const aiNode *pNode) {
+    ++mNodeNames[ToStdString(pNode->mName)];
+    for (unsigned int i = 0; i < pNode->mNumChildren; ++i) {
+        CollectNodeNames(pNode->mChildren[i]);
     }
-    return result;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -139,20 +144,21 @@ inline void ValidateDSProcess::DoValidationEx(T **parray, unsigned int size,
         ReportError("aiScene::%s is nullptr (aiScene::%s is %i)",
                 firstName, secondName, size);
     }
-    for (unsigned int i = 0; i < size; ++i) {
-        if (!parray[i]) {
+    // check whether there are duplicate names
+    std::unordered_map<std::string, unsigned int> names;
+    names.reserve(size);
+    for (unsigned int a = 0; a < size; ++a) {
+        if (!parray[a]) {
             ReportError("aiScene::%s[%u] is nullptr (aiScene::%s is %u)",
-                    firstName, i, secondName, size);
+                    firstName, a, secondName, size);
         }
-        Validate(parray[i]);
+        Validate(parray[a]);
 
-        // check whether there are duplicate names
-        for (unsigned int a = i + 1; a < size; ++a) {
-            if (parray[i]->mName == parray[a]->mName) {
-                ReportError("aiScene::%s[%u] has the same name as "
-                            "aiScene::%s[%u]",
-                        firstName, i, secondName, a);
-            }
+        auto it = names.emplace(ToStdString(parray[a]->mName), a);
+        if (!it.second) {
+            ReportError("aiScene::%s[%u] has the same name as "
+                        "aiScene::%s[%u]",
+                    firstName, it.first->second, secondName, a);
         }
     }
 }
@@ -164,8 +170,12 @@ inline void ValidateDSProcess::DoValidationWithNameCheck(T **array, unsigned int
     // validate all entries
     DoValidationEx(array, size, firstName, secondName);
 
+    if (mNodeNames.empty()) {
+        CollectNodeNames(mScene->mRootNode);
+    }
     for (unsigned int i = 0; i < size; ++i) {
-        int res = HasNameMatch(array[i]->mName, mScene->mRootNode);
+        auto it = mNodeNames.find(ToStdString(array[i]->mName));
+        const unsigned int res = (it == mNodeNames.end()) ? 0 : it->second;
         if (0 == res) {
             const std::string name = static_cast<char *>(array[i]->mName.data);
             ReportError("aiScene::%s[%i] has no corresponding node in the scene graph (%s)",
@@ -182,6 +192,8 @@ inline void ValidateDSProcess::DoValidationWithNameCheck(T **array, unsigned int
 // Executes the post processing step on the given imported data.
 void ValidateDSProcess::Execute(aiScene *pScene) {
     mScene = pScene;
+    mNodeNames.clear();
+    mNodeMeshRefs.assign(pScene->mNumMeshes, false);
     ASSIMP_LOG_DEBUG("ValidateDataStructureProcess begin");
 
     // validate the node graph of the scene
@@ -189,7 +201,7 @@ void ValidateDSProcess::Execute(aiScene *pScene) {
 
     // validate all meshes
     if (pScene->mNumMeshes) {
-        DoValidation(pScene->mMeshes, pScene->mNumMeshes, "mMeshes", "mNumMeshes");
+        ValidateMeshes();
     } else if (!(mScene->mFlags & AI_SCENE_FLAGS_INCOMPLETE)) {
         ReportError("aiScene::mNumMeshes is 0. At least one mesh must be there");
     } else if (pScene->mMeshes) {
@@ -240,6 +252,29 @@ void ValidateDSProcess::Execute(aiScene *pScene) {
     ASSIMP_LOG_DEBUG("ValidateDataStructureProcess end");
 }
 
+// ------------------------------------------------------------------------------------------------
+void ValidateDSProcess::ValidateMeshes() {
+    if (!mScene->mMeshes) {
+        ReportError("aiScene::mMeshes is nullptr (aiScene::mNumMeshes is %i)", mScene->mNumMeshes);
+    }
+    for (unsigned int i = 0; i < mScene->mNumMeshes; ++i) {
+        if (!mScene->mMeshes[i]) {
+            ReportError("aiScene::mMeshes[%i] is nullptr (aiScene::mNumMeshes is %i)",
+                    i, mScene->mNumMeshes);
+        }
+    }
+
+    // the meshes are checked independently of each other, so they can be distributed
+    // over the post-processing threads
+    ExecuteOnAllMeshes(mScene);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ValidateDSProcess::ExecutePerMesh(aiScene *pScene, unsigned int meshIndex) {
+    Validate(pScene->mMeshes[meshIndex]);
+    return false;
+}
+
 // ------------------------------------------------------------------------------------------------
 void ValidateDSProcess::Validate(const aiLight *pLight) {
     if (pLight->mType == aiLightSource_UNDEFINED)
@@ -399,6 +434,8 @@ void ValidateDSProcess::Validate(const aiMesh *pMesh) {
         }
 
         // check whether there are duplicate bone names
+        std::unordered_map<std::string, unsigned int> boneNames;
+        boneNames.reserve(pMesh->mNumBones);
         for (unsigned int i = 0; i < pMesh->mNumBones; ++i) {
             const aiBone *bone = pMesh->mBones[i];
             if (bone->mNumWeights > AI_MAX_BONE_WEIGHTS) {
@@ -411,16 +448,15 @@ void ValidateDSProcess::Validate(const aiMesh *pMesh) {
             }
             Validate(pMesh, pMesh->mBones[i], afSum.get());
 
-            for (unsigned int a = i + 1; a < pMesh->mNumBones; ++a) {
-                if (pMesh->mBones[i]->mName == pMesh->mBones[a]->mName) {
-                    const char *name = "unknown";
-                    if (nullptr != pMesh->mBones[i]->mName.C_Str()) {
-                        name = pMesh->mBones[i]->mName.C_Str();
-                    }
-                    ReportError("aiMesh::mBones[%i], name = \"%s\" has the same name as "
-                                "aiMesh::mBones[%i]",
-                            i, name, a);
+            auto it = boneNames.emplace(ToStdString(pMesh->mBones[i]->mName), i);
+            if (!it.second) {
+                const char *name = "unknown";
+                if (nullptr != pMesh->mBones[i]->mName.C_Str()) {
+                    name = pMesh->mBones[i]->mName.C_Str();
                 }
+                ReportError("aiMesh::mBones[%i], name = \"%s\" has the same name as "
+                            "aiMesh::mBones[%i]",
+                        it.first->second, name, i);
             }
         }
         // check whether all bone weights for a vertex sum to 1.0 ...
@@ -864,18 +900,20 @@ void ValidateDSProcess::Validate(const aiNode *pNode) {
             ReportError("aiNode::mMeshes is nullptr for node %s (aiNode::mNumMeshes is %i)",
                     nodeName, pNode->mNumMeshes);
         }
-        std::vector<bool> abHadMesh;
-        abHadMesh.resize(mScene->mNumMeshes, false);
+        // the flags are shared by all nodes, they are reset again below
         for (unsigned int i = 0; i < pNode->mNumMeshes; ++i) {
             if (pNode->mMeshes[i] >= mScene->mNumMeshes) {
                 ReportError("aiNode::mMeshes[%i] is out of range for node %s (maximum is %i)",
                         pNode->mMeshes[i], nodeName, mScene->mNumMeshes - 1);
             }
-            if (abHadMesh[pNode->mMeshes[i]]) {
+            if (mNodeMeshRefs[pNode->mMeshes[i]]) {
                 ReportError("aiNode::mMeshes[%i] is already referenced by this node %s (value: %i)",
                         i, nodeName, pNode->mMeshes[i]);
             }
-            abHadMesh[pNode->mMeshes[i]] = true;
+            mNodeMeshRefs[pNode->mMeshes[i]] = true;
+        }
+        for (unsigned int i = 0; i < pNode->mNumMeshes; ++i) {
+            mNodeMeshRefs[pNode->mMeshes[i]] = false;
         }
     }
     if (pNode->mNumChildren) {
@@ -50,6 +50,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "Common/BaseProcess.h"
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 struct aiBone;
 struct aiMesh;
 struct aiAnimation;
@@ -68,7 +72,7 @@ namespace Assimp {
 /** Validates the whole ASSIMP scene data structure for correctness.
  *  ImportErrorException is thrown of the scene is corrupt.*/
 // --------------------------------------------------------------------------------------
-class ValidateDSProcess : public BaseProcess {
+class ASSIMP_API ValidateDSProcess : public BaseProcess {
 public:
     // -------------------------------------------------------------------
     /// The default class constructor / destructor.
@@ -81,6 +85,9 @@ public:
     // -------------------------------------------------------------------
     void Execute( aiScene* pScene) override;
 
+    // -------------------------------------------------------------------
+    bool ExecutePerMesh( aiScene* pScene, unsigned int meshIndex) override;
+
 protected:
     // -------------------------------------------------------------------
     /** Report a validation error. This will throw an exception,
@@ -101,6 +108,10 @@ protected:
      * @param pMesh Input mesh*/
     void Validate( const aiMesh* pMesh);
 
+    // -------------------------------------------------------------------
+    /** Validates all meshes of the scene, see ExecuteOnAllMeshes() */
+    void ValidateMeshes();
+
     // -------------------------------------------------------------------
     /** Validates a bone
      * @param pMesh Input mesh
@@ -183,7 +194,17 @@ private:
     inline void DoValidationWithNameCheck(T** array, unsigned int size,
         const char* firstName, const char* secondName);
 
+    // counts the names of a node and all of its subnodes
+    void CollectNodeNames(const aiNode* pNode);
+
     aiScene* mScene;
+
+    // node names of the scene graph with their number of occurrences,
+    // built on demand by DoValidationWithNameCheck()
+    std::unordered_map<std::string, unsigned int> mNodeNames;
+
+    // meshes referenced by the node which is currently validated
+    std::vector<bool> mNodeMeshRefs;
 };
 
 
@@ -0,0 +1,128 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file AsyncLogStream.hpp
+ *  @brief Log stream decorator which writes on a background thread.
+ */
+#pragma once
+#ifndef INCLUDED_AI_ASYNCLOGSTREAM_H
+#define INCLUDED_AI_ASYNCLOGSTREAM_H
+
+#ifdef __GNUC__
+#pragma GCC system_header
+#endif
+
+#include "LogStream.hpp"
+
+#include <atomic>
+#include <cstddef>
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace Assimp {
+
+// ------------------------------------------------------------------------------------
+/** @brief CPP-API: Log stream which hands the messages to a background thread.
+ *
+ *  write() just puts a copy of the message into a lock-free queue and never
+ *  waits for the output, so threads logging concurrently don't hold each
+ *  other up while a slow stream (e.g. a file) is written. A dedicated thread
+ *  writes the queued messages to the wrapped stream in the order in which
+ *  they have been queued.
+ *  @code
+ *  DefaultLogger::get()->attachStream(new AsyncLogStream(
+ *      LogStream::createDefaultStream(aiDefaultLogStream_FILE, "AssimpLog.txt")));
+ *  @endcode
+ *  If assimp has been built with ASSIMP_BUILD_SINGLETHREADED there is no
+ *  background thread: write() then writes the message synchronously to the
+ *  wrapped stream, like any other stream. */
+class ASSIMP_API AsyncLogStream : public LogStream {
+public:
+    /** @brief  Construction from the stream to write to.
+     *  @param  stream  Target stream, the AsyncLogStream takes ownership of it. */
+    explicit AsyncLogStream(LogStream *stream);
+
+    /** @brief  Writes all pending messages and destroys the target stream. */
+    ~AsyncLogStream() override;
+
+    // non copyable
+    AsyncLogStream(const AsyncLogStream &) = delete;
+    AsyncLogStream &operator=(const AsyncLogStream &) = delete;
+
+    /** @brief  Queues a message for the target stream.
+     *  @param  message Message to be written */
+    void write(const char *message) override;
+
+    /** @brief  Blocks until all messages queued so far have been written. */
+    void flush();
+
+private:
+    struct Message;
+
+    void WriterLoop();
+    void WritePending();
+
+private:
+    LogStream *mStream;
+
+    //! Queued messages, newest first
+    std::atomic<Message *> mPending;
+    std::atomic<size_t> mNumQueued;
+    std::atomic<size_t> mNumWritten;
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    std::atomic<bool> mStop;
+    std::mutex mMutex;
+    //! The writer thread waits for new messages on it
+    std::condition_variable mCondition;
+    //! Signaled by the writer thread whenever it has written the pending messages
+    std::condition_variable mWritten;
+    std::thread mWriter;
+#endif
+};
+
+} // Namespace Assimp
+
+#endif // INCLUDED_AI_ASYNCLOGSTREAM_H
@@ -346,6 +346,10 @@ protected:
     double importerScale = 1.0;
     double fileScale = 1.0;
 
+    /// Allocate the face indices of each mesh in one block, see #AI_CONFIG_IMPORT_CONTIGUOUS_FACE_INDICES
+    /// and #AI_CONFIG_IMPORT_SCENE_ARENA
+    bool contiguousFaceIndices = false;
+
     // -------------------------------------------------------------------
     /** Imports the given file into the given scene structure. The
      * function is expected to throw an ImportErrorException if there is
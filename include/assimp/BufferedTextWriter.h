@@ -0,0 +1,195 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file BufferedTextWriter.h
+ *  @brief Buffered writer for text exporters, which streams directly into an IOStream.
+ */
+#pragma once
+#ifndef INCLUDED_AI_BUFFERED_TEXT_WRITER_H
+#define INCLUDED_AI_BUFFERED_TEXT_WRITER_H
+
+#ifdef __GNUC__
+#pragma GCC system_header
+#endif
+
+#include <assimp/defs.h>
+#include <assimp/types.h>
+
+#include <charconv>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace Assimp {
+
+class IOStream;
+
+// ---------------------------------------------------------------------------
+/** @brief Buffered text output for exporters.
+ *
+ *  Exporters used to build their whole file in a std::ostringstream and to
+ *  copy it into the IOStream at the end. The BufferedTextWriter instead
+ *  collects the output in a fixed-size buffer, which is written to the
+ *  stream whenever it is full. Numbers are formatted without iostreams and
+ *  independent of the current locale. Floating point values are written
+ *  with the shortest representation which reads back to the same value.
+ *
+ *  An example:
+ *  @code
+ *  BufferedTextWriter out(stream);
+ *  out << "v " << v.x << ' ' << v.y << ' ' << v.z << '\n';
+ *  out.flush();
+ *  @endcode
+ *
+ *  The destructor doesn't flush, call flush() once all data is written.
+ *  A failed write causes a DeadlyExportError.
+ */
+class ASSIMP_API BufferedTextWriter {
+public:
+    /// @brief The default number of bytes collected before they are written to the stream.
+    static constexpr size_t DefaultBufferSize = 1 << 16;
+
+    /// @brief The size of a buffer which is large enough for any number written by format().
+    static constexpr size_t MaxNumberLength = 32;
+
+    /// @brief The class constructor.
+    /// @param[in] stream       The stream to write to, is not owned by the writer.
+    ///                         Can be set later on by setStream().
+    /// @param[in] bufferSize   The number of bytes collected before they are written.
+    explicit BufferedTextWriter(IOStream *stream = nullptr, size_t bufferSize = DefaultBufferSize);
+
+    /// @brief The class destructor, pending data is discarded.
+    ~BufferedTextWriter() = default;
+
+    BufferedTextWriter(const BufferedTextWriter &) = delete;
+    BufferedTextWriter &operator=(const BufferedTextWriter &) = delete;
+
+    /// @brief Flushes the pending data to the current stream and switches to another one.
+    /// @param[in] stream   The new stream, is not owned by the writer.
+    void setStream(IOStream *stream);
+
+    /// @brief Writes all pending data to the stream.
+    void flush();
+
+    /// @brief Will return the number of bytes written so far, including the pending ones.
+    /// @return The number of bytes.
+    size_t tell() const {
+        return mFlushed + mPos;
+    }
+
+    /// @brief Writes raw data.
+    /// @param[in] data     The data to write.
+    /// @param[in] length   The number of bytes to write.
+    void write(const char *data, size_t length) {
+        if (length <= mBuffer.size() - mPos) {
+            ::memcpy(mBuffer.data() + mPos, data, length);
+            mPos += length;
+            return;
+        }
+        writeLarge(data, length);
+    }
+
+    /// @brief Formats a floating point value with the shortest round-trip representation.
+    /// @param[out] buffer  Receives the text, at least MaxNumberLength bytes. Not zero terminated.
+    /// @param[in] value    The value to format.
+    /// @return The number of characters written.
+    static size_t format(char *buffer, float value);
+    static size_t format(char *buffer, double value);
+
+    BufferedTextWriter &operator<<(const char *text) {
+        write(text, ::strlen(text));
+        return *this;
+    }
+    BufferedTextWriter &operator<<(const std::string &text) {
+        write(text.data(), text.size());
+        return *this;
+    }
+    BufferedTextWriter &operator<<(const aiString &text) {
+        write(text.data, text.length);
+        return *this;
+    }
+    BufferedTextWriter &operator<<(char c) {
+        if (mPos == mBuffer.size()) {
+            flush();
+        }
+        mBuffer[mPos++] = c;
+        return *this;
+    }
+    BufferedTextWriter &operator<<(int value) { return writeInteger(value); }
+    BufferedTextWriter &operator<<(unsigned int value) { return writeInteger(value); }
+    BufferedTextWriter &operator<<(long value) { return writeInteger(value); }
+    BufferedTextWriter &operator<<(unsigned long value) { return writeInteger(value); }
+    BufferedTextWriter &operator<<(long long value) { return writeInteger(value); }
+    BufferedTextWriter &operator<<(unsigned long long value) { return writeInteger(value); }
+    BufferedTextWriter &operator<<(float value) { return writeReal(value); }
+    BufferedTextWriter &operator<<(double value) { return writeReal(value); }
+
+private:
+    template <typename T>
+    BufferedTextWriter &writeInteger(T value) {
+        if (mBuffer.size() - mPos < MaxNumberLength) {
+            flush();
+        }
+        char *begin = mBuffer.data() + mPos;
+        mPos += static_cast<size_t>(std::to_chars(begin, begin + MaxNumberLength, value).ptr - begin);
+        return *this;
+    }
+
+    template <typename T>
+    BufferedTextWriter &writeReal(T value) {
+        if (mBuffer.size() - mPos < MaxNumberLength) {
+            flush();
+        }
+        mPos += format(mBuffer.data() + mPos, value);
+        return *this;
+    }
+
+    void writeLarge(const char *data, size_t length);
+
+    IOStream *mStream;
+    std::vector<char> mBuffer;
+    size_t mPos;
+    size_t mFlushed;
+};
+
+} // namespace Assimp
+
+#endif // INCLUDED_AI_BUFFERED_TEXT_WRITER_H
@@ -54,6 +54,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "LogStream.hpp"
 #include "Logger.hpp"
 #include "NullLogger.hpp"
+#include <atomic>
 #include <vector>
 
 #ifndef ASSIMP_BUILD_SINGLETHREADED
@@ -140,6 +141,11 @@ public:
     /** @copydoc Logger::detachStream */
     bool detachStream(LogStream *pStream, unsigned int severity) override;
 
+    // ----------------------------------------------------------------------
+    /** @brief  Checks the log severity and whether any attached stream
+     *          accepts messages of the given type. */
+    bool isEnabled(ErrorSeverity severity, LogSeverity level = NORMAL) const override;
+
 private:
     // ----------------------------------------------------------------------
     /** @briefPrivate construction for internal use by create().
@@ -189,6 +195,9 @@ private:
     //! Attached streams
     StreamArray m_StreamArray;
 
+    //! Combined error severity flags of all attached streams
+    std::atomic<unsigned int> m_streamSeverities;
+
 #ifndef ASSIMP_BUILD_SINGLETHREADED
     std::mutex m_arrayMutex;
 #endif
@@ -124,6 +124,21 @@ public:
      *  See fflush() for more details.
      */
     virtual void Flush() = 0;
+
+    // -------------------------------------------------------------------
+    /** @brief Returns the complete file contents, if the stream is backed
+     *  by memory (e.g. a memory-mapped file).
+     *
+     *  Importers may use the returned memory to parse a file without
+     *  copying it into a buffer of their own. The memory is FileSize()
+     *  bytes long, independent of the file cursor, and stays valid until
+     *  the stream is closed. It must be treated as read-only.
+     *  @return Pointer to the file contents, nullptr if the stream does
+     *    not support zero-copy access. Use Read() in this case.
+     */
+    virtual const uint8_t *GetMemoryView() const {
+        return nullptr;
+    }
 }; //! class IOStream
 
 } //!namespace Assimp
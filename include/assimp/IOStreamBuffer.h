@@ -53,20 +53,40 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <vector>
 
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#endif
+
 namespace Assimp {
 
 // ---------------------------------------------------------------------------
 /**
  *  Implementation of a cached stream buffer.
+ *
+ *  The stream is read block by block. With prefetching enabled a background
+ *  thread reads the next blocks while the current one is parsed, so reading
+ *  and parsing overlap. Streams which provide a memory view are never
+ *  prefetched, there is nothing to wait for. If assimp has been built with
+ *  ASSIMP_BUILD_SINGLETHREADED the blocks are always read on demand.
  */
 template <class T>
 class IOStreamBuffer {
 public:
     /// @brief  The class constructor.
-    IOStreamBuffer(size_t cache = 4096 * 4096);
+    /// @param  cache       The block size, in items.
+    /// @param  prefetch    The number of blocks to read ahead, 0 reads on demand.
+    IOStreamBuffer(size_t cache = 4096 * 4096, size_t prefetch = 0);
 
     /// @brief  The class destructor.
-    ~IOStreamBuffer() = default;
+    ~IOStreamBuffer();
+
+    IOStreamBuffer(const IOStreamBuffer &) = delete;
+    IOStreamBuffer &operator=(const IOStreamBuffer &) = delete;
 
     /// @brief  Will open the cached access for a given stream.
     /// @param  stream      The stream to cache.
@@ -116,6 +136,23 @@ public:
     /// @return true if successful.
     bool getNextBlock(std::vector<T> &buffer);
 
+    /// @brief  Returns the unread rest of the file without copying it, if the
+    ///         stream provides its memory (see IOStream::GetMemoryView()).
+    ///         The rest of the file is consumed by this call.
+    /// @param  data        Will point to the unread data.
+    /// @param  numItems    Will contain the number of unread items.
+    /// @return true if successful, false if the stream has no memory view.
+    bool getRemainingView(const T *&data, size_t &numItems);
+
+private:
+    void startPrefetch();
+    void stopPrefetch();
+    size_t readBlock();
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    void prefetchLoop();
+#endif
+
 private:
     IOStream *m_stream;
     size_t m_filesize;
@@ -125,21 +162,50 @@ private:
     std::vector<T> m_cache;
     size_t m_cachePos;
     size_t m_filePos;
+    size_t m_prefetch;
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    //! The blocks read by the prefetch thread with their lengths, oldest first
+    std::deque<std::pair<std::vector<T>, size_t>> m_readBlocks;
+    //! The blocks the prefetch thread may read into
+    std::vector<std::vector<T>> m_freeBlocks;
+    size_t m_readPos;
+    bool m_stopReading;
+    bool m_readingDone;
+    //! An exception thrown by the stream on the prefetch thread, rethrown by readBlock()
+    std::exception_ptr m_readError;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::thread m_reader;
+#endif
 };
 
 template <class T>
-AI_FORCE_INLINE IOStreamBuffer<T>::IOStreamBuffer(size_t cache) :
+AI_FORCE_INLINE IOStreamBuffer<T>::IOStreamBuffer(size_t cache, size_t prefetch) :
         m_stream(nullptr),
         m_filesize(0),
         m_cacheSize(cache),
         m_numBlocks(0),
         m_blockIdx(0),
         m_cachePos(0),
-        m_filePos(0) {
+        m_filePos(0),
+        m_prefetch(prefetch)
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+        ,
+        m_readPos(0),
+        m_stopReading(false),
+        m_readingDone(false)
+#endif
+{
     m_cache.resize(cache);
     std::fill(m_cache.begin(), m_cache.end(), '\n');
 }
 
+template <class T>
+AI_FORCE_INLINE IOStreamBuffer<T>::~IOStreamBuffer() {
+    stopPrefetch();
+}
+
 template <class T>
 AI_FORCE_INLINE bool IOStreamBuffer<T>::open(IOStream *stream) {
     //  file still opened!
@@ -166,6 +232,10 @@ AI_FORCE_INLINE bool IOStreamBuffer<T>::open(IOStream *stream) {
         m_numBlocks++;
     }
 
+    if (m_prefetch > 0 && m_numBlocks > 1 && nullptr == m_stream->GetMemoryView()) {
+        startPrefetch();
+    }
+
     return true;
 }
 
@@ -175,6 +245,8 @@ AI_FORCE_INLINE bool IOStreamBuffer<T>::close() {
         return false;
     }
 
+    stopPrefetch();
+
     // init counters and state vars
     m_stream = nullptr;
     m_filesize = 0;
@@ -200,10 +272,130 @@ AI_FORCE_INLINE
     return m_cacheSize;
 }
 
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+
 template <class T>
-AI_FORCE_INLINE bool IOStreamBuffer<T>::readNextBlock() {
+AI_FORCE_INLINE void IOStreamBuffer<T>::startPrefetch() {
+    m_readBlocks.clear();
+    m_freeBlocks.assign(m_prefetch, std::vector<T>(m_cache.size(), '\n'));
+    m_readPos = 0;
+    m_stopReading = false;
+    m_readingDone = false;
+    m_readError = nullptr;
+    m_reader = std::thread(&IOStreamBuffer<T>::prefetchLoop, this);
+}
+
+template <class T>
+AI_FORCE_INLINE void IOStreamBuffer<T>::stopPrefetch() {
+    if (!m_reader.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopReading = true;
+    }
+    m_condition.notify_all();
+    m_reader.join();
+
+    m_readBlocks.clear();
+    m_freeBlocks.clear();
+    m_readError = nullptr;
+}
+
+template <class T>
+AI_FORCE_INLINE void IOStreamBuffer<T>::prefetchLoop() {
+    // Only this thread touches the stream while prefetching, it is read in one go
+    // up to the end of the file or the first short read.
+    const size_t blockSize = m_cacheSize;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_condition.wait(lock, [this] { return m_stopReading || !m_freeBlocks.empty(); });
+        if (m_stopReading) {
+            break;
+        }
+
+        std::vector<T> block = std::move(m_freeBlocks.back());
+        m_freeBlocks.pop_back();
+        lock.unlock();
+
+        // an exception must not leave this thread, it is handed to the parsing thread
+        size_t readLen = 0;
+        try {
+            m_stream->Seek(m_readPos, aiOrigin_SET);
+            readLen = m_stream->Read(&block[0], sizeof(T), blockSize);
+        } catch (...) {
+            lock.lock();
+            m_readError = std::current_exception();
+            break;
+        }
+
+        lock.lock();
+        m_readPos += readLen;
+        m_readBlocks.emplace_back(std::move(block), readLen);
+        m_condition.notify_all();
+        if (readLen < blockSize) {
+            break;
+        }
+    }
+
+    m_readingDone = true;
+    m_condition.notify_all();
+}
+
+template <class T>
+AI_FORCE_INLINE size_t IOStreamBuffer<T>::readBlock() {
+    if (!m_reader.joinable()) {
+        m_stream->Seek(m_filePos, aiOrigin_SET);
+        return m_stream->Read(&m_cache[0], sizeof(T), m_cacheSize);
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [this] { return m_readingDone || !m_readBlocks.empty(); });
+    if (m_readBlocks.empty()) {
+        // the blocks read before a failure are handed out first
+        if (m_readError) {
+            std::exception_ptr error = m_readError;
+            m_readError = nullptr;
+            std::rethrow_exception(error);
+        }
+        return 0;
+    }
+
+    // hand the block parsed so far back to the prefetch thread
+    const size_t readLen = m_readBlocks.front().second;
+    m_cache.swap(m_readBlocks.front().first);
+    m_freeBlocks.push_back(std::move(m_readBlocks.front().first));
+    m_readBlocks.pop_front();
+    lock.unlock();
+    m_condition.notify_all();
+
+    return readLen;
+}
+
+#else
+
+template <class T>
+AI_FORCE_INLINE void IOStreamBuffer<T>::startPrefetch() {
+    // blocks are read on demand
+}
+
+template <class T>
+AI_FORCE_INLINE void IOStreamBuffer<T>::stopPrefetch() {
+    // nothing to stop
+}
+
+template <class T>
+AI_FORCE_INLINE size_t IOStreamBuffer<T>::readBlock() {
     m_stream->Seek(m_filePos, aiOrigin_SET);
-    size_t readLen = m_stream->Read(&m_cache[0], sizeof(T), m_cacheSize);
+    return m_stream->Read(&m_cache[0], sizeof(T), m_cacheSize);
+}
+
+#endif
+
+template <class T>
+AI_FORCE_INLINE bool IOStreamBuffer<T>::readNextBlock() {
+    const size_t readLen = readBlock();
     if (readLen == 0) {
         return false;
     }
@@ -345,6 +537,28 @@ AI_FORCE_INLINE bool IOStreamBuffer<T>::getNextBlock(std::vector<T> &buffer) {
     return true;
 }
 
+template <class T>
+AI_FORCE_INLINE bool IOStreamBuffer<T>::getRemainingView(const T *&data, size_t &numItems) {
+    const uint8_t *view = (nullptr == m_stream) ? nullptr : m_stream->GetMemoryView();
+    if (nullptr == view) {
+        return false;
+    }
+
+    stopPrefetch();
+
+    // the cache holds the block before m_filePos, unless nothing was read so far
+    const size_t pos = (0 == m_filePos) ? 0 : m_filePos - m_cacheSize + m_cachePos;
+    data = reinterpret_cast<const T *>(view) + pos;
+    numItems = m_filesize - pos;
+
+    // mark everything as read, so all further reads fail
+    m_filePos = m_filesize;
+    m_cachePos = 0;
+    m_cacheSize = 0;
+
+    return true;
+}
+
 } // namespace Assimp
 
 #endif // AI_IOSTREAMBUFFER_H_INC
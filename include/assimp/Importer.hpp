@@ -642,6 +642,24 @@ public:
      *   is (naturally) not included.*/
     void GetMemoryRequirements(aiMemoryInfo &in) const;
 
+    // -------------------------------------------------------------------
+    /** Returns runtime statistics of the last import.
+     *
+     * Statistics are only collected if #AI_CONFIG_GLOB_MEASURE_TIME is
+     * enabled. They cover #ReadFile() and any later call to
+     * #ApplyPostProcessing().
+     * @param in Data structure to be filled. The region array it
+     *   refers to is owned by the importer and valid until the next
+     *   import. */
+    void GetImportStatistics(aiImportStatistics &in) const;
+
+    // -------------------------------------------------------------------
+    /** Returns the runtime statistics of the last import as JSON document.
+     *
+     * @return The statistics as returned by #GetImportStatistics(),
+     *   formatted as a single JSON object. */
+    std::string GetImportStatisticsJSON() const;
+
     // -------------------------------------------------------------------
     /** Enables "extra verbose" mode.
      *
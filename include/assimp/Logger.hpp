@@ -103,7 +103,9 @@ public:
 
     template<typename... T>
     void debug(T&&... args) {
-        debug(formatMessage(std::forward<T>(args)...).c_str());
+        if (isEnabled(Debugging, DEBUGGING)) {
+            debug(formatMessage(std::forward<T>(args)...).c_str());
+        }
     }
 
     // ----------------------------------------------------------------------
@@ -113,7 +115,9 @@ public:
 
     template<typename... T>
     void verboseDebug(T&&... args) {
-        verboseDebug(formatMessage(std::forward<T>(args)...).c_str());
+        if (isEnabled(Debugging, VERBOSE)) {
+            verboseDebug(formatMessage(std::forward<T>(args)...).c_str());
+        }
     }
 
     // ----------------------------------------------------------------------
@@ -123,7 +127,9 @@ public:
 
     template<typename... T>
     void info(T&&... args) {
-        info(formatMessage(std::forward<T>(args)...).c_str());
+        if (isEnabled(Info)) {
+            info(formatMessage(std::forward<T>(args)...).c_str());
+        }
     }
 
     // ----------------------------------------------------------------------
@@ -133,7 +139,9 @@ public:
 
     template<typename... T>
     void warn(T&&... args) {
-        warn(formatMessage(std::forward<T>(args)...).c_str());
+        if (isEnabled(Warn)) {
+            warn(formatMessage(std::forward<T>(args)...).c_str());
+        }
     }
 
     // ----------------------------------------------------------------------
@@ -143,7 +151,9 @@ public:
 
     template<typename... T>
     void error(T&&... args) {
-        error(formatMessage(std::forward<T>(args)...).c_str());
+        if (isEnabled(Err)) {
+            error(formatMessage(std::forward<T>(args)...).c_str());
+        }
     }
 
     // ----------------------------------------------------------------------
@@ -155,6 +165,18 @@ public:
     /** @brief Get the current log severity*/
     LogSeverity getLogSeverity() const;
 
+    // ----------------------------------------------------------------------
+    /** @brief  Check whether a message would be written anywhere.
+     *
+     *  The variadic logging functions call this before they format their
+     *  arguments, so messages nobody is going to see cost next to nothing.
+     *  The default implementation accepts all messages.
+     *  @param  severity Type of the message
+     *  @param  level    Log severity the logger needs at least to write
+     *    the message, e.g. VERBOSE for verbose debug messages.
+     *  @return false if the message would be discarded anyway. */
+    virtual bool isEnabled(ErrorSeverity severity, LogSeverity level = NORMAL) const;
+
     // ----------------------------------------------------------------------
     /** @brief  Attach a new log-stream
      *
@@ -273,6 +295,13 @@ inline Logger::LogSeverity Logger::getLogSeverity() const {
     return m_Severity;
 }
 
+// ----------------------------------------------------------------------------------
+inline bool Logger::isEnabled(ErrorSeverity severity, LogSeverity level) const {
+    (void)severity;
+    (void)level;
+    return true;
+}
+
 } // Namespace Assimp
 
 // ------------------------------------------------------------------------------------------------
@@ -0,0 +1,150 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/**
+ *  @file Implementation of IOSystem which memory-maps files opened for reading
+ */
+#pragma once
+#ifndef AI_MEMORYMAPPEDIOSYSTEM_H_INC
+#define AI_MEMORYMAPPEDIOSYSTEM_H_INC
+
+#ifdef __GNUC__
+#   pragma GCC system_header
+#endif
+
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/IOStream.hpp>
+
+namespace Assimp {
+
+// ----------------------------------------------------------------------------------
+//! @class  MemoryMappedIOStream
+//! @brief  Read-only IO implementation on top of a memory-mapped file.
+//!
+//! The complete file is mapped when it is opened and is handed out through
+//! GetMemoryView(), so importers supporting it can parse the file in place.
+//! Pages are mapped copy-on-write and are never written back to the file.
+class ASSIMP_API MemoryMappedIOStream final : public IOStream {
+    friend class MemoryMappedIOSystem;
+
+protected:
+    /// @brief The class constructor, takes ownership of the mapping.
+    /// @param data     The start of the mapping.
+    /// @param size     The size of the mapping in bytes.
+    MemoryMappedIOStream(uint8_t *data, size_t size) AI_NO_EXCEPT;
+
+public:
+    /// @brief The class destructor, unmaps the file.
+    ~MemoryMappedIOStream() override;
+
+    // -------------------------------------------------------------------
+    /// Read from the mapped file
+    size_t Read(void *pvBuffer, size_t pSize, size_t pCount) override;
+
+    // -------------------------------------------------------------------
+    /// Always fails, the stream is read-only
+    size_t Write(const void *pvBuffer, size_t pSize, size_t pCount) override;
+
+    // -------------------------------------------------------------------
+    /// Set the read cursor of the file
+    aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override;
+
+    // -------------------------------------------------------------------
+    /// Get the current position of the read cursor
+    size_t Tell() const override;
+
+    // -------------------------------------------------------------------
+    /// Get the size of the file
+    size_t FileSize() const override;
+
+    // -------------------------------------------------------------------
+    /// Nothing to flush for a read-only stream
+    void Flush() override;
+
+    // -------------------------------------------------------------------
+    /// Returns the mapped file contents
+    const uint8_t *GetMemoryView() const override;
+
+private:
+    uint8_t *mData;
+    size_t mSize;
+    size_t mPos;
+};
+
+// ---------------------------------------------------------------------------
+/** @brief IOSystem which memory-maps files opened for reading.
+ *
+ *  Use it for large local assets to avoid the copy most importers make of
+ *  the complete file: @code
+ *  importer.SetIOHandler(new MemoryMappedIOSystem());
+ *  @endcode
+ *  Files opened for writing, in text mode, or which can't be mapped (e.g.
+ *  empty files) are handled by a DefaultIOSystem. */
+class ASSIMP_API MemoryMappedIOSystem : public IOSystem {
+public:
+    // -------------------------------------------------------------------
+    /** Tests for the existence of a file at the given path. */
+    bool Exists(const char *pFile) const override;
+
+    // -------------------------------------------------------------------
+    /** Returns the directory separator. */
+    char getOsSeparator() const override;
+
+    // -------------------------------------------------------------------
+    /** Open a new file with a given path. Files opened with a read-only
+     *  binary mode ("rb") are mapped into memory. */
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override;
+
+    // -------------------------------------------------------------------
+    /** Closes the given file and releases all resources associated with it. */
+    void Close(IOStream *pFile) override;
+
+    // -------------------------------------------------------------------
+    /** Compare two paths */
+    bool ComparePaths(const char *one, const char *second) const override;
+
+private:
+    DefaultIOSystem mFallback;
+};
+
+} //!ns Assimp
+
+#endif //AI_MEMORYMAPPEDIOSYSTEM_H_INC
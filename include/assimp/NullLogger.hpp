@@ -65,6 +65,13 @@ class ASSIMP_API NullLogger
 
 public:
 
+    /** @brief  Rejects all messages, nothing needs to be formatted */
+    bool isEnabled(ErrorSeverity severity, LogSeverity level = NORMAL) const {
+        (void)severity;
+        (void)level;
+        return false;
+    }
+
     /** @brief  Logs a debug message */
     void OnDebug(const char* message) {
         (void)message; //this avoids compiler warnings
@@ -54,18 +54,28 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/TinyFormatter.h>
 
-#include <map>
+#include <string>
+#include <vector>
 
 namespace Assimp::Profiling {
 
 using namespace Formatter;
 
 // ------------------------------------------------------------------------------------------------
-/// @brief Simple wrapper around boost::timer to simplify reporting. 
+/// @brief Simple region timer to measure the runtime of the import steps.
 ///
-/// Timings are automatically dumped to the log file.
+/// Regions may be nested. Timings are measured with a monotonic clock, dumped to
+/// the log file and kept for later queries, see GetRegions().
 class Profiler {
 public:
+    /// @brief A single measured region.
+    struct Region {
+        std::string mName;      ///< The profiling region name.
+        unsigned int mDepth;    ///< The nesting depth, 0 for top-level regions.
+        double mSeconds;        ///< The elapsed time in seconds, valid if mFinished is true.
+        bool mFinished;         ///< true if EndRegion() has been called for the region.
+    };
+
     /// @brief The class constructor.
     Profiler() = default;
 
@@ -75,24 +85,58 @@ public:
     /// @brief Starts a named timer.
     /// @param region    The profiling region name.
     void BeginRegion(const std::string& region) {
-        mRegions[region] = std::chrono::system_clock::now();
+        mRegions.push_back({ region, static_cast<unsigned int>(mOpen.size()), 0.0, false });
+        mOpen.push_back({ mRegions.size() - 1, Clock::now() });
         ASSIMP_LOG_DEBUG("START `",region,"`");
     }
 
     /// @brief End a specific named timer and write its end time to the log.
     /// @param region    The profiling region name.
     void EndRegion(const std::string& region) {
-        if (auto it = mRegions.find(region); it == mRegions.end()) {
+        const auto now = Clock::now();
+        for (auto it = mOpen.rbegin(); it != mOpen.rend(); ++it) {
+            Region &r = mRegions[it->mIndex];
+            if (r.mName != region) {
+                continue;
+            }
+
+            r.mSeconds = std::chrono::duration<double>(now - it->mStart).count();
+            r.mFinished = true;
+            mOpen.erase(std::next(it).base());
+            ASSIMP_LOG_DEBUG("END   `",region,"`, dt= ", r.mSeconds," s");
             return;
         }
+    }
+
+    /// @brief Returns all regions in the order they have been started.
+    /// @return The list of regions.
+    const std::vector<Region>& GetRegions() const {
+        return mRegions;
+    }
 
-        auto elapsedSeconds = std::chrono::system_clock::now() - mRegions[region];
-        ASSIMP_LOG_DEBUG("END   `",region,"`, dt= ", elapsedSeconds.count()," s");
+    /// @brief Returns the accumulated time of all finished regions with a given name.
+    /// @param region    The profiling region name.
+    /// @return The time in seconds.
+    double GetSeconds(const std::string& region) const {
+        double seconds = 0.0;
+        for (const Region &r : mRegions) {
+            if (r.mFinished && r.mName == region) {
+                seconds += r.mSeconds;
+            }
+        }
+        return seconds;
     }
 
 private:
-    using RegionMap = std::map<std::string,std::chrono::time_point<std::chrono::system_clock>>;
-    RegionMap mRegions{};
+    using Clock = std::chrono::steady_clock;
+
+    struct OpenRegion {
+        size_t mIndex;
+        Clock::time_point mStart;
+    };
+
+    std::vector<Region> mRegions{};
+    std::vector<OpenRegion> mOpen{};
 };
 
 } // namespace Assimp::Profiling
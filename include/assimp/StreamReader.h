@@ -92,6 +92,7 @@ public:
     StreamReader(std::shared_ptr<IOStream> stream, bool le = false) :
             mStream(stream),
             mBuffer(nullptr),
+            mOwnsBuffer(true),
             mCurrent(nullptr),
             mEnd(nullptr),
             mLimit(nullptr),
@@ -104,6 +105,7 @@ public:
     StreamReader(IOStream *stream, bool le = false) :
             mStream(std::shared_ptr<IOStream>(stream)),
             mBuffer(nullptr),
+            mOwnsBuffer(true),
             mCurrent(nullptr),
             mEnd(nullptr),
             mLimit(nullptr),
@@ -114,7 +116,9 @@ public:
 
     // ---------------------------------------------------------------------
     ~StreamReader() {
-        delete[] mBuffer;
+        if (mOwnsBuffer) {
+            delete[] mBuffer;
+        }
     }
 
     // deprecated, use overloaded operator>> instead
@@ -203,7 +207,8 @@ public:
     }
 
     // ---------------------------------------------------------------------
-    /** Get the current file pointer */
+    /** Get the current file pointer. The data may belong to the stream
+     *  (see IOStream::GetMemoryView()) and must not be modified. */
     int8_t *GetPtr() const {
         return mCurrent;
     }
@@ -312,6 +317,16 @@ private:
             throw DeadlyImportError("StreamReader: File is empty or EOF is already reached");
         }
 
+        // read straight from the stream's memory if it provides it, the reader keeps the
+        // stream alive, so the memory stays valid for the reader's lifetime
+        if (const uint8_t *view = mStream->GetMemoryView()) {
+            mOwnsBuffer = false;
+            mCurrent = mBuffer = reinterpret_cast<int8_t *>(const_cast<uint8_t *>(view + mStream->Tell()));
+            mEnd = mLimit = mBuffer + filesize;
+            mStream->Seek(0, aiOrigin_END);
+            return;
+        }
+
         mCurrent = mBuffer = new int8_t[filesize];
         const size_t read = mStream->Read(mCurrent, 1, filesize);
         // (read < s) can only happen if the stream was opened in text mode, in which case FileSize() is not reliable
@@ -322,6 +337,7 @@ private:
 private:
     std::shared_ptr<IOStream> mStream;
     int8_t *mBuffer;
+    bool mOwnsBuffer;
     int8_t *mCurrent;
     int8_t *mEnd;
     int8_t *mLimit;
@@ -0,0 +1,241 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file XmlStreamReader.h
+ *  @brief Pull based xml reader which works on a stream instead of a document tree.
+ */
+#pragma once
+#ifndef INCLUDED_AI_XML_STREAM_READER_H
+#define INCLUDED_AI_XML_STREAM_READER_H
+
+#ifdef __GNUC__
+#pragma GCC system_header
+#endif
+
+#include <assimp/XmlParser.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Assimp {
+
+class IOStream;
+
+// ---------------------------------------------------------------------------
+/** @brief Pull based xml reader.
+ *
+ *  In contrast to the XmlParser, which reads the whole file and builds a
+ *  document tree before the first node can be looked at, the XmlStreamReader
+ *  reads the stream block by block and reports one event after the other.
+ *  Only the current block, the attributes of the current element and the
+ *  names of the open elements are kept in memory, so big files can be read
+ *  with a memory footprint which doesn't depend on the size of the document.
+ *
+ *  An example:
+ *  @code
+ *  XmlStreamReader reader(stream);
+ *  while (reader.next() != XmlStreamReader::EndOfDocument) {
+ *      if (reader.getEvent() == XmlStreamReader::StartElement && reader.getName() == "float_array") {
+ *          std::string values;
+ *          reader.readElementText(values);
+ *      }
+ *  }
+ *  @endcode
+ *
+ *  Importers which keep their XmlNode based code for small parts of a file
+ *  can use readSubtree() to get a document tree of a single element, or
+ *  setCapture() to collect the raw text of everything they don't read
+ *  themselves and hand it over to the XmlParser afterwards.
+ *
+ *  Only UTF-8 (and thus ASCII) encoded files are supported, see
+ *  isSupportedEncoding(). Malformed xml causes a DeadlyImportError.
+ */
+class ASSIMP_API XmlStreamReader {
+public:
+    /// @brief The events reported by next().
+    enum EventType {
+        StartElement, ///< A start tag has been read, the attributes are available.
+        EndElement, ///< An end tag has been read. Also reported for empty elements like <a/>.
+        Text, ///< Character data or a CDATA section has been read.
+        EndOfDocument ///< The end of the stream has been reached.
+    };
+
+    /// @brief The default number of bytes read from the stream at once.
+    static constexpr size_t DefaultBlockSize = 1 << 16;
+
+    /// @brief The class constructor.
+    /// @param[in] stream       The stream to read from, is not owned by the reader.
+    /// @param[in] blockSize    The number of bytes to read from the stream at once.
+    explicit XmlStreamReader(IOStream *stream, size_t blockSize = DefaultBlockSize);
+
+    /// @brief The class destructor.
+    ~XmlStreamReader() = default;
+
+    XmlStreamReader(const XmlStreamReader &) = delete;
+    XmlStreamReader &operator=(const XmlStreamReader &) = delete;
+
+    /// @brief Checks the byte order mark and the xml declaration of the stream.
+    /// @return false if the file uses an encoding other than UTF-8. The
+    ///         stream has to be rewound to read it with the XmlParser then.
+    /// @note   Needs to be called before the first call of next().
+    bool isSupportedEncoding();
+
+    /// @brief Reads the next event. Comments, processing instructions, the
+    ///        doctype and text which only consists of whitespaces are skipped.
+    /// @return The type of the event.
+    EventType next();
+
+    /// @brief Will return the type of the current event.
+    /// @return The event type.
+    EventType getEvent() const;
+
+    /// @brief Will return the name of the current element.
+    /// @return The element name for StartElement and EndElement events.
+    const std::string &getName() const;
+
+    /// @brief Will return the depth of the current element, the root element has a depth of 1.
+    /// @return For a Text event the depth of the element containing the text.
+    size_t getDepth() const;
+
+    /// @brief Will return the names of all open elements, the root element comes first.
+    /// @return The path, includes the current element for StartElement and EndElement events.
+    const std::vector<std::string> &getPath() const;
+
+    /// @brief Will return true, if the current start tag was closed by "/>".
+    /// @return true for an empty element. The next event is its EndElement then.
+    bool isEmptyElement() const;
+
+    /// @brief Will return the decoded text of a Text event.
+    /// @return The text.
+    const std::string &getText() const;
+
+    /// @brief Will check if the current start tag has an attribute.
+    /// @param[in] name     The attribute name to look for.
+    /// @return true, if the attribute was found, false if not.
+    bool hasAttribute(const char *name) const;
+
+    /// @brief Will try to get a string attribute value, entities are decoded.
+    /// @param[in] name     The attribute name to look for.
+    /// @param[out] val     The attribute value.
+    /// @return true, if the current start tag contains an attribute with the given name.
+    bool getStdStrAttribute(const char *name, std::string &val) const;
+
+    /// @brief Will try to get an unsigned int attribute value.
+    /// @param[in] name     The attribute name to look for.
+    /// @param[out] val     The unsigned int value from the attribute.
+    /// @return true, if the current start tag contains an attribute with the given name.
+    bool getUIntAttribute(const char *name, unsigned int &val) const;
+
+    /// @brief Will try to get an int attribute value.
+    /// @param[in] name     The attribute name to look for.
+    /// @param[out] val     The int value from the attribute.
+    /// @return true, if the current start tag contains an attribute with the given name.
+    bool getIntAttribute(const char *name, int &val) const;
+
+    /// @brief Will try to get a real attribute value.
+    /// @param[in] name     The attribute name to look for.
+    /// @param[out] val     The real value from the attribute.
+    /// @return true, if the current start tag contains an attribute with the given name.
+    bool getRealAttribute(const char *name, ai_real &val) const;
+
+    /// @brief Reads the text of the current element up to its end tag. The text of
+    ///        child elements is skipped. The current event is the EndElement afterwards.
+    /// @param[out] text    The text of the element.
+    /// @note   Needs to be called on a StartElement event.
+    void readElementText(std::string &text);
+
+    /// @brief Skips the current element with all its children. The current event
+    ///        is the EndElement afterwards.
+    /// @note   Needs to be called on a StartElement event.
+    void skipElement();
+
+    /// @brief Reads the current element with all its children into a document
+    ///        tree. The current event is the EndElement afterwards.
+    /// @param[out] doc     The document which receives the element.
+    /// @return The element node in doc.
+    /// @note   Needs to be called directly after next() returned StartElement.
+    XmlNode readSubtree(pugi::xml_document &doc);
+
+    /// @brief Appends the raw text of everything the reader consumes from now
+    ///        on to a string. This includes the parts skipped by skipElement().
+    /// @param[in] sink     The string to append to, nullptr to stop capturing.
+    void setCapture(std::string *sink);
+
+private:
+    using Attribute = std::pair<std::string, std::string>;
+
+    EventType nextEvent(std::string *text);
+    size_t fill();
+    bool available(size_t count);
+    void flushCapture();
+    size_t findTagEnd();
+    void parseStartTag(size_t tagEnd);
+    void parseEndTag(size_t tagEnd);
+    void readText(std::string *text);
+    void skipPast(const char *terminator, std::string *text);
+    void skipDoctype();
+    const Attribute *findAttribute(const char *name) const;
+
+    IOStream *mStream;
+    size_t mBlockSize;
+    std::vector<char> mBuffer;
+    size_t mPos;
+    size_t mEnd;
+    bool mEof;
+    EventType mEvent;
+    std::string mName;
+    std::string mText;
+    std::vector<Attribute> mAttributes;
+    size_t mNumAttributes;
+    std::vector<std::string> mPath;
+    bool mIsEmpty;
+    bool mPendingEnd;
+    bool mPendingPop;
+    size_t mTagBegin;
+    size_t mTagEnd;
+    std::string *mCapture;
+    size_t mCaptureFrom;
+};
+
+} // namespace Assimp
+
+#endif // INCLUDED_AI_XML_STREAM_READER_H
@@ -375,6 +375,19 @@ ASSIMP_API void aiGetMemoryRequirements(
         const C_STRUCT aiScene *pIn,
         C_STRUCT aiMemoryInfo *in);
 
+// --------------------------------------------------------------------------------
+/** Get the runtime statistics of the import of an asset.
+ *
+ * Statistics are only collected if #AI_CONFIG_GLOB_MEASURE_TIME has been
+ * enabled in the property store passed to #aiImportFileExWithProperties.
+ * @param pIn Input asset.
+ * @param in Data structure to be filled. The region array it refers to is
+ *   valid until the asset is released.
+ */
+ASSIMP_API void aiGetImportStatistics(
+        const C_STRUCT aiScene *pIn,
+        C_STRUCT aiImportStatistics *in);
+
 // --------------------------------------------------------------------------------
 /** Returns an embedded texture, or nullptr.
  * @param pIn Input asset.
@@ -247,12 +247,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /**
  * Define ASSIMP_BUILD_SINGLETHREADED to compile assimp
  * without threading support. The library doesn't utilize
- * threads then and is itself not threadsafe.
+ * threads then and is itself not threadsafe. The CMake option
+ * of the same name sets it in config.h.
  */
 //////////////////////////////////////////////////////////////////////////
-#ifndef ASSIMP_BUILD_SINGLETHREADED
-#  define ASSIMP_BUILD_SINGLETHREADED
-#endif
 
 #if defined(_DEBUG) || !defined(NDEBUG)
 #  define ASSIMP_BUILD_DEBUG
@@ -22,6 +22,7 @@
 #endif
 
 #include <cmath>
+#include <cstring>
 #include <limits>
 #include <stdint.h>
 #include <assimp/defs.h>
@@ -373,6 +374,233 @@ inline ai_real fast_atof( const char** inout) {
     return ret;
 }
 
+// ------------------------------------------------------------------------------------
+// Bulk parsing of whitespace separated numbers, e.g. the contents of a Collada
+// <float_array> or the coordinates of an OBJ vertex.
+// ------------------------------------------------------------------------------------
+namespace Intern {
+
+// Separators between the numbers of a run
+inline bool IsNumberSeparator(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+inline bool IsDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+// Check and convert eight decimal digits at once, in a single 64 bit register.
+// in must point to at least eight readable characters.
+inline bool ParseEightDigits(const char *in, uint32_t &value) {
+#ifdef AI_BUILD_BIG_ENDIAN
+    (void)in;
+    (void)value;
+    return false;
+#else
+    uint64_t v;
+    ::memcpy(&v, in, sizeof(v));
+
+    // all bytes are digits if their high nibble is 3 and adding 6 doesn't change that
+    if (((v & 0xF0F0F0F0F0F0F0F0ull) | (((v + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) != 0x3333333333333333ull) {
+        return false;
+    }
+
+    // combine neighbouring digits to 2, 4 and finally 8 digit numbers
+    v = ((v & 0x0F0F0F0F0F0F0F0Full) * 2561) >> 8;
+    v = ((v & 0x00FF00FF00FF00FFull) * 6553601) >> 16;
+    value = static_cast<uint32_t>(((v & 0x0000FFFF0000FFFFull) * 42949672960001ull) >> 32);
+    return true;
+#endif
+}
+
+// Append the digits starting at in to value, returns the end of the digits.
+// numDigits is incremented by the number of digits read, value overflows
+// silently if there are more than 19 in total.
+inline const char *ParseDigits(const char *in, const char *end, uint64_t &value, unsigned int &numDigits) {
+    uint32_t eight;
+    while (end - in >= 8 && numDigits <= 11 && ParseEightDigits(in, eight)) {
+        value = value * 100000000u + eight;
+        numDigits += 8;
+        in += 8;
+    }
+    for (; in != end && IsDigit(*in); ++in, ++numDigits) {
+        value = value * 10u + static_cast<unsigned int>(*in - '0');
+    }
+    return in;
+}
+
+// Build m * 10^exp10 if this can be done exactly, that is if m and the power of ten
+// are representable and the result is correctly rounded by a single multiplication
+// or division, see Clinger, "How to read floating point numbers accurately".
+template <typename Real>
+inline bool MakeReal(uint64_t m, int exp10, Real &out) {
+    static constexpr double pow10[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    static constexpr float pow10f[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+    if (sizeof(Real) == sizeof(float) && m <= (1ull << 24) && exp10 >= -10 && exp10 <= 10) {
+        const float f = static_cast<float>(m);
+        out = static_cast<Real>(exp10 < 0 ? f / pow10f[-exp10] : f * pow10f[exp10]);
+        return true;
+    }
+    if (m <= (1ull << 53) && exp10 >= -22 && exp10 <= 22) {
+        const double d = static_cast<double>(m);
+        const double p = pow10[exp10 < 0 ? -exp10 : exp10];
+        const double r = exp10 < 0 ? d / p : d * p;
+        if (sizeof(Real) == sizeof(float)) {
+            // Rounding the correctly rounded double to float again is only wrong if it
+            // hit the midpoint between two floats. The exact remainder of the multiply or
+            // divide tells on which side of it the number is then.
+            const float f = static_cast<float>(r);
+            if (static_cast<double>(f) != r) {
+                const float next = std::nextafter(f, r > f ? std::numeric_limits<float>::infinity() : -std::numeric_limits<float>::infinity());
+                if (static_cast<double>(f) + static_cast<double>(next) == 2.0 * r) {
+                    const double remainder = exp10 < 0 ? -std::fma(r, p, -d) : std::fma(d, p, -r);
+                    if (0.0 != remainder) {
+                        const bool up = remainder > 0.0;
+                        out = static_cast<Real>((next > f) == up ? next : f);
+                        return true;
+                    }
+                }
+            }
+            out = static_cast<Real>(f);
+            return true;
+        }
+        out = static_cast<Real>(r);
+        return true;
+    }
+    return false;
+}
+
+// Parse a plain decimal number, [+-]digits[.digits][(e|E)[+-]digits], which MakeReal()
+// can convert exactly. Returns false for everything else, c is left untouched then.
+template <typename Real>
+inline bool ParsePlainReal(const char *&c, const char *end, Real &out) {
+    const char *in = c;
+    const bool inv = in != end && *in == '-';
+    if (in != end && (*in == '-' || *in == '+')) {
+        ++in;
+    }
+
+    uint64_t mantissa = 0;
+    unsigned int numDigits = 0;
+    const char *begin = in;
+    in = ParseDigits(in, end, mantissa, numDigits);
+    const bool hasIntegerPart = in != begin;
+
+    int exp10 = 0;
+    if (in != end && *in == '.') {
+        begin = ++in;
+        in = ParseDigits(in, end, mantissa, numDigits);
+        if (!hasIntegerPart && in == begin) {
+            return false;
+        }
+        exp10 = -static_cast<int>(in - begin);
+    } else if (!hasIntegerPart) {
+        return false;
+    }
+    if (numDigits > 19) {
+        return false;
+    }
+
+    if (in != end && (*in == 'e' || *in == 'E')) {
+        ++in;
+        const bool einv = in != end && *in == '-';
+        if (in != end && (*in == '-' || *in == '+')) {
+            ++in;
+        }
+        if (in == end || !IsDigit(*in)) {
+            return false;
+        }
+        int exp = 0;
+        for (; in != end && IsDigit(*in); ++in) {
+            if (exp < 100000) {
+                exp = exp * 10 + (*in - '0');
+            }
+        }
+        exp10 += einv ? -exp : exp;
+    }
+
+    // leave decimal commas and the like to fast_atoreal_move
+    if (in != end && (*in == ',' || *in == '.')) {
+        return false;
+    }
+
+    Real f = static_cast<Real>(0);
+    if (0 != mantissa && !MakeReal(mantissa, exp10, f)) {
+        return false;
+    }
+    out = inv ? -f : f;
+    c = in;
+    return true;
+}
+
+} // namespace Intern
+
+// ------------------------------------------------------------------------------------
+//! Parse up to count whitespace separated reals starting at c into out. Plain decimal
+//! numbers of moderate precision and range are converted in bulk and correctly rounded,
+//! everything else goes through fast_atoreal_move. Parsing stops at end, at a 0 character or before the first
+//! token which isn't a number, so callers can handle the rest on their own.
+//! @return The number of values read, c points behind the last one.
+// ------------------------------------------------------------------------------------
+template<typename Real, typename ExceptionType = DeadlyImportError>
+inline size_t fast_atoreal_array(const char *&c, const char *end, Real *out, size_t count) {
+    size_t i = 0;
+    for (; i < count; ++i) {
+        const char *in = c;
+        while (in != end && Intern::IsNumberSeparator(*in)) {
+            ++in;
+        }
+        if (in == end || '\0' == *in) {
+            break;
+        }
+        if (!Intern::ParsePlainReal(in, end, out[i])) {
+            const char first = (*in == '-' || *in == '+') && in + 1 != end ? in[1] : *in;
+            if (!Intern::IsDigit(first) && first != '.' && first != ',' &&
+                    first != 'n' && first != 'N' && first != 'i' && first != 'I') {
+                break;
+            }
+            in = fast_atoreal_move<Real, ExceptionType>(in, out[i]);
+        }
+        if (in != end && '\0' != *in && !Intern::IsNumberSeparator(*in)) {
+            break;
+        }
+        c = in;
+    }
+    return i;
+}
+
+// ------------------------------------------------------------------------------------
+//! Parse up to count whitespace separated unsigned decimal integers starting at c
+//! into out. Parsing stops at end, at a 0 character or before the first token
+//! which isn't a plain number.
+//! @return The number of values read, c points behind the last one.
+// ------------------------------------------------------------------------------------
+inline size_t strtoul10_array(const char *&c, const char *end, unsigned int *out, size_t count) {
+    size_t i = 0;
+    for (; i < count; ++i) {
+        const char *in = c;
+        while (in != end && Intern::IsNumberSeparator(*in)) {
+            ++in;
+        }
+        if (in == end || !Intern::IsDigit(*in)) {
+            break;
+        }
+        uint64_t value = 0;
+        unsigned int numDigits = 0;
+        in = Intern::ParseDigits(in, end, value, numDigits);
+        if (in != end && '\0' != *in && !Intern::IsNumberSeparator(*in)) {
+            break;
+        }
+        out[i] = static_cast<unsigned int>(value);
+        c = in;
+    }
+    return i;
+}
+
 } //! namespace Assimp
 
 #endif // FAST_A_TO_F_H_INCLUDED
@@ -826,6 +826,32 @@ struct aiMesh {
      */
     C_STRUCT aiString **mTextureCoordsNames;
 
+    /**
+     * Index storage shared by the faces of the mesh, if they were allocated
+     * contiguously (see aiMesh::AllocateFaces()). Faces whose mIndices point
+     * into this block don't own their indices, the block is released
+     * together with the mesh unless mFaceIndexStorageExternal is set.
+     * nullptr if every face owns its index array.
+     *
+     * @note mFaceIndexStorage, mNumFaceIndexStorage and mFaceIndexStorageExternal
+     * were appended to the struct and change sizeof(aiMesh). This breaks the
+     * binary compatibility of aiMesh with older releases: C and C++ code as well
+     * as language bindings that mirror the layout of aiMesh must be rebuilt
+     * against this header.
+     */
+    unsigned int *mFaceIndexStorage;
+
+    /**
+     * Number of indices in mFaceIndexStorage.
+     */
+    unsigned int mNumFaceIndexStorage;
+
+    /**
+     * Nonzero if mFaceIndexStorage is owned by someone else than the mesh,
+     * e.g. the memory arena of the scene (see #AI_CONFIG_IMPORT_SCENE_ARENA).
+     */
+    unsigned int mFaceIndexStorageExternal;
+
 #ifdef __cplusplus
 
     //! The default class constructor.
@@ -848,7 +874,10 @@ struct aiMesh {
               mAnimMeshes(nullptr),
               mMethod(aiMorphingMethod_UNKNOWN),
               mAABB(),
-              mTextureCoordsNames(nullptr) {
+              mTextureCoordsNames(nullptr),
+              mFaceIndexStorage(nullptr),
+              mNumFaceIndexStorage(0),
+              mFaceIndexStorageExternal(0) {
         // empty
     }
 
@@ -894,9 +923,116 @@ struct aiMesh {
             delete[] mAnimMeshes;
         }
 
+        // faces in the shared storage must not release their indices
+        if (nullptr != mFaceIndexStorage) {
+            for (unsigned int a = 0; mFaces && a < mNumFaces; a++) {
+                if (IsInFaceIndexStorage(mFaces[a])) {
+                    mFaces[a].mIndices = nullptr;
+                }
+            }
+            if (!mFaceIndexStorageExternal) {
+                delete[] mFaceIndexStorage;
+            }
+        }
+
         delete[] mFaces;
     }
 
+    //! @brief Allocates the index storage shared by the faces of the mesh.
+    //! Faces are pointed into it by the caller, faces without indices must
+    //! keep a nullptr. A previous storage is released, no face may still
+    //! point into it.
+    //! @param  numIndices  Total number of indices of all faces.
+    //! @return Pointer to the storage.
+    unsigned int *AllocateFaceIndexStorage(unsigned int numIndices) {
+        SetFaceIndexStorage(new unsigned int[numIndices], numIndices, false);
+        return mFaceIndexStorage;
+    }
+
+    //! @brief Uses a block allocated by the caller as the index storage
+    //! shared by the faces of the mesh, see AllocateFaceIndexStorage().
+    //! @param  storage     The block, holds at least numIndices indices.
+    //! @param  numIndices  Total number of indices of all faces.
+    //! @param  external    The block is owned by the caller and must
+    //!                     outlive the mesh. Otherwise the mesh takes it
+    //!                     over and releases it with delete[].
+    void SetFaceIndexStorage(unsigned int *storage, unsigned int numIndices, bool external) {
+        if (!mFaceIndexStorageExternal) {
+            delete[] mFaceIndexStorage;
+        }
+        mFaceIndexStorage = storage;
+        mNumFaceIndexStorage = numIndices;
+        mFaceIndexStorageExternal = external ? 1 : 0;
+    }
+
+    //! @brief Allocates the faces of the mesh and their index arrays.
+    //! @param  numFaces    Number of faces.
+    //! @param  numIndices  Number of indices for each face.
+    //! @param  contiguous  Keep the indices of all faces in one block owned
+    //!                     by the mesh, instead of one array per face.
+    //! @param  external    With contiguous, a block for the indices of all
+    //!                     faces to use instead of allocating one. It is
+    //!                     owned by the caller and must outlive the mesh.
+    void AllocateFaces(unsigned int numFaces, const unsigned int *numIndices, bool contiguous,
+            unsigned int *external = nullptr) {
+        mNumFaces = numFaces;
+        mFaces = new aiFace[numFaces];
+
+        unsigned int *storage = nullptr;
+        if (contiguous) {
+            unsigned int total = 0;
+            for (unsigned int a = 0; a < numFaces; a++) {
+                total += numIndices[a];
+            }
+            if (external) {
+                SetFaceIndexStorage(external, total, true);
+                storage = external;
+            } else {
+                storage = AllocateFaceIndexStorage(total);
+            }
+        }
+        for (unsigned int a = 0; a < numFaces; a++) {
+            aiFace &face = mFaces[a];
+            face.mNumIndices = numIndices[a];
+            if (0 == face.mNumIndices) {
+                continue;
+            }
+            if (storage) {
+                face.mIndices = storage;
+                storage += face.mNumIndices;
+            } else {
+                face.mIndices = new unsigned int[face.mNumIndices];
+            }
+        }
+    }
+
+    //! @brief Same as above, for faces with the same number of indices.
+    void AllocateFaces(unsigned int numFaces, unsigned int numIndices, bool contiguous,
+            unsigned int *external = nullptr) {
+        mNumFaces = numFaces;
+        mFaces = new aiFace[numFaces];
+
+        unsigned int *storage = nullptr;
+        if (contiguous && external) {
+            SetFaceIndexStorage(external, numFaces * numIndices, true);
+            storage = external;
+        } else if (contiguous) {
+            storage = AllocateFaceIndexStorage(numFaces * numIndices);
+        }
+        for (unsigned int a = 0; numIndices && a < numFaces; a++) {
+            aiFace &face = mFaces[a];
+            face.mNumIndices = numIndices;
+            face.mIndices = storage ? storage + a * numIndices : new unsigned int[numIndices];
+        }
+    }
+
+    //! @brief Check whether the indices of a face are kept in the index
+    //!        storage of the mesh, see mFaceIndexStorage.
+    bool IsInFaceIndexStorage(const aiFace &face) const {
+        return nullptr != mFaceIndexStorage && nullptr != face.mIndices &&
+               face.mIndices >= mFaceIndexStorage && face.mIndices < mFaceIndexStorage + mNumFaceIndexStorage;
+    }
+
     //! @brief Check whether the mesh contains positions. Provided no special
     //!        scene flags are set, this will always be true
     //! @return true, if positions are stored, false if not.
@@ -542,6 +542,86 @@ struct aiMemoryInfo {
     unsigned int total;
 }; // !struct aiMemoryInfo
 
+// ----------------------------------------------------------------------------------
+/** Stores the time spent in a single profiled region of an import, e.g.
+ *  the importer itself or a specific post-processing step.
+ *  @see aiImportStatistics
+*/
+struct aiProfileRegion {
+#ifdef __cplusplus
+
+    /** Default constructor */
+    aiProfileRegion() AI_NO_EXCEPT
+            : name(),
+              depth(0),
+              seconds(0.0) {}
+
+#endif
+
+    /** Name of the region */
+    C_STRUCT aiString name;
+
+    /** Nesting depth of the region, 0 for top-level regions */
+    unsigned int depth;
+
+    /** Time spent in the region, in seconds */
+    double seconds;
+}; // !struct aiProfileRegion
+
+// ----------------------------------------------------------------------------------
+/** Stores runtime statistics of the last import. Statistics are only collected
+ *  if #AI_CONFIG_GLOB_MEASURE_TIME is enabled, otherwise all members are zero.
+ *  All times are measured with a monotonic clock and given in seconds.
+ *  @see Importer::GetImportStatistics()
+*/
+struct aiImportStatistics {
+#ifdef __cplusplus
+
+    /** Default constructor */
+    aiImportStatistics() AI_NO_EXCEPT
+            : totalTime(0.0),
+              importTime(0.0),
+              preprocessTime(0.0),
+              postprocessTime(0.0),
+              bytesRead(0),
+              processPeakMemory(0),
+              numRegions(0),
+              regions(nullptr) {}
+
+#endif
+
+    /** Sum of the top-level regions: the time spent in ReadFile() plus the
+     *  time spent in post-processing applied afterwards through
+     *  Importer::ApplyPostProcessing() */
+    double totalTime;
+
+    /** Time spent in the file format importer */
+    double importTime;
+
+    /** Time spent in the scene preprocessor */
+    double preprocessTime;
+
+    /** Time spent in all post-processing steps */
+    double postprocessTime;
+
+    /** Number of bytes read through the IOSystem by the file format importer */
+    uint64_t bytesRead;
+
+    /** High-water mark of the resident memory of the whole process, in
+     *  bytes, queried after the import. This is not the memory used by the
+     *  import: it includes everything else the process has allocated and
+     *  keeps the peak of earlier imports. 0 if not supported on this platform. */
+    uint64_t processPeakMemory;
+
+    /** Number of entries in regions */
+    unsigned int numRegions;
+
+    /** All profiled regions in the order they have been entered, including
+     *  one region per executed post-processing step. The array is owned by
+     *  the importer and valid until the next import. */
+    const C_STRUCT aiProfileRegion *regions;
+}; // !struct aiImportStatistics
+
 /**
  *  @brief  Type to store a in-memory data buffer.
  */
@@ -777,7 +777,17 @@ class Mesh(Structure):
             ("mAABB", 2 * Vector3D),
 
             # Vertex UV stream names. Pointer to array of size AI_MAX_NUMBER_OF_TEXTURECOORDS
-            ("mTextureCoordsNames", POINTER(POINTER(String)))
+            ("mTextureCoordsNames", POINTER(POINTER(String))),
+
+            # Index storage shared by the faces of the mesh, if they were
+            # allocated contiguously. NULL if every face owns its indices.
+            ("mFaceIndexStorage", POINTER(c_uint)),
+
+            # Number of indices in mFaceIndexStorage.
+            ("mNumFaceIndexStorage", c_uint),
+
+            # Nonzero if mFaceIndexStorage is owned by someone else than the mesh.
+            ("mFaceIndexStorageExternal", c_uint)
 
         ]
 
@@ -0,0 +1,139 @@
+/*-------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+-------------------------------------------------------------------------*/
+#include "UnitTestPCH.h"
+
+#include <assimp/BufferedTextWriter.h>
+#include <assimp/Exceptional.h>
+#include <assimp/IOStream.hpp>
+
+#include <clocale>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace Assimp;
+
+namespace {
+
+// Collects everything written into a string and counts the calls to Write().
+class StringIOStream : public IOStream {
+public:
+    size_t Read(void *, size_t, size_t) override { return 0; }
+    size_t Write(const void *buffer, size_t size, size_t count) override {
+        text.append(static_cast<const char *>(buffer), size * count);
+        ++writes;
+        return count;
+    }
+    aiReturn Seek(size_t, aiOrigin) override { return aiReturn_FAILURE; }
+    size_t Tell() const override { return text.size(); }
+    size_t FileSize() const override { return text.size(); }
+    void Flush() override {}
+
+    std::string text;
+    size_t writes = 0;
+};
+
+} // namespace
+
+TEST(utBufferedTextWriter, writeTextAndNumbersTest) {
+    StringIOStream stream;
+    BufferedTextWriter writer(&stream);
+    writer << "v " << 1 << ' ' << -2L << ' ' << 3U << ' ' << std::string("str") << ' ' << aiString("ai") << '\n';
+    writer << 0.5f << ' ' << 0.1f << ' ' << -1.0 << ' ' << 1e20f << ' ' << 0.0f;
+    EXPECT_EQ(0U, stream.writes);
+    writer.flush();
+    EXPECT_EQ("v 1 -2 3 str ai\n0.5 0.1 -1 1e+20 0", stream.text);
+    EXPECT_EQ(stream.text.size(), writer.tell());
+}
+
+TEST(utBufferedTextWriter, realsRoundTripTest) {
+    const float floats[] = { 0.1f, 1.0f / 3.0f, std::numeric_limits<float>::min(), std::numeric_limits<float>::max(), -123456.789f };
+    const double doubles[] = { 0.1, 1.0 / 3.0, std::numeric_limits<double>::max(), -1e-300 };
+
+    // the decimal point mustn't depend on the locale
+    std::setlocale(LC_NUMERIC, "de_DE.UTF-8");
+    std::vector<std::string> texts;
+    char buffer[BufferedTextWriter::MaxNumberLength];
+    for (float f : floats) {
+        texts.emplace_back(buffer, BufferedTextWriter::format(buffer, f));
+    }
+    for (double d : doubles) {
+        texts.emplace_back(buffer, BufferedTextWriter::format(buffer, d));
+    }
+    std::setlocale(LC_NUMERIC, "C");
+
+    size_t i = 0;
+    for (float f : floats) {
+        EXPECT_EQ(f, std::strtof(texts[i].c_str(), nullptr)) << texts[i];
+        ++i;
+    }
+    for (double d : doubles) {
+        EXPECT_EQ(d, std::strtod(texts[i].c_str(), nullptr)) << texts[i];
+        ++i;
+    }
+}
+
+TEST(utBufferedTextWriter, smallBufferTest) {
+    StringIOStream stream;
+    // smaller than MaxNumberLength, the writer uses at least that much
+    BufferedTextWriter writer(&stream, 4);
+    std::string expected;
+    for (int i = 0; i < 100; ++i) {
+        writer << i << ' ' << "some longer text, which doesn't fit into the buffer" << '\n';
+        expected += std::to_string(i) + " some longer text, which doesn't fit into the buffer\n";
+    }
+    writer.flush();
+    EXPECT_EQ(expected, stream.text);
+    EXPECT_GT(stream.writes, 1U);
+}
+
+TEST(utBufferedTextWriter, noStreamTest) {
+    BufferedTextWriter writer;
+    writer << "pending";
+    EXPECT_EQ(7U, writer.tell());
+    EXPECT_THROW(writer.flush(), DeadlyExportError);
+
+    StringIOStream stream;
+    BufferedTextWriter other;
+    other.setStream(&stream);
+    other << "text";
+    other.flush();
+    EXPECT_EQ("text", stream.text);
+}
@@ -0,0 +1,145 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+#include "UnitTestPCH.h"
+#include "Common/HeaderCacheIOSystem.h"
+
+#include <assimp/MemoryIOWrapper.h>
+
+#include <string>
+#include <vector>
+
+using namespace Assimp;
+
+namespace {
+
+// IOSystem serving one file from memory, counts the streams opened and closed
+class CountingIOSystem : public IOSystem {
+public:
+    CountingIOSystem(const std::string &file, const std::vector<uint8_t> &data) :
+            mFile(file), mData(data), mNumOpened(0), mNumClosed(0) {
+        // empty
+    }
+
+    bool Exists(const char *pFile) const override {
+        return mFile == pFile;
+    }
+
+    char getOsSeparator() const override {
+        return '/';
+    }
+
+    IOStream *Open(const char *pFile, const char *) override {
+        if (mFile != pFile) {
+            return nullptr;
+        }
+        ++mNumOpened;
+        return new MemoryIOStream(mData.data(), mData.size());
+    }
+
+    void Close(IOStream *pFile) override {
+        ++mNumClosed;
+        delete pFile;
+    }
+
+    std::string mFile;
+    std::vector<uint8_t> mData;
+    unsigned int mNumOpened;
+    unsigned int mNumClosed;
+};
+
+} // namespace
+
+class utHeaderCacheIOSystem : public ::testing::Test {
+    // empty
+};
+
+TEST_F(utHeaderCacheIOSystem, headerIsReadOnFirstOpenTest) {
+    CountingIOSystem io("test.bin", std::vector<uint8_t>(64, 7));
+    HeaderCacheIOSystem cache(&io, "test.bin", 16);
+    EXPECT_EQ(0u, io.mNumOpened);
+
+    // the size is queried without reading the header
+    EXPECT_EQ(64u, cache.GetFileSize());
+    EXPECT_EQ(1u, io.mNumOpened);
+    EXPECT_EQ(1u, io.mNumClosed);
+
+    IOStream *first = cache.Open("test.bin", "rb");
+    ASSERT_NE(nullptr, first);
+    EXPECT_EQ(2u, io.mNumOpened);
+    IOStream *second = cache.Open("test.bin", "rb");
+    ASSERT_NE(nullptr, second);
+    EXPECT_EQ(2u, io.mNumOpened);
+    cache.Close(first);
+    cache.Close(second);
+
+    // the probe stream is closed through the wrapped system
+    EXPECT_EQ(2u, io.mNumClosed);
+    EXPECT_EQ(64u, cache.GetFileSize());
+    EXPECT_EQ(2u, io.mNumOpened);
+}
+
+TEST_F(utHeaderCacheIOSystem, streamOutlivesSystemTest) {
+    std::vector<uint8_t> data(64);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i);
+    }
+    CountingIOSystem io("test.bin", data);
+
+    IOStream *stream = nullptr;
+    {
+        HeaderCacheIOSystem cache(&io, "test.bin", 16);
+        stream = cache.Open("test.bin", "rb");
+    }
+    ASSERT_NE(nullptr, stream);
+
+    // Served from the cached header, then from the wrapped file
+    uint8_t header[8] = {};
+    EXPECT_EQ(8u, stream->Read(header, 1, 8));
+    EXPECT_EQ(std::vector<uint8_t>(data.begin(), data.begin() + 8), std::vector<uint8_t>(header, header + 8));
+    EXPECT_EQ(aiReturn_SUCCESS, stream->Seek(32, aiOrigin_SET));
+    uint8_t tail[8] = {};
+    EXPECT_EQ(8u, stream->Read(tail, 1, 8));
+    EXPECT_EQ(std::vector<uint8_t>(data.begin() + 32, data.begin() + 40), std::vector<uint8_t>(tail, tail + 8));
+
+    delete stream;
+    EXPECT_EQ(io.mNumOpened, io.mNumClosed);
+}
@@ -40,8 +40,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "UnitTestPCH.h"
+#include "UTLogStream.h"
+#include <assimp/AsyncLogStream.hpp>
+#include <assimp/DefaultLogger.hpp>
 #include <assimp/Importer.hpp>
 
+#include <thread>
+
 using namespace Assimp;
 class utLogger : public ::testing::Test {};
 
@@ -50,3 +55,97 @@ TEST_F(utLogger, aiGetPredefinedLogStream_leak_test) {
     aiLogStream stream2 = aiGetPredefinedLogStream(aiDefaultLogStream_STDOUT, nullptr);
     ASSERT_EQ(stream1.callback, stream2.callback);
 }
+
+namespace {
+
+// Counts how often it is formatted
+struct FormatCounter {
+    int *count;
+};
+
+std::ostream &operator<<(std::ostream &os, const FormatCounter &counter) {
+    ++*counter.count;
+    return os << "counted";
+}
+
+} // namespace
+
+TEST_F(utLogger, skipFormattingOfDiscardedMessages) {
+    Logger *logger = DefaultLogger::get();
+    const Logger::LogSeverity severity = logger->getLogSeverity();
+    UTLogStream *stream = new UTLogStream;
+    ASSERT_TRUE(logger->attachStream(stream, Logger::Warn));
+
+    int count = 0;
+    logger->setLogSeverity(Logger::DEBUGGING);
+    EXPECT_TRUE(logger->isEnabled(Logger::Debugging, Logger::DEBUGGING));
+    EXPECT_FALSE(logger->isEnabled(Logger::Debugging, Logger::VERBOSE));
+    logger->verboseDebug("verbose ", FormatCounter{ &count });
+    EXPECT_EQ(0, count);
+    logger->debug("debug ", FormatCounter{ &count });
+    EXPECT_EQ(1, count);
+    logger->warn("warn ", FormatCounter{ &count });
+    EXPECT_EQ(2, count);
+    ASSERT_EQ(1u, stream->m_messages.size());
+    EXPECT_NE(std::string::npos, stream->m_messages[0].find("warn counted"));
+
+    ASSERT_TRUE(logger->detachStream(stream, Logger::Warn));
+    delete stream;
+    logger->setLogSeverity(severity);
+
+
+    NullLogger nullLogger;
+    EXPECT_FALSE(nullLogger.isEnabled(Logger::Err));
+    nullLogger.error("error ", FormatCounter{ &count });
+    EXPECT_EQ(2, count);
+}
+
+TEST_F(utLogger, attachStreamTwiceAddsSeverities) {
+    // use a logger of our own, the global one has streams for all severities
+    Logger *previous = DefaultLogger::get();
+    DefaultLogger::set(nullptr);
+    Logger *logger = DefaultLogger::create("", Logger::NORMAL, 0);
+
+    UTLogStream *stream = new UTLogStream;
+    ASSERT_TRUE(logger->attachStream(stream, Logger::Info));
+    ASSERT_TRUE(logger->attachStream(stream, Logger::Err));
+    EXPECT_TRUE(logger->isEnabled(Logger::Info));
+    EXPECT_TRUE(logger->isEnabled(Logger::Err));
+    EXPECT_FALSE(logger->isEnabled(Logger::Warn));
+
+    logger->error("attached twice");
+    ASSERT_EQ(1u, stream->m_messages.size());
+    EXPECT_NE(std::string::npos, stream->m_messages[0].find("attached twice"));
+
+    // also deletes the stream
+    DefaultLogger::kill();
+    DefaultLogger::set(previous);
+}
+
+TEST_F(utLogger, asyncLogStream) {
+    UTLogStream *target = new UTLogStream;
+    AsyncLogStream *stream = new AsyncLogStream(target);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([stream, t] {
+            for (int i = 0; i < 100; ++i) {
+                stream->write((std::to_string(t) + " " + std::to_string(i)).c_str());
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    stream->flush();
+
+    // all messages are there, in order per thread
+    ASSERT_EQ(400u, target->m_messages.size());
+    int next[4] = {};
+    for (const std::string &message : target->m_messages) {
+        const int t = message[0] - '0';
+        ASSERT_EQ(std::to_string(t) + " " + std::to_string(next[t]), message);
+        ++next[t];
+    }
+    delete stream;
+}
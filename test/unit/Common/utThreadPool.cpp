@@ -0,0 +1,127 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+#include "UnitTestPCH.h"
+#include "Common/ThreadPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+using namespace Assimp;
+
+class utThreadPool : public ::testing::Test {
+    // empty
+};
+
+TEST_F(utThreadPool, numThreadsTest) {
+    ThreadPool single(1);
+    EXPECT_EQ(1u, single.GetNumThreads());
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    ThreadPool four(4);
+    EXPECT_EQ(4u, four.GetNumThreads());
+#endif
+
+    ThreadPool hw;
+    EXPECT_GE(hw.GetNumThreads(), 1u);
+}
+
+TEST_F(utThreadPool, itemsRunConcurrentlyTest) {
+#ifdef ASSIMP_BUILD_SINGLETHREADED
+    GTEST_SKIP() << "assimp has been built without threading support";
+#else
+    // every item waits until all items have started, which only
+    // happens if they really run at the same time
+    constexpr unsigned int NumThreads = 4;
+    ThreadPool pool(NumThreads);
+    ASSERT_EQ(NumThreads, pool.GetNumThreads());
+
+    std::mutex mutex;
+    std::condition_variable started;
+    unsigned int numStarted = 0;
+    std::atomic<unsigned int> numTimedOut(0);
+    pool.ParallelFor(NumThreads, [&](size_t) {
+        std::unique_lock<std::mutex> lock(mutex);
+        ++numStarted;
+        started.notify_all();
+        if (!started.wait_for(lock, std::chrono::seconds(30), [&]() { return numStarted == NumThreads; })) {
+            ++numTimedOut;
+        }
+    });
+    EXPECT_EQ(NumThreads, numStarted);
+    EXPECT_EQ(0u, numTimedOut.load());
+#endif
+}
+
+TEST_F(utThreadPool, parallelForVisitsAllItemsTest) {
+    ThreadPool pool(4);
+    std::vector<int> visited(1000, 0);
+    pool.ParallelFor(visited.size(), [&visited](size_t i) {
+        ++visited[i];
+    });
+    for (int v : visited) {
+        EXPECT_EQ(1, v);
+    }
+}
+
+TEST_F(utThreadPool, nestedParallelForTest) {
+    ThreadPool pool(2);
+    std::atomic<size_t> sum(0);
+    pool.ParallelFor(8, [&pool, &sum](size_t) {
+        pool.ParallelFor(8, [&sum](size_t j) {
+            sum += j;
+        });
+    });
+    EXPECT_EQ(8u * 28u, sum.load());
+}
+
+TEST_F(utThreadPool, exceptionIsRethrownTest) {
+    ThreadPool pool(3);
+    EXPECT_THROW(pool.ParallelFor(100, [](size_t i) {
+        if (i == 42) {
+            throw std::runtime_error("failed");
+        }
+    }), std::runtime_error);
+}
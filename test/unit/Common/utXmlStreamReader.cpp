@@ -0,0 +1,241 @@
+/*-------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+-------------------------------------------------------------------------*/
+#include "UnitTestPCH.h"
+#include <assimp/XmlStreamReader.h>
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/MemoryIOWrapper.h>
+
+using namespace Assimp;
+
+namespace {
+
+const char TestDocument[] =
+        "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+        "<!DOCTYPE root [ <!ELEMENT root ANY> ]>\n"
+        "<root version=\"1.4\">\n"
+        "  <!-- a comment with <tags> -->\n"
+        "  <empty id='e&amp;1'/>\n"
+        "  <array count=\"4\">1 2 &lt;3&gt;\r\n4</array>\n"
+        "  <nested a=\"1\"><child>text</child>tail</nested>\n"
+        "  <cdata><![CDATA[<not a tag>]]></cdata>\n"
+        "</root>\n";
+
+MemoryIOStream *CreateStream(const char *text) {
+    return new MemoryIOStream(reinterpret_cast<const uint8_t *>(text), std::strlen(text));
+}
+
+} // namespace
+
+class utXmlStreamReader : public ::testing::Test {
+protected:
+    DefaultIOSystem mIoSystem;
+};
+
+TEST_F(utXmlStreamReader, readEventsTest) {
+    std::unique_ptr<IOStream> stream(CreateStream(TestDocument));
+    // a tiny block size makes the reader refill its buffer in the middle of tags and entities
+    XmlStreamReader reader(stream.get(), 7);
+    EXPECT_TRUE(reader.isSupportedEncoding());
+
+    EXPECT_EQ(XmlStreamReader::StartElement, reader.next());
+    EXPECT_EQ("root", reader.getName());
+    EXPECT_EQ(1U, reader.getDepth());
+    std::string version;
+    EXPECT_TRUE(reader.getStdStrAttribute("version", version));
+    EXPECT_EQ("1.4", version);
+
+    EXPECT_EQ(XmlStreamReader::StartElement, reader.next());
+    EXPECT_EQ("empty", reader.getName());
+    EXPECT_TRUE(reader.isEmptyElement());
+    std::string id;
+    EXPECT_TRUE(reader.getStdStrAttribute("id", id));
+    EXPECT_EQ("e&1", id);
+    EXPECT_FALSE(reader.hasAttribute("name"));
+    EXPECT_EQ(XmlStreamReader::EndElement, reader.next());
+    EXPECT_EQ("empty", reader.getName());
+    EXPECT_EQ(2U, reader.getDepth());
+
+    EXPECT_EQ(XmlStreamReader::StartElement, reader.next());
+    unsigned int count = 0;
+    EXPECT_TRUE(reader.getUIntAttribute("count", count));
+    EXPECT_EQ(4U, count);
+    std::string text;
+    reader.readElementText(text);
+    EXPECT_EQ("1 2 <3>\n4", text);
+    EXPECT_EQ(XmlStreamReader::EndElement, reader.getEvent());
+    EXPECT_EQ("array", reader.getName());
+
+    EXPECT_EQ(XmlStreamReader::StartElement, reader.next());
+    EXPECT_EQ("nested", reader.getName());
+    EXPECT_EQ(XmlStreamReader::StartElement, reader.next());
+    EXPECT_EQ("child", reader.getName());
+    ASSERT_EQ(3U, reader.getPath().size());
+    EXPECT_EQ("nested", reader.getPath()[1]);
+    EXPECT_EQ(XmlStreamReader::Text, reader.next());
+    EXPECT_EQ("text", reader.getText());
+    EXPECT_EQ(3U, reader.getDepth());
+    EXPECT_EQ(XmlStreamReader::EndElement, reader.next());
+    EXPECT_EQ(XmlStreamReader::Text, reader.next());
+    EXPECT_EQ("tail", reader.getText());
+    EXPECT_EQ(XmlStreamReader::EndElement, reader.next());
+    EXPECT_EQ("nested", reader.getName());
+
+    EXPECT_EQ(XmlStreamReader::StartElement, reader.next());
+    reader.readElementText(text);
+    EXPECT_EQ("<not a tag>", text);
+
+    EXPECT_EQ(XmlStreamReader::EndElement, reader.next());
+    EXPECT_EQ("root", reader.getName());
+    EXPECT_EQ(XmlStreamReader::EndOfDocument, reader.next());
+}
+
+TEST_F(utXmlStreamReader, skipAndSubtreeTest) {
+    std::unique_ptr<IOStream> stream(CreateStream(TestDocument));
+    XmlStreamReader reader(stream.get(), 5);
+    EXPECT_EQ(XmlStreamReader::StartElement, reader.next());
+
+    std::vector<std::string> names;
+    pugi::xml_document doc;
+    while (reader.next() != XmlStreamReader::EndOfDocument) {
+        if (reader.getEvent() != XmlStreamReader::StartElement) {
+            continue;
+        }
+        names.push_back(reader.getName());
+        if (reader.getName() == "nested") {
+            XmlNode nested = reader.readSubtree(doc);
+            EXPECT_STREQ("nested", nested.name());
+            EXPECT_EQ(1, nested.attribute("a").as_int());
+            EXPECT_STREQ("text", nested.child("child").text().as_string());
+            EXPECT_EQ("nested", reader.getName());
+        } else {
+            reader.skipElement();
+        }
+        EXPECT_EQ(XmlStreamReader::EndElement, reader.getEvent());
+    }
+
+    const std::vector<std::string> expected = { "empty", "array", "nested", "cdata" };
+    EXPECT_EQ(expected, names);
+}
+
+TEST_F(utXmlStreamReader, captureTest) {
+    std::unique_ptr<IOStream> stream(CreateStream(TestDocument));
+    XmlStreamReader reader(stream.get(), 11);
+    std::string captured;
+    reader.setCapture(&captured);
+
+    // leave out the contents of <array>, everything else is passed through unchanged
+    while (reader.next() != XmlStreamReader::EndOfDocument) {
+        if (reader.getEvent() == XmlStreamReader::StartElement && reader.getName() == "array") {
+            reader.setCapture(nullptr);
+            reader.skipElement();
+            captured += "</array>";
+            reader.setCapture(&captured);
+        }
+    }
+
+    std::string expected(TestDocument);
+    const size_t begin = expected.find("1 2");
+    expected.erase(begin, expected.find("</array>") - begin);
+    EXPECT_EQ(expected, captured);
+}
+
+TEST_F(utXmlStreamReader, malformedTest) {
+    const char *documents[] = {
+        "<a><b></a>",
+        "<a x=1></a>",
+        "<a><b>",
+        "<a x=\"1></a>"
+    };
+    for (const char *document : documents) {
+        std::unique_ptr<IOStream> stream(CreateStream(document));
+        XmlStreamReader reader(stream.get());
+        EXPECT_THROW({
+            while (reader.next() != XmlStreamReader::EndOfDocument) {
+            }
+        }, DeadlyImportError) << document;
+    }
+}
+
+TEST_F(utXmlStreamReader, encodingTest) {
+    static const char utf16[] = "\xFF\xFE<\0a\0/\0>\0";
+    MemoryIOStream utf16Stream(reinterpret_cast<const uint8_t *>(utf16), sizeof(utf16) - 1);
+    XmlStreamReader utf16Reader(&utf16Stream);
+    EXPECT_FALSE(utf16Reader.isSupportedEncoding());
+
+    std::unique_ptr<IOStream> latin1Stream(CreateStream("<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?><a/>"));
+    XmlStreamReader latin1Reader(latin1Stream.get());
+    EXPECT_FALSE(latin1Reader.isSupportedEncoding());
+
+    std::unique_ptr<IOStream> bomStream(CreateStream("\xEF\xBB\xBF<a/>"));
+    XmlStreamReader bomReader(bomStream.get());
+    EXPECT_TRUE(bomReader.isSupportedEncoding());
+    EXPECT_EQ(XmlStreamReader::StartElement, bomReader.next());
+    EXPECT_EQ("a", bomReader.getName());
+}
+
+TEST_F(utXmlStreamReader, sameElementsAsXmlParserTest) {
+    const std::string filename = ASSIMP_TEST_MODELS_DIR "/X3D/ComputerKeyboard.x3d";
+    std::unique_ptr<IOStream> domStream(mIoSystem.Open(filename.c_str(), "rb"));
+    ASSERT_NE(nullptr, domStream.get());
+    XmlParser parser;
+    ASSERT_TRUE(parser.parse(domStream.get()));
+    XmlNode root = parser.getRootNode();
+    XmlNodeIterator nodeIt(root, XmlNodeIterator::PreOrderMode);
+
+    std::unique_ptr<IOStream> stream(mIoSystem.Open(filename.c_str(), "rb"));
+    ASSERT_NE(nullptr, stream.get());
+    XmlStreamReader reader(stream.get(), 4096);
+    ASSERT_TRUE(reader.isSupportedEncoding());
+    XmlNode node;
+    size_t numElements = 0;
+    while (reader.next() != XmlStreamReader::EndOfDocument) {
+        if (reader.getEvent() != XmlStreamReader::StartElement) {
+            continue;
+        }
+        ASSERT_TRUE(nodeIt.getNext(node));
+        EXPECT_EQ(node.name(), reader.getName());
+        for (XmlAttribute attribute : node.attributes()) {
+            std::string value;
+            EXPECT_TRUE(reader.getStdStrAttribute(attribute.name(), value));
+            EXPECT_EQ(attribute.value(), value);
+        }
+        ++numElements;
+    }
+    EXPECT_EQ(nodeIt.size(), numElements);
+}
@@ -0,0 +1,218 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "SceneComparison.h"
+
+#include <assimp/scene.h>
+
+#include <cstring>
+
+namespace Assimp {
+
+namespace {
+
+using ::testing::AssertionFailure;
+using ::testing::AssertionResult;
+using ::testing::AssertionSuccess;
+
+template <typename T>
+AssertionResult CompareArrays(const char *what, const T *expected, const T *actual, unsigned int count) {
+    if ((nullptr == expected) != (nullptr == actual)) {
+        return AssertionFailure() << what << " present in only one scene";
+    }
+    if (nullptr == expected) {
+        return AssertionSuccess();
+    }
+    for (unsigned int i = 0; i < count; ++i) {
+        if (!(expected[i] == actual[i])) {
+            return AssertionFailure() << what << " differ at index " << i;
+        }
+    }
+    return AssertionSuccess();
+}
+
+AssertionResult CompareMeshes(const aiMesh *expected, const aiMesh *actual) {
+    if (expected->mName != actual->mName) {
+        return AssertionFailure() << "name '" << expected->mName.C_Str() << "' != '" << actual->mName.C_Str() << "'";
+    }
+    if (expected->mPrimitiveTypes != actual->mPrimitiveTypes) {
+        return AssertionFailure() << "primitive types " << expected->mPrimitiveTypes << " != " << actual->mPrimitiveTypes;
+    }
+    if (expected->mMaterialIndex != actual->mMaterialIndex) {
+        return AssertionFailure() << "material index " << expected->mMaterialIndex << " != " << actual->mMaterialIndex;
+    }
+    if (expected->mNumVertices != actual->mNumVertices) {
+        return AssertionFailure() << "vertex count " << expected->mNumVertices << " != " << actual->mNumVertices;
+    }
+
+    const unsigned int numVertices = expected->mNumVertices;
+    AssertionResult result = CompareArrays("positions", expected->mVertices, actual->mVertices, numVertices);
+    if (result) {
+        result = CompareArrays("normals", expected->mNormals, actual->mNormals, numVertices);
+    }
+    if (result) {
+        result = CompareArrays("tangents", expected->mTangents, actual->mTangents, numVertices);
+    }
+    if (result) {
+        result = CompareArrays("bitangents", expected->mBitangents, actual->mBitangents, numVertices);
+    }
+    for (unsigned int c = 0; result && c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
+        result = CompareArrays("vertex colors", expected->mColors[c], actual->mColors[c], numVertices);
+    }
+    for (unsigned int t = 0; result && t < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++t) {
+        if (expected->mNumUVComponents[t] != actual->mNumUVComponents[t]) {
+            return AssertionFailure() << "uv component count of channel " << t << " differs";
+        }
+        result = CompareArrays("texture coordinates", expected->mTextureCoords[t], actual->mTextureCoords[t], numVertices);
+    }
+    if (!result) {
+        return result;
+    }
+
+    if (expected->mNumFaces != actual->mNumFaces) {
+        return AssertionFailure() << "face count " << expected->mNumFaces << " != " << actual->mNumFaces;
+    }
+    result = CompareArrays("faces", expected->mFaces, actual->mFaces, expected->mNumFaces);
+    if (!result) {
+        return result;
+    }
+
+    if (expected->mNumBones != actual->mNumBones) {
+        return AssertionFailure() << "bone count " << expected->mNumBones << " != " << actual->mNumBones;
+    }
+    for (unsigned int b = 0; b < expected->mNumBones; ++b) {
+        const aiBone *a = expected->mBones[b];
+        const aiBone *o = actual->mBones[b];
+        if (a->mName != o->mName || !(a->mOffsetMatrix == o->mOffsetMatrix) || a->mNumWeights != o->mNumWeights) {
+            return AssertionFailure() << "bone " << b << " '" << a->mName.C_Str() << "' differs";
+        }
+        for (unsigned int w = 0; w < a->mNumWeights; ++w) {
+            if (!(a->mWeights[w] == o->mWeights[w])) {
+                return AssertionFailure() << "weight " << w << " of bone '" << a->mName.C_Str() << "' differs";
+            }
+        }
+    }
+    return AssertionSuccess();
+}
+
+AssertionResult CompareMaterials(const aiMaterial *expected, const aiMaterial *actual) {
+    if (expected->mNumProperties != actual->mNumProperties) {
+        return AssertionFailure() << "property count " << expected->mNumProperties << " != " << actual->mNumProperties;
+    }
+    for (unsigned int i = 0; i < expected->mNumProperties; ++i) {
+        const aiMaterialProperty *a = expected->mProperties[i];
+        const aiMaterialProperty *b = actual->mProperties[i];
+        if (a->mKey != b->mKey || a->mSemantic != b->mSemantic || a->mIndex != b->mIndex) {
+            return AssertionFailure() << "property " << i << " is '" << a->mKey.C_Str() << "' in one scene and '" << b->mKey.C_Str() << "' in the other";
+        }
+        if (a->mType != b->mType || a->mDataLength != b->mDataLength || 0 != ::memcmp(a->mData, b->mData, a->mDataLength)) {
+            return AssertionFailure() << "value of property '" << a->mKey.C_Str() << "' differs";
+        }
+    }
+    return AssertionSuccess();
+}
+
+AssertionResult CompareNodes(const aiNode *expected, const aiNode *actual) {
+    if (expected->mName != actual->mName) {
+        return AssertionFailure() << "node '" << expected->mName.C_Str() << "' != '" << actual->mName.C_Str() << "'";
+    }
+    if (!(expected->mTransformation == actual->mTransformation)) {
+        return AssertionFailure() << "transformation of node '" << expected->mName.C_Str() << "' differs";
+    }
+    if (expected->mNumMeshes != actual->mNumMeshes ||
+            0 != ::memcmp(expected->mMeshes, actual->mMeshes, expected->mNumMeshes * sizeof(unsigned int))) {
+        return AssertionFailure() << "meshes of node '" << expected->mName.C_Str() << "' differ";
+    }
+    if (expected->mNumChildren != actual->mNumChildren) {
+        return AssertionFailure() << "child count of node '" << expected->mName.C_Str() << "' differs";
+    }
+    for (unsigned int i = 0; i < expected->mNumChildren; ++i) {
+        AssertionResult result = CompareNodes(expected->mChildren[i], actual->mChildren[i]);
+        if (!result) {
+            return result;
+        }
+    }
+    return AssertionSuccess();
+}
+
+} // namespace
+
+::testing::AssertionResult ScenesAreEqual(const aiScene *expected, const aiScene *actual) {
+    if (nullptr == expected || nullptr == actual) {
+        return AssertionFailure() << "scene is nullptr";
+    }
+    if (expected->mFlags != actual->mFlags) {
+        return AssertionFailure() << "scene flags " << expected->mFlags << " != " << actual->mFlags;
+    }
+    if (expected->mNumMeshes != actual->mNumMeshes) {
+        return AssertionFailure() << "mesh count " << expected->mNumMeshes << " != " << actual->mNumMeshes;
+    }
+    if (expected->mNumMaterials != actual->mNumMaterials) {
+        return AssertionFailure() << "material count " << expected->mNumMaterials << " != " << actual->mNumMaterials;
+    }
+    if (expected->mNumAnimations != actual->mNumAnimations || expected->mNumTextures != actual->mNumTextures ||
+            expected->mNumLights != actual->mNumLights || expected->mNumCameras != actual->mNumCameras) {
+        return AssertionFailure() << "number of animations, textures, lights or cameras differs";
+    }
+
+    for (unsigned int i = 0; i < expected->mNumMeshes; ++i) {
+        AssertionResult result = CompareMeshes(expected->mMeshes[i], actual->mMeshes[i]);
+        if (!result) {
+            return AssertionFailure() << "mesh " << i << ": " << result.message();
+        }
+    }
+    for (unsigned int i = 0; i < expected->mNumMaterials; ++i) {
+        AssertionResult result = CompareMaterials(expected->mMaterials[i], actual->mMaterials[i]);
+        if (!result) {
+            return AssertionFailure() << "material " << i << ": " << result.message();
+        }
+    }
+    if ((nullptr == expected->mRootNode) != (nullptr == actual->mRootNode)) {
+        return AssertionFailure() << "root node present in only one scene";
+    }
+    if (nullptr != expected->mRootNode) {
+        return CompareNodes(expected->mRootNode, actual->mRootNode);
+    }
+    return AssertionSuccess();
+}
+
+} // namespace Assimp
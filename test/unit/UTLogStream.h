@@ -40,8 +40,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 #pragma once
 
+#include <assimp/DefaultLogger.hpp>
 #include <assimp/LogStream.hpp>
 
+#include <string>
+#include <vector>
+
 class UTLogStream : public Assimp::LogStream {
 public:
     UTLogStream()
@@ -61,3 +65,51 @@ public:
 
     std::vector<std::string> m_messages;
 };
+
+/// @brief  Collects all messages logged while it is alive, at every severity.
+/// Creates a temporary default logger if none exists, otherwise raises the
+/// log level of the existing one to DEBUGGING and restores it afterwards.
+class ScopedLogCapture {
+public:
+    ScopedLogCapture() :
+            mOwnsLogger(Assimp::DefaultLogger::isNullLogger()) {
+        if (mOwnsLogger) {
+            Assimp::DefaultLogger::create("", Assimp::Logger::DEBUGGING, 0);
+        }
+        Assimp::Logger *logger = Assimp::DefaultLogger::get();
+        mSeverity = logger->getLogSeverity();
+        if (mSeverity == Assimp::Logger::NORMAL) {
+            logger->setLogSeverity(Assimp::Logger::DEBUGGING);
+        }
+        logger->attachStream(&mStream, 0);
+    }
+
+    ~ScopedLogCapture() {
+        Assimp::Logger *logger = Assimp::DefaultLogger::get();
+        logger->detachStream(&mStream, 0);
+        logger->setLogSeverity(mSeverity);
+        if (mOwnsLogger) {
+            Assimp::DefaultLogger::kill();
+        }
+    }
+
+    /// @brief  Returns true if any captured message contains text.
+    bool contains(const std::string &text) const {
+        for (const std::string &message : mStream.m_messages) {
+            if (message.find(text) != std::string::npos) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief  Returns all captured messages in the order they were logged.
+    const std::vector<std::string> &messages() const {
+        return mStream.m_messages;
+    }
+
+private:
+    UTLogStream mStream;
+    bool mOwnsLogger;
+    Assimp::Logger::LogSeverity mSeverity;
+};
@@ -41,8 +41,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ---------------------------------------------------------------------------
 */
 #include "UnitTestPCH.h"
+#include "SceneComparison.h"
 #include "Common/Importer.h"
 #include "TestIOSystem.h"
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/scene.h>
 
 using namespace ::Assimp;
 
@@ -79,3 +82,48 @@ TEST_F( BatchLoaderTest, validateAccessTest ) {
     BatchLoader loader2( m_io, true );
     EXPECT_TRUE( loader2.getValidation() );
 }
+
+TEST_F( BatchLoaderTest, numThreadsAccessTest ) {
+    BatchLoader loader( m_io );
+    EXPECT_EQ( 1u, loader.getNumThreads() );
+    loader.setNumThreads( 4 );
+    EXPECT_EQ( 4u, loader.getNumThreads() );
+}
+
+TEST_F( BatchLoaderTest, parallelLoadMatchesSerialTest ) {
+    static const char *files[] = {
+        ASSIMP_TEST_MODELS_DIR "/OBJ/box.obj",
+        ASSIMP_TEST_MODELS_DIR "/PLY/cube.ply",
+        ASSIMP_TEST_MODELS_DIR "/PLY/cube_binary.ply",
+        ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj"
+    };
+    static const unsigned int numFiles = sizeof( files ) / sizeof( files[ 0 ] );
+
+    DefaultIOSystem io;
+    BatchLoader serial( &io, true );
+    BatchLoader parallel( &io, true );
+    parallel.setNumThreads( 3 );
+
+    unsigned int serialIds[ numFiles ], parallelIds[ numFiles ];
+    for ( unsigned int i = 0; i < numFiles; ++i ) {
+        serialIds[ i ] = serial.AddLoadRequest( files[ i ] );
+        parallelIds[ i ] = parallel.AddLoadRequest( files[ i ] );
+    }
+    serial.LoadAll();
+    {
+        ScopedLogCapture log;
+        parallel.LoadAll();
+        EXPECT_TRUE( log.contains( "files in parallel" ) );
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+        EXPECT_TRUE( log.contains( "on 3 threads" ) );
+#endif
+    }
+
+    for ( unsigned int i = 0; i < numFiles; ++i ) {
+        aiScene *expected = serial.GetImport( serialIds[ i ] );
+        aiScene *actual = parallel.GetImport( parallelIds[ i ] );
+        EXPECT_TRUE( ScenesAreEqual( expected, actual ) ) << files[ i ];
+        delete expected;
+        delete actual;
+    }
+}
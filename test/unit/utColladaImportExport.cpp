@@ -39,6 +39,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ---------------------------------------------------------------------------
 */
 #include "AbstractImportExportBase.h"
+#include "SceneComparison.h"
+#include "UTLogStream.h"
+#include "UnitTestFileGenerator.h"
 #include "UnitTestPCH.h"
 
 #include <assimp/ColladaMetaData.h>
@@ -253,7 +256,7 @@ unsigned int GetMeshUseCount(const aiNode *rootNode) {
 TEST_F(utColladaImportExport, exportRootNodeMeshTest) {
     Importer importer;
     Exporter exporter;
-    const char *outFile = "exportRootNodeMeshTest_out.dae";
+    const char *outFile = TMP_PATH "exportRootNodeMeshTest_out.dae";
 
     const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/Collada/duck.dae", aiProcess_ValidateDataStructure);
     ASSERT_TRUE(scene != nullptr) << "Fatal: could not import duck.dae!";
@@ -294,13 +297,15 @@ TEST_F(utColladaImportExport, exportRootNodeMeshTest) {
     // Walk nodes and counts used meshes
     // Should be exactly one
     EXPECT_EQ(1u, GetMeshUseCount(scene->mRootNode)) << "Nodes had unexpected number of meshes in use";
+
+    std::remove(outFile);
 }
 
 TEST_F(utColladaImportExport, exporterUniqueIdsTest) {
     Importer importer;
     Exporter exporter;
-    const char *outFileEmpty = "exportMeshIdTest_empty_out.dae";
-    const char *outFileNamed = "exportMeshIdTest_named_out.dae";
+    const char *outFileEmpty = TMP_PATH "exportMeshIdTest_empty_out.dae";
+    const char *outFileNamed = TMP_PATH "exportMeshIdTest_named_out.dae";
 
     // Load a sample file containing multiple meshes
     const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/Collada/teapots.DAE", aiProcess_ValidateDataStructure);
@@ -357,6 +362,9 @@ TEST_F(utColladaImportExport, exporterUniqueIdsTest) {
 
     ImportAndCheckIds(outFileNamed, scene);
     ImportAsNames(outFileNamed, scene);
+
+    std::remove(outFileEmpty);
+    std::remove(outFileNamed);
 }
 
 // This file is invalid, we just want to ensure that the importer is not crashing
@@ -450,3 +458,75 @@ TEST_F(utColladaZaeImportExport, import_causes_heap_overflow_issue6373) {
     const aiScene *scene = importer.ReadFileFromMemory(kData, sizeof(kData), aiProcess_ValidateDataStructure);
     EXPECT_EQ(nullptr, scene);
 }
+
+namespace {
+
+// A strip of triangles with numVertices vertices, large enough for parallel decoding
+std::string MakeTriangleStripDae(unsigned int numVertices) {
+    std::string positions;
+    for (unsigned int i = 0; i < numVertices; ++i) {
+        positions += std::to_string(i / 2) + ".125 " + std::to_string(i % 2) + " " + std::to_string(i * 0.001) + "\n";
+    }
+    std::string indices;
+    for (unsigned int i = 0; i + 2 < numVertices; ++i) {
+        // negative indices are clamped to 0
+        indices += (i == 1000 ? std::string("-1") : std::to_string(i)) + " " + std::to_string(i + 1) + " " + std::to_string(i + 2) + " ";
+    }
+    const std::string numTriangles = std::to_string(numVertices - 2);
+    return "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+           "<COLLADA xmlns=\"http://www.collada.org/2005/11/COLLADASchema\" version=\"1.4.1\">\n"
+           "<library_geometries><geometry id=\"strip\"><mesh>\n"
+           "<source id=\"strip-positions\"><float_array id=\"strip-positions-array\" count=\"" + std::to_string(numVertices * 3) + "\">" + positions + "</float_array>\n"
+           "<technique_common><accessor source=\"#strip-positions-array\" count=\"" + std::to_string(numVertices) + "\" stride=\"3\">"
+           "<param name=\"X\" type=\"float\"/><param name=\"Y\" type=\"float\"/><param name=\"Z\" type=\"float\"/></accessor></technique_common></source>\n"
+           "<vertices id=\"strip-vertices\"><input semantic=\"POSITION\" source=\"#strip-positions\"/></vertices>\n"
+           "<triangles count=\"" + numTriangles + "\"><input semantic=\"VERTEX\" source=\"#strip-vertices\" offset=\"0\"/><p>" + indices + "</p></triangles>\n"
+           "</mesh></geometry></library_geometries>\n"
+           "<library_visual_scenes><visual_scene id=\"scene\"><node id=\"node\"><instance_geometry url=\"#strip\"/></node></visual_scene></library_visual_scenes>\n"
+           "<scene><instance_visual_scene url=\"#scene\"/></scene>\n"
+           "</COLLADA>\n";
+}
+
+} // namespace
+
+TEST_F(utColladaImportExport, importParallelArrays) {
+    const std::string dae = MakeTriangleStripDae(60000);
+
+    Importer reference;
+    const aiScene *expected = reference.ReadFileFromMemory(dae.c_str(), dae.size(), aiProcess_ValidateDataStructure, "dae");
+    ASSERT_NE(nullptr, expected);
+
+    ScopedLogCapture log;
+    Importer importer;
+    importer.SetPropertyInteger(AI_CONFIG_IMPORT_COLLADA_PARSE_THREADS, 4);
+    const aiScene *scene = importer.ReadFileFromMemory(dae.c_str(), dae.size(), aiProcess_ValidateDataStructure, "dae");
+    ASSERT_NE(nullptr, scene);
+    EXPECT_TRUE(log.contains("array values in parallel"));
+    EXPECT_TRUE(log.contains("indices in parallel"));
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    EXPECT_TRUE(log.contains("on 4 threads"));
+#endif
+    EXPECT_TRUE(ScenesAreEqual(expected, scene));
+
+    ASSERT_EQ(1u, scene->mNumMeshes);
+    const aiMesh *b = scene->mMeshes[0];
+    EXPECT_EQ(59998u, b->mNumFaces);
+    const aiVector3D &last = b->mVertices[b->mNumVertices - 1];
+    EXPECT_EQ(29999.125f, last.x);
+    EXPECT_EQ(1.0f, last.y);
+    EXPECT_NEAR(59.999f, last.z, 1e-4f);
+}
+
+TEST_F(utColladaImportExport, importStreamingXml) {
+    Importer reference;
+    const aiScene *expected = reference.ReadFile(ASSIMP_TEST_MODELS_DIR "/Collada/duck.dae", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, expected);
+
+    ScopedLogCapture log;
+    Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_IMPORT_XML_STREAMING, true);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/Collada/duck.dae", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_TRUE(log.contains("read the geometry library with the XmlStreamReader"));
+    EXPECT_TRUE(ScenesAreEqual(expected, scene));
+}
@@ -39,6 +39,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ---------------------------------------------------------------------------
 */
 #include "AbstractImportExportBase.h"
+#include "SceneComparison.h"
+#include "UTLogStream.h"
 #include "UnitTestPCH.h"
 
 #include <assimp/postprocess.h>
@@ -82,6 +84,26 @@ TEST_F(utD3MFImporterExporter, import3MFFromFileTest) {
     EXPECT_TRUE(importerTest());
 }
 
+TEST_F(utD3MFImporterExporter, import3MFStreamingXmlTest) {
+    Assimp::Importer reference;
+    const aiScene *expected = reference.ReadFile(ASSIMP_TEST_MODELS_DIR "/3MF/box.3mf", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, expected);
+
+    ScopedLogCapture log;
+    Assimp::Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_IMPORT_XML_STREAMING, true);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/3MF/box.3mf", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_TRUE(log.contains("read 1 meshes with the XmlStreamReader"));
+    EXPECT_TRUE(Assimp::ScenesAreEqual(expected, scene));
+
+    EXPECT_EQ(1u, scene->mNumMeshes);
+    const aiMesh *mesh = scene->mMeshes[0];
+    ASSERT_NE(nullptr, mesh);
+    EXPECT_EQ(12u, mesh->mNumFaces);
+    EXPECT_EQ(8u, mesh->mNumVertices);
+}
+
 #ifndef ASSIMP_BUILD_NO_EXPORT
 
 TEST_F(utD3MFImporterExporter, export3MFtoMemTest) {
@@ -41,12 +41,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "AbstractImportExportBase.h"
 #include "UnitTestPCH.h"
+#include "SceneComparison.h"
 
 #include <assimp/commonMetaData.h>
 #include <assimp/material.h>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 #include <assimp/types.h>
+#include <assimp/Exporter.hpp>
 #include <assimp/Importer.hpp>
 
 using namespace Assimp;
@@ -461,3 +463,67 @@ TEST_F(utFBXImporterExporter, importSkeletonTest) {
     ASSERT_NE(nullptr, scene);
     ASSERT_TRUE(scene->mRootNode);
 }
+
+TEST_F(utFBXImporterExporter, importStreamedBinaryMatchesInMemory) {
+    for (const char *file : { ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx", ASSIMP_TEST_MODELS_DIR "/FBX/animation_with_skeleton.fbx" }) {
+        Assimp::Importer reference;
+        const aiScene *expected = reference.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, expected);
+
+        ScopedLogCapture log;
+        Assimp::Importer importer;
+        importer.SetPropertyBool(AI_CONFIG_IMPORT_FBX_STREAM_BINARY, true);
+        const aiScene *scene = importer.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, scene);
+        EXPECT_TRUE(log.contains("Tokenizing binary FBX file from stream")) << file;
+        EXPECT_TRUE(ScenesAreEqual(expected, scene)) << file;
+    }
+}
+
+TEST_F(utFBXImporterExporter, importParallelInflateMatchesOnDemand) {
+    for (const char *file : { ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx", ASSIMP_TEST_MODELS_DIR "/FBX/animation_with_skeleton.fbx" }) {
+        Assimp::Importer reference;
+        const aiScene *expected = reference.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, expected);
+
+        ScopedLogCapture log;
+        Assimp::Importer importer;
+        importer.SetPropertyInteger(AI_CONFIG_IMPORT_FBX_INFLATE_THREADS, 4);
+        const aiScene *scene = importer.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, scene);
+        EXPECT_TRUE(log.contains("binary arrays in parallel")) << file;
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+        EXPECT_TRUE(log.contains("on 4 threads")) << file;
+#endif
+        EXPECT_TRUE(ScenesAreEqual(expected, scene)) << file;
+    }
+}
+
+#ifndef ASSIMP_BUILD_NO_EXPORT
+TEST_F(utFBXImporterExporter, exportCompressedArraysRoundTrip) {
+    Assimp::Importer source;
+    const aiScene *scene = source.ReadFile(ASSIMP_TEST_MODELS_DIR "/FBX/animation_with_skeleton.fbx", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    Assimp::Exporter exporter;
+    ExportProperties plainProperties;
+    plainProperties.SetPropertyInteger(AI_CONFIG_EXPORT_FBX_COMPRESSION_THRESHOLD, 0);
+    ASSERT_NE(nullptr, exporter.ExportToBlob(scene, "fbx", 0, &plainProperties)) << exporter.GetErrorString();
+    const std::vector<uint8_t> plain(static_cast<const uint8_t *>(exporter.GetBlob()->data),
+            static_cast<const uint8_t *>(exporter.GetBlob()->data) + exporter.GetBlob()->size);
+
+    ExportProperties compressedProperties;
+    compressedProperties.SetPropertyInteger(AI_CONFIG_EXPORT_FBX_COMPRESSION_THREADS, 4);
+    const aiExportDataBlob *compressed = exporter.ExportToBlob(scene, "fbx", 0, &compressedProperties);
+    ASSERT_NE(nullptr, compressed);
+    EXPECT_LT(compressed->size, plain.size());
+
+    Assimp::Importer reference;
+    const aiScene *expected = reference.ReadFileFromMemory(plain.data(), plain.size(), aiProcess_ValidateDataStructure, "fbx");
+    ASSERT_NE(nullptr, expected);
+    Assimp::Importer importer;
+    const aiScene *result = importer.ReadFileFromMemory(compressed->data, compressed->size, aiProcess_ValidateDataStructure, "fbx");
+    ASSERT_NE(nullptr, result);
+    EXPECT_TRUE(ScenesAreEqual(expected, result));
+}
+#endif // ASSIMP_BUILD_NO_EXPORT
@@ -187,3 +187,89 @@ TEST_F(FastAtofTest, FastAtof)
 {
     RunTest<ai_real>(FastAtofWrapper());
 }
+
+struct FastAtofArrayWrapper {
+    ai_real operator()(const char* str) {
+        ai_real value = 0;
+        const char *end = str + ::strlen(str);
+        EXPECT_EQ(1u, Assimp::fast_atoreal_array(str, end, &value, 1));
+        return value;
+    }
+};
+
+TEST_F(FastAtofTest, FastAtorealArray)
+{
+    RunTest<ai_real>(FastAtofArrayWrapper());
+}
+
+TEST_F(FastAtofTest, FastAtorealArrayBulk)
+{
+    const char text[] = " 1.5\t-2.25e2\n0.1 12345678.875 .5 nan 3,5 7 x 8";
+    const char *c = text;
+    const char *end = text + sizeof(text) - 1;
+
+    double values[16] = {};
+    EXPECT_EQ(8u, Assimp::fast_atoreal_array(c, end, values, 16));
+    EXPECT_EQ(1.5, values[0]);
+    EXPECT_EQ(-225.0, values[1]);
+    EXPECT_EQ(0.1, values[2]);
+    EXPECT_EQ(12345678.875, values[3]);
+    EXPECT_EQ(0.5, values[4]);
+    EXPECT_TRUE(IsNan(values[5]));
+    EXPECT_EQ(3.5, values[6]);
+    EXPECT_EQ(7.0, values[7]);
+
+    // stops in front of the first token which isn't a number
+    EXPECT_EQ(' ', *c);
+    EXPECT_EQ(0u, Assimp::fast_atoreal_array(c, end, values, 16));
+    EXPECT_EQ(std::string(" x 8"), std::string(c));
+
+    // numbers out of the exact range still get parsed
+    c = "2.2250738585072014e-308 1.5e300";
+    EXPECT_EQ(2u, Assimp::fast_atoreal_array(c, c + ::strlen(c), values, 2));
+    EXPECT_NEAR(2.2250738585072014e-308, values[0], 1e-314);
+    EXPECT_NEAR(1.5e300, values[1], 1e294);
+
+    // never reads behind end
+    c = text;
+    EXPECT_EQ(2u, Assimp::fast_atoreal_array(c, text + 12, values, 16));
+    EXPECT_EQ(-225.0, values[1]);
+    EXPECT_EQ(text + 12, c);
+}
+
+TEST_F(FastAtofTest, FastAtorealArrayRounding)
+{
+    // plain numbers are rounded like strtod
+    const char *const cases[] = { "0.1", "0.3", "9007199254740992", "3.14159265358979",
+        "1e22", "-7.54979e-8", "1.797693134862315e-3", "98765.4321e-3", "0.000000000000000001",
+        // the double nearest to these is the midpoint between two floats
+        "1.000000536441803", "6651385.75" };
+    for (const char *str : cases) {
+        const char *c = str;
+        double d = 0;
+        EXPECT_EQ(1u, Assimp::fast_atoreal_array(c, str + ::strlen(str), &d, 1));
+        EXPECT_EQ(::strtod(str, nullptr), d) << str;
+
+        c = str;
+        float f = 0;
+        EXPECT_EQ(1u, Assimp::fast_atoreal_array(c, str + ::strlen(str), &f, 1));
+        EXPECT_EQ(::strtof(str, nullptr), f) << str;
+    }
+}
+
+TEST_F(FastAtofTest, Strtoul10Array)
+{
+    const char text[] = "0 1 12345678 123456789 4294967295\n\n17 -3 4";
+    const char *c = text;
+    const char *end = text + sizeof(text) - 1;
+
+    unsigned int values[16] = {};
+    EXPECT_EQ(6u, Assimp::strtoul10_array(c, end, values, 16));
+    EXPECT_EQ(0u, values[0]);
+    EXPECT_EQ(1u, values[1]);
+    EXPECT_EQ(12345678u, values[2]);
+    EXPECT_EQ(123456789u, values[3]);
+    EXPECT_EQ(4294967295u, values[4]);
+    EXPECT_EQ(17u, values[5]);
+    EXPECT_EQ(std::string(" -3 4"), std::string(c));
+}
@@ -39,9 +39,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ---------------------------------------------------------------------------
 */
 #include "AbstractImportExportBase.h"
+#include "SceneComparison.h"
+#include "UTLogStream.h"
 #include "UnitTestPCH.h"
 
+#include <assimp/config.h>
 #include <assimp/postprocess.h>
+#include <assimp/scene.h>
 #include <assimp/Importer.hpp>
 
 using namespace Assimp;
@@ -59,6 +63,96 @@ TEST_F(utIFCImportExport, importIFCFromFileTest) {
     EXPECT_TRUE(importerTest());
 }
 
+TEST_F(utIFCImportExport, importIFCParallelScanTest) {
+    Assimp::Importer serial;
+    const aiScene *expected = serial.ReadFile(ASSIMP_TEST_MODELS_DIR "/IFC/AC14-FZK-Haus.ifc", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, expected);
+
+    // the DATA section of this file is large enough to be split into several chunks
+    ScopedLogCapture log;
+    Assimp::Importer parallel;
+    parallel.SetPropertyInteger(AI_CONFIG_IMPORT_IFC_PARSE_THREADS, 4);
+    const aiScene *scene = parallel.ReadFile(ASSIMP_TEST_MODELS_DIR "/IFC/AC14-FZK-Haus.ifc", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_TRUE(log.contains("of the DATA section in parallel"));
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    EXPECT_TRUE(log.contains("on 4 threads"));
+#endif
+    EXPECT_TRUE(ScenesAreEqual(expected, scene));
+}
+
+TEST_F(utIFCImportExport, importIFCParallelGeometryTest) {
+    Assimp::Importer serial;
+    const aiScene *expected = serial.ReadFile(ASSIMP_TEST_MODELS_DIR "/IFC/AC14-FZK-Haus.ifc", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, expected);
+
+    ScopedLogCapture log;
+    Assimp::Importer parallel;
+    parallel.SetPropertyInteger(AI_CONFIG_IMPORT_IFC_GEOMETRY_THREADS, 4);
+    const aiScene *scene = parallel.ReadFile(ASSIMP_TEST_MODELS_DIR "/IFC/AC14-FZK-Haus.ifc", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_TRUE(log.contains("contained products in parallel"));
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    EXPECT_TRUE(log.contains("on 4 threads"));
+#endif
+
+    // the products are merged in file order, shared meshes are not duplicated
+    EXPECT_TRUE(ScenesAreEqual(expected, scene));
+}
+
+// The site and both contained proxies use the extrusion #50, the second proxy has an item of its own
+TEST_F(utIFCImportExport, importIFCParallelGeometrySharedItemsTest) {
+    const std::string asset =
+            "ISO-10303-21;\n"
+            "HEADER;\n"
+            "FILE_DESCRIPTION(('ViewDefinition [CoordinationView]'),'2;1');\n"
+            "FILE_NAME('shared.ifc','2025-01-01T00:00:00',(''),(''),'','','');\n"
+            "FILE_SCHEMA(('IFC2X3'));\n"
+            "ENDSEC;\n"
+            "DATA;\n"
+            "#1=IFCPROJECT('0YvctVUKr0kugbFTf53O9L',#5,'Project',$,$,$,$,(#20),#10);\n"
+            "#5=IFCOWNERHISTORY($,$,$,.ADDED.,$,$,$,0);\n"
+            "#10=IFCUNITASSIGNMENT((#11));\n"
+            "#11=IFCSIUNIT(*,.LENGTHUNIT.,$,.METRE.);\n"
+            "#20=IFCGEOMETRICREPRESENTATIONCONTEXT($,'Model',3,1.E-05,#21,$);\n"
+            "#21=IFCAXIS2PLACEMENT3D(#22,$,$);\n"
+            "#22=IFCCARTESIANPOINT((0.,0.,0.));\n"
+            "#30=IFCSITE('1YvctVUKr0kugbFTf53O9L',#5,'Site',$,$,#31,#40,$,.ELEMENT.,$,$,$,$,$);\n"
+            "#31=IFCLOCALPLACEMENT($,#21);\n"
+            "#40=IFCPRODUCTDEFINITIONSHAPE($,$,(#41));\n"
+            "#41=IFCSHAPEREPRESENTATION(#20,'Body','SweptSolid',(#50));\n"
+            "#50=IFCEXTRUDEDAREASOLID(#51,#21,#53,1.);\n"
+            "#51=IFCRECTANGLEPROFILEDEF(.AREA.,$,#52,2.,3.);\n"
+            "#52=IFCAXIS2PLACEMENT2D(#54,$);\n"
+            "#53=IFCDIRECTION((0.,0.,1.));\n"
+            "#54=IFCCARTESIANPOINT((0.,0.));\n"
+            "#60=IFCRELAGGREGATES('2YvctVUKr0kugbFTf53O9L',#5,$,$,#1,(#30));\n"
+            "#70=IFCBUILDINGELEMENTPROXY('3YvctVUKr0kugbFTf53O9L',#5,'Proxy A',$,$,#31,#40,$,$);\n"
+            "#71=IFCBUILDINGELEMENTPROXY('4YvctVUKr0kugbFTf53O9L',#5,'Proxy B',$,$,#31,#80,$,$);\n"
+            "#80=IFCPRODUCTDEFINITIONSHAPE($,$,(#81));\n"
+            "#81=IFCSHAPEREPRESENTATION(#20,'Body','SweptSolid',(#50,#82));\n"
+            "#82=IFCEXTRUDEDAREASOLID(#51,#21,#53,2.);\n"
+            "#90=IFCRELCONTAINEDINSPATIALSTRUCTURE('5YvctVUKr0kugbFTf53O9L',#5,$,$,(#70,#71),#30);\n"
+            "ENDSEC;\n"
+            "END-ISO-10303-21;\n";
+
+    Assimp::Importer serial;
+    const aiScene *expected = serial.ReadFileFromMemory(asset.c_str(), asset.size(), aiProcess_ValidateDataStructure, "ifc");
+    ASSERT_NE(nullptr, expected);
+    EXPECT_EQ(2u, expected->mNumMeshes);
+
+    for (int threads : { 2, 4 }) {
+        ScopedLogCapture log;
+        Assimp::Importer parallel;
+        parallel.SetPropertyInteger(AI_CONFIG_IMPORT_IFC_GEOMETRY_THREADS, threads);
+        const aiScene *scene = parallel.ReadFileFromMemory(asset.c_str(), asset.size(), aiProcess_ValidateDataStructure, "ifc");
+        ASSERT_NE(nullptr, scene) << threads;
+        EXPECT_TRUE(log.contains("converting 2 contained products in parallel")) << threads;
+        EXPECT_EQ(expected->mNumMeshes, scene->mNumMeshes) << threads;
+        EXPECT_TRUE(ScenesAreEqual(expected, scene)) << threads;
+    }
+}
+
 TEST_F(utIFCImportExport, importComplextypeAsColor) {
     std::string asset =
             "ISO-10303-21;\n"
@@ -40,6 +40,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "UnitTestPCH.h"
+#include <assimp/Exceptional.h>
 #include <assimp/IOStreamBuffer.h>
 #include "TestIOStream.h"
 #include "Tools/TestTools.h"
@@ -113,7 +114,7 @@ TEST_F( IOStreamBufferTest, readlineTest ) {
     const auto dataSize = sizeof(data);
     const auto dataCount = dataSize / sizeof(*data);
 
-    char fname[]={ "readlinetest.XXXXXX\0" };
+    char fname[]={ TMP_PATH "readlinetest.XXXXXX\0" };
     std::string tmpName;
     auto* fs = MakeTmpFile(fname, std::strlen(fname), tmpName);
     ASSERT_NE(nullptr, fs);
@@ -143,6 +144,106 @@ TEST_F( IOStreamBufferTest, readlineTest ) {
     EXPECT_TRUE(myBuffer.open(&myStream));
     EXPECT_EQ(numBlocks, myBuffer.getNumBlocks() );
     EXPECT_TRUE(myBuffer.close() );
+    std::remove(tmpName.c_str());
+}
+
+TEST_F( IOStreamBufferTest, prefetchTest ) {
+    char fname[]={ "prefetchtest.XXXXXX\0" };
+    std::string tmpName;
+    auto* fs = MakeTmpFile(fname, std::strlen(fname), tmpName);
+    ASSERT_NE(nullptr, fs);
+
+    auto written = std::fwrite( data, sizeof(*data), sizeof(data) / sizeof(*data), fs );
+    EXPECT_NE( 0U, written );
+    std::fclose(fs);
+
+    // the line spans several blocks, it has to be the same no matter how many are read ahead
+    for (size_t prefetch = 0; prefetch < 3; ++prefetch) {
+        FILE *new_fs{ nullptr };
+        EXPECT_TRUE(Unittest::TestTools::openFilestream(&new_fs, tmpName.c_str(), "r"));
+        ASSERT_NE(nullptr, new_fs);
+
+        TestDefaultIOStream myStream(new_fs, fname);
+        IOStreamBuffer<char> myBuffer(26u, prefetch);
+        EXPECT_TRUE(myBuffer.open(&myStream));
+
+        std::vector<char> line;
+        EXPECT_TRUE(myBuffer.getNextLine(line));
+        EXPECT_EQ(std::string(data), std::string(line.data(), std::find(line.begin(), line.end(), '\n') - line.begin()));
+        EXPECT_EQ(myBuffer.getNumBlocks(), myBuffer.getCurrentBlockIndex());
+        EXPECT_TRUE(myBuffer.close());
+    }
+    std::remove(tmpName.c_str());
+}
+
+namespace {
+
+// Serves data from memory, reading behind failAt throws like a broken file would
+class FailingIOStream : public IOStream {
+public:
+    FailingIOStream(const char *buffer, size_t size, size_t failAt) :
+            mBuffer(buffer), mSize(size), mFailAt(failAt), mPos(0) {
+        // empty
+    }
+
+    size_t Read(void *pvBuffer, size_t pSize, size_t pCount) override {
+        const size_t count = std::min(pCount, (mSize - mPos) / pSize);
+        if (mPos + count * pSize > mFailAt) {
+            throw DeadlyImportError("read error");
+        }
+        ::memcpy(pvBuffer, mBuffer + mPos, count * pSize);
+        mPos += count * pSize;
+        return count;
+    }
+
+    size_t Write(const void *, size_t, size_t) override {
+        return 0;
+    }
+
+    aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override {
+        if (aiOrigin_SET != pOrigin || pOffset > mSize) {
+            return AI_FAILURE;
+        }
+        mPos = pOffset;
+        return AI_SUCCESS;
+    }
+
+    size_t Tell() const override {
+        return mPos;
+    }
+
+    size_t FileSize() const override {
+        return mSize;
+    }
+
+    void Flush() override {
+        // empty
+    }
+
+private:
+    const char *mBuffer;
+    size_t mSize;
+    size_t mFailAt;
+    size_t mPos;
+};
+
+} // namespace
+
+TEST_F( IOStreamBufferTest, prefetchReadErrorTest ) {
+    // the third block fails, the first two still arrive and the error is raised on this thread
+    for (size_t prefetch = 0; prefetch < 3; ++prefetch) {
+        FailingIOStream myStream(data, sizeof(data) - 1, 60u);
+        IOStreamBuffer<char> myBuffer(26u, prefetch);
+        EXPECT_TRUE(myBuffer.open(&myStream));
+
+        std::vector<char> block;
+        EXPECT_TRUE(myBuffer.getNextBlock(block));
+        EXPECT_EQ(std::string(data, 26), std::string(block.begin(), block.end()));
+        EXPECT_TRUE(myBuffer.getNextBlock(block));
+        EXPECT_EQ(std::string(data + 26, 26), std::string(block.begin(), block.end()));
+        EXPECT_THROW(myBuffer.getNextBlock(block), DeadlyImportError);
+        EXPECT_TRUE(myBuffer.close());
+    }
 }
 
 TEST_F( IOStreamBufferTest, accessBlockIndexTest ) {
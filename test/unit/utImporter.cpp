@@ -45,6 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "TestIOSystem.h"
 #include <assimp/BaseImporter.h>
 #include <assimp/DefaultIOSystem.h>
+#include <assimp/config.h>
 #include <assimp/Importer.hpp>
 
 using namespace ::std;
@@ -236,6 +237,32 @@ TEST_F(ImporterTest, testPluginInterface) {
     EXPECT_TRUE(false); // control shouldn't reach this point
 }
 
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, extensionLookupFollowsRegisteredLoaders) {
+    TestPlugin *plugin = new TestPlugin();
+    pImp->RegisterLoader(plugin);
+    EXPECT_EQ(pImp->GetImporterCount() - 1, pImp->GetImporterIndex(".apple"));
+    EXPECT_EQ(plugin, pImp->GetImporter("MAC"));
+
+    pImp->UnregisterLoader(plugin);
+    EXPECT_FALSE(pImp->IsExtensionSupported(".apple"));
+    EXPECT_TRUE(pImp->IsExtensionSupported(".3ds"));
+    delete plugin;
+
+#ifndef ASSIMP_BUILD_NO_OGRE_IMPORTER
+    // extensions containing dots
+    EXPECT_TRUE(pImp->IsExtensionSupported("mesh.xml"));
+    EXPECT_FALSE(pImp->IsExtensionSupported("other.xml"));
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, signatureDetectionWithoutExtension) {
+    const aiScene *sc = pImp->ReadFileFromMemory(InputData_abRawBlock, InputData_BLOCK_SIZE, 0, "");
+    ASSERT_NE(nullptr, sc);
+    EXPECT_EQ(1U, sc->mNumMeshes);
+}
+
 // ------------------------------------------------------------------------------------------------
 TEST_F(ImporterTest, testExtensionCheck) {
     std::string s;
@@ -364,6 +391,37 @@ TEST_F(ImporterTest, unexpectedException) {
 
 // ------------------------------------------------------------------------------------------------
 
+TEST_F(ImporterTest, parallelPostProcessingMatchesSerial) {
+    const unsigned int flags = aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_CalcTangentSpace |
+            aiProcess_JoinIdenticalVertices | aiProcess_ImproveCacheLocality | aiProcess_LimitBoneWeights;
+
+    Importer serial;
+    const aiScene *expected = serial.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags);
+    ASSERT_NE(nullptr, expected);
+
+    pImp->SetPropertyInteger(AI_CONFIG_GLOB_POSTPROCESS_THREADS, 4);
+    const aiScene *actual = pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags);
+    ASSERT_NE(nullptr, actual);
+
+    ASSERT_EQ(expected->mNumMeshes, actual->mNumMeshes);
+    for (unsigned int m = 0; m < expected->mNumMeshes; ++m) {
+        const aiMesh *a = expected->mMeshes[m];
+        const aiMesh *b = actual->mMeshes[m];
+        ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+        ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+        for (unsigned int v = 0; v < a->mNumVertices; ++v) {
+            EXPECT_EQ(a->mVertices[v], b->mVertices[v]);
+            EXPECT_EQ(a->mNormals[v], b->mNormals[v]);
+        }
+        for (unsigned int f = 0; f < a->mNumFaces; ++f) {
+            ASSERT_EQ(a->mFaces[f].mNumIndices, b->mFaces[f].mNumIndices);
+            for (unsigned int i = 0; i < a->mFaces[f].mNumIndices; ++i) {
+                EXPECT_EQ(a->mFaces[f].mIndices[i], b->mFaces[f].mIndices[i]);
+            }
+        }
+    }
+}
+
 struct ExtensionTestCase {
     std::string testName;
     std::string filename;
@@ -395,3 +453,34 @@ INSTANTIATE_TEST_SUITE_P(
     [](const ::testing::TestParamInfo<ExtensionTest::ParamType>& info) {
         return info.param.testName;
     });
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, importStatisticsAreCollected) {
+    aiImportStatistics stats;
+    pImp->GetImportStatistics(stats);
+    EXPECT_EQ(0u, stats.numRegions);
+
+    pImp->SetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 1);
+    const aiScene *scene = pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_Triangulate | aiProcess_GenNormals);
+    ASSERT_NE(nullptr, scene);
+
+    pImp->GetImportStatistics(stats);
+    EXPECT_GT(stats.bytesRead, 0u);
+    EXPECT_GT(stats.totalTime, 0.0);
+    EXPECT_GE(stats.totalTime, stats.importTime + stats.preprocessTime + stats.postprocessTime);
+    ASSERT_NE(nullptr, stats.regions);
+
+    bool foundTriangulate = false;
+    for (unsigned int i = 0; i < stats.numRegions; ++i) {
+        if (std::string("TriangulateProcess") == stats.regions[i].name.C_Str()) {
+            foundTriangulate = true;
+            EXPECT_EQ(2u, stats.regions[i].depth);
+        }
+    }
+    EXPECT_TRUE(foundTriangulate);
+
+    const std::string json = pImp->GetImportStatisticsJSON();
+    EXPECT_EQ('{', json.front());
+    EXPECT_EQ('}', json.back());
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"TriangulateProcess\""));
+}
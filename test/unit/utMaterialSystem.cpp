@@ -41,8 +41,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UnitTestPCH.h"
 
 #include "Material/MaterialSystem.h"
+#include <assimp/SceneCombiner.h>
 #include <assimp/scene.h>
 
+#include <string>
+#include <vector>
+
 using namespace ::std;
 using namespace ::Assimp;
 
@@ -279,6 +283,97 @@ TEST_F(MaterialSystemTest, testMaterialTextureTypeEnum) {
     EXPECT_EQ(maxTextureType, AI_TEXTURE_TYPE_MAX) << "AI_TEXTURE_TYPE_MAX macro must be equal to the largest valid aiTextureType_XXX";
 }
 
+// ------------------------------------------------------------------------------------------------
+TEST_F(MaterialSystemTest, testLookupInLargeMaterial) {
+    // enough properties for the lookups to go through the hash index
+    for (int i = 0; i < 64; ++i) {
+        const std::string key = "testKey" + std::to_string(i);
+        pcMat->AddProperty(&i, 1, key.c_str(), i % 3, i % 5);
+    }
+
+    int value = -1;
+    EXPECT_EQ(AI_SUCCESS, pcMat->Get("testKey42", 0, 2, value));
+    EXPECT_EQ(42, value);
+    EXPECT_EQ(AI_FAILURE, pcMat->Get("testKey42", 1, 2, value));
+    EXPECT_EQ(AI_FAILURE, pcMat->Get("unknownKey", 0, 0, value));
+
+    // wild-cards and keys which are only the start of stored keys
+    const aiMaterialProperty *prop = nullptr;
+    EXPECT_EQ(AI_SUCCESS, aiGetMaterialProperty(pcMat, "testKey13", UINT_MAX, UINT_MAX, &prop));
+    ASSERT_NE(nullptr, prop);
+    EXPECT_EQ(1u, prop->mSemantic);
+    EXPECT_EQ(AI_SUCCESS, aiGetMaterialProperty(pcMat, "testKey6", 0, 3, &prop));
+    EXPECT_EQ(aiString("testKey63"), prop->mKey);
+    EXPECT_EQ(AI_SUCCESS, aiGetMaterialProperty(pcMat, "testKey1", 1, 3, &prop));
+    EXPECT_EQ(aiString("testKey13"), prop->mKey);
+
+    // the index is updated when properties change
+    EXPECT_EQ(AI_SUCCESS, pcMat->RemoveProperty("testKey42", 0, 2));
+    EXPECT_EQ(AI_FAILURE, pcMat->Get("testKey42", 0, 2, value));
+    const int replaced = 4242;
+    pcMat->AddProperty(&replaced, 1, "testKey42", 0, 2);
+    EXPECT_EQ(AI_SUCCESS, pcMat->Get("testKey42", 0, 2, value));
+    EXPECT_EQ(replaced, value);
+
+    aiMaterial copy;
+    aiMaterial::CopyPropertyList(&copy, pcMat);
+    EXPECT_EQ(AI_SUCCESS, copy.Get("testKey42", 0, 2, value));
+    EXPECT_EQ(replaced, value);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Renames a property behind the back of the material. A lookup of the new name is answered
+// from the hash index if the material has one, the index doesn't know the name then.
+static bool IsLookedUpInIndex(aiMaterial *mat, unsigned int position) {
+    aiMaterialProperty *prop = mat->mProperties[position];
+    const aiString key = prop->mKey;
+    const aiMaterialProperty *found = nullptr;
+    EXPECT_EQ(AI_SUCCESS, aiGetMaterialProperty(mat, key.C_Str(), prop->mSemantic, prop->mIndex, &found));
+    EXPECT_EQ(prop, found);
+
+    prop->mKey.Set("renamedKey");
+    const bool indexed = AI_FAILURE == aiGetMaterialProperty(mat, "renamedKey", prop->mSemantic, prop->mIndex, &found);
+    prop->mKey = key;
+    return indexed;
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(MaterialSystemTest, testCopiedAndMergedMaterialsAreIndexed) {
+    for (int i = 0; i < 64; ++i) {
+        const std::string key = "testKey" + std::to_string(i);
+        pcMat->AddProperty(&i, 1, key.c_str(), i % 3, i % 5);
+    }
+    EXPECT_TRUE(IsLookedUpInIndex(pcMat, 20));
+
+    // SceneCombiner fills the property arrays directly
+    aiMaterial *copy = nullptr;
+    SceneCombiner::Copy(&copy, pcMat);
+    ASSERT_NE(nullptr, copy);
+    EXPECT_TRUE(IsLookedUpInIndex(copy, 20));
+
+    aiMaterial *merged = nullptr;
+    std::vector<aiMaterial *> materials = { pcMat, copy };
+    SceneCombiner::MergeMaterials(&merged, materials.begin(), materials.end());
+    ASSERT_NE(nullptr, merged);
+    EXPECT_EQ(pcMat->mNumProperties, merged->mNumProperties);
+    EXPECT_TRUE(IsLookedUpInIndex(merged, 20));
+
+    int value = -1;
+    EXPECT_EQ(AI_SUCCESS, merged->Get("testKey42", 0, 2, value));
+    EXPECT_EQ(42, value);
+
+    delete merged;
+    delete copy;
+
+    // small materials are searched linearly
+    aiMaterial small;
+    for (int i = 0; i < 8; ++i) {
+        const std::string key = "testKey" + std::to_string(i);
+        small.AddProperty(&i, 1, key.c_str(), i % 3, i % 5);
+    }
+    EXPECT_FALSE(IsLookedUpInIndex(&small, 5));
+}
+
 #if defined(_MSC_VER)
 __pragma (warning(pop))
 #endif
@@ -0,0 +1,169 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+#include "SceneComparison.h"
+
+#include <assimp/MemoryMappedIOSystem.h>
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <memory>
+#include <vector>
+
+using namespace Assimp;
+
+namespace {
+
+// Forwards to a mapped stream and counts how often the importer took its
+// memory view instead of reading the file.
+class ViewCountingIOStream : public IOStream {
+public:
+    ViewCountingIOStream(IOStream *wrapped, unsigned int &viewsUsed) :
+            mWrapped(wrapped), mViewsUsed(viewsUsed) {}
+    ~ViewCountingIOStream() override { delete mWrapped; }
+    size_t Read(void *pvBuffer, size_t pSize, size_t pCount) override { return mWrapped->Read(pvBuffer, pSize, pCount); }
+    size_t Write(const void *pvBuffer, size_t pSize, size_t pCount) override { return mWrapped->Write(pvBuffer, pSize, pCount); }
+    aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override { return mWrapped->Seek(pOffset, pOrigin); }
+    size_t Tell() const override { return mWrapped->Tell(); }
+    size_t FileSize() const override { return mWrapped->FileSize(); }
+    void Flush() override { mWrapped->Flush(); }
+    const uint8_t *GetMemoryView() const override {
+        const uint8_t *view = mWrapped->GetMemoryView();
+        if (nullptr != view) {
+            ++mViewsUsed;
+        }
+        return view;
+    }
+
+private:
+    IOStream *mWrapped;
+    unsigned int &mViewsUsed;
+};
+
+class ViewCountingIOSystem : public MemoryMappedIOSystem {
+public:
+    explicit ViewCountingIOSystem(unsigned int &viewsUsed) :
+            mViewsUsed(viewsUsed) {}
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override {
+        IOStream *stream = MemoryMappedIOSystem::Open(pFile, pMode);
+        return nullptr == stream ? nullptr : new ViewCountingIOStream(stream, mViewsUsed);
+    }
+
+private:
+    unsigned int &mViewsUsed;
+};
+
+} // namespace
+
+class utMemoryMappedIOSystem : public ::testing::Test {
+protected:
+    // Imports the file with both IO systems, checks that the importer parsed
+    // the mapped memory and that both scenes are identical
+    static void compareImports(const char *file) {
+        Importer reference;
+        const aiScene *expected = reference.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, expected);
+
+        unsigned int viewsUsed = 0;
+        Importer mapped;
+        mapped.SetIOHandler(new ViewCountingIOSystem(viewsUsed));
+        const aiScene *scene = mapped.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, scene);
+
+        EXPECT_LT(0u, viewsUsed);
+        EXPECT_TRUE(ScenesAreEqual(expected, scene));
+    }
+};
+
+TEST_F(utMemoryMappedIOSystem, viewMatchesFileContents) {
+    MemoryMappedIOSystem io;
+    IOStream *stream = io.Open(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl", "rb");
+    ASSERT_NE(nullptr, stream);
+
+    const size_t size = stream->FileSize();
+    const uint8_t *view = stream->GetMemoryView();
+    ASSERT_NE(nullptr, view);
+
+    std::vector<uint8_t> contents(size);
+    EXPECT_EQ(1u, stream->Read(contents.data(), size, 1));
+    EXPECT_EQ(0, ::memcmp(view, contents.data(), size));
+    EXPECT_EQ(0u, stream->Read(contents.data(), 1, 1));
+
+    EXPECT_EQ(AI_SUCCESS, stream->Seek(4, aiOrigin_END));
+    EXPECT_EQ(size - 4, stream->Tell());
+    EXPECT_EQ(AI_FAILURE, stream->Seek(5, aiOrigin_CUR));
+    EXPECT_EQ(0u, stream->Write(contents.data(), 1, 1));
+    io.Close(stream);
+}
+
+TEST_F(utMemoryMappedIOSystem, writeModeIsNotMapped) {
+    MemoryMappedIOSystem io;
+    EXPECT_TRUE(io.Exists(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl"));
+    EXPECT_EQ(nullptr, io.Open(ASSIMP_TEST_MODELS_DIR "/STL/does_not_exist.stl", "rb"));
+
+    IOStream *stream = io.Open(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl", "rb+");
+    ASSERT_NE(nullptr, stream);
+    EXPECT_EQ(nullptr, stream->GetMemoryView());
+    io.Close(stream);
+}
+
+TEST_F(utMemoryMappedIOSystem, importBinarySTL) {
+    compareImports(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl");
+}
+
+TEST_F(utMemoryMappedIOSystem, importBinaryPLY) {
+    compareImports(ASSIMP_TEST_MODELS_DIR "/PLY/cube_binary.ply");
+}
+
+TEST_F(utMemoryMappedIOSystem, importBinaryFBX) {
+    compareImports(ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx");
+}
+
+TEST_F(utMemoryMappedIOSystem, importGLB) {
+    compareImports(ASSIMP_TEST_MODELS_DIR "/glTF2/2CylinderEngine-glTF-Binary/2CylinderEngine.glb");
+}
+
+TEST_F(utMemoryMappedIOSystem, importGLTFWithExternalBuffer) {
+    compareImports(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured.gltf");
+}
@@ -40,8 +40,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "AbstractImportExportBase.h"
+#include "SceneComparison.h"
 #include "SceneDiffer.h"
+#include "UTLogStream.h"
 #include "UnitTestPCH.h"
+#include <assimp/cexport.h>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 #include <assimp/Exporter.hpp>
@@ -539,3 +542,136 @@ TEST_F(utObjImportExport, issue2355_mtl_texture_prefix) {
     // The MTL file is in `folder`, the image path should have been prefixed with the folder
     EXPECT_STREQ("folder/image.jpg", texturePath.C_Str());
 }
+
+TEST_F(utObjImportExport, parallel_parse_matches_sequential) {
+    static const char *files[] = {
+        ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+        ASSIMP_TEST_MODELS_DIR "/OBJ/cube_usemtl.obj",
+        ASSIMP_TEST_MODELS_DIR "/OBJ/cube_with_vertexcolors.obj",
+        ASSIMP_TEST_MODELS_DIR "/OBJ/box_without_lineending.obj",
+    };
+    for (const char *file : files) {
+        Assimp::Importer sequential;
+        const aiScene *expected = sequential.ReadFile(file, aiProcess_ValidateDataStructure);
+
+        ScopedLogCapture log;
+        Assimp::Importer parallel;
+        parallel.SetPropertyInteger(AI_CONFIG_IMPORT_OBJ_PARSE_THREADS, 4);
+        const aiScene *actual = parallel.ReadFile(file, aiProcess_ValidateDataStructure);
+        EXPECT_TRUE(log.contains("chunks in parallel")) << file;
+        EXPECT_TRUE(ScenesAreEqual(expected, actual)) << file;
+    }
+}
+
+TEST_F(utObjImportExport, parallel_parse_large_model) {
+    // Big enough to be split into several chunks, mixing groups, materials,
+    // relative indices and line continuations across the whole file.
+    std::string model = "mtllib missing.mtl\n";
+    const int numQuads = 40000;
+    for (int i = 0; i < numQuads; ++i) {
+        if (i % 5000 == 0) {
+            model += "g group" + std::to_string(i / 5000) + "\n";
+            model += (i / 5000) % 2 ? "usemtl red\n" : "usemtl blue\n";
+        }
+        const std::string x = std::to_string(i);
+        model += "v " + x + " 0 0\nv " + x + " 1 0\nv " + x + " \\\n 1 1\nv " + x + " 0 1\n";
+        model += "vt 0.25 0.5\nvn 0 0 1\n";
+        if (i % 3 == 0) {
+            model += "f -4/-1/-1 -3/-1/-1 -2/-1/-1 -1/-1/-1\n";
+        } else {
+            const std::string base = std::to_string(i * 4 + 1);
+            const std::string t = std::to_string(i + 1);
+            model += "f " + base + "/" + t + "/" + t + " " + std::to_string(i * 4 + 2) + "/" + t + "/" + t + " " +
+                     std::to_string(i * 4 + 3) + "/" + t + "/" + t + "\n";
+        }
+    }
+
+    Assimp::Importer sequential;
+    const aiScene *expected = sequential.ReadFileFromMemory(model.c_str(), model.size(), aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, expected);
+    EXPECT_LT(1u, expected->mNumMeshes);
+
+    ScopedLogCapture log;
+    Assimp::Importer parallel;
+    parallel.SetPropertyInteger(AI_CONFIG_IMPORT_OBJ_PARSE_THREADS, 4);
+    const aiScene *actual = parallel.ReadFileFromMemory(model.c_str(), model.size(), aiProcess_ValidateDataStructure);
+    EXPECT_TRUE(log.contains("chunks in parallel"));
+    EXPECT_FALSE(log.contains("parsing 1 chunks"));
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    EXPECT_TRUE(log.contains("on 4 threads"));
+#endif
+    EXPECT_TRUE(ScenesAreEqual(expected, actual));
+}
+
+TEST_F(utObjImportExport, contiguous_face_indices) {
+    // mixed primitive types, so SortByPType has to split the mesh
+    static const char *curObjModel =
+            "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nv 0 0 1\nv 1 0 1\n"
+            "f 1 2 3 4\n"
+            "f 1 2 5\n"
+            "f 2 6 3 4 1\n"
+            "l 1 5 6\n"
+            "p 3 4\n"
+            "f 1 1 2\n";
+    const unsigned int flags = aiProcess_Triangulate | aiProcess_FindDegenerates | aiProcess_SortByPType |
+                               aiProcess_JoinIdenticalVertices | aiProcess_SplitLargeMeshes |
+                               aiProcess_OptimizeMeshes | aiProcess_ValidateDataStructure;
+
+    Assimp::Importer reference;
+    Assimp::Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_IMPORT_CONTIGUOUS_FACE_INDICES, true);
+    for (Assimp::Importer *imp : { &reference, &importer }) {
+        imp->SetPropertyBool(AI_CONFIG_PP_FD_REMOVE, true);
+        imp->SetPropertyInteger(AI_CONFIG_PP_SLM_TRIANGLE_LIMIT, 2);
+        imp->SetPropertyInteger(AI_CONFIG_PP_SLM_VERTEX_LIMIT, 4);
+    }
+    const aiScene *expected = reference.ReadFileFromMemory(curObjModel, strlen(curObjModel), flags);
+    const aiScene *scene = importer.ReadFileFromMemory(curObjModel, strlen(curObjModel), flags);
+    EXPECT_TRUE(ScenesAreEqual(expected, scene));
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        EXPECT_NE(nullptr, scene->mMeshes[i]->mFaceIndexStorage);
+    }
+
+    // pre-transforming copies the indices into arrays per face
+    expected = reference.ReadFileFromMemory(curObjModel, strlen(curObjModel), flags | aiProcess_PreTransformVertices);
+    scene = importer.ReadFileFromMemory(curObjModel, strlen(curObjModel), flags | aiProcess_PreTransformVertices);
+    EXPECT_TRUE(ScenesAreEqual(expected, scene));
+}
+
+TEST_F(utObjImportExport, scene_arena) {
+    static const char *curObjModel =
+            "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nv 0 0 1\nv 1 0 1\n"
+            "f 1 2 3 4\n"
+            "f 1 2 5\n"
+            "f 2 6 3 4 1\n"
+            "l 1 5 6\n"
+            "p 3 4\n";
+    const unsigned int flags = aiProcess_Triangulate | aiProcess_SortByPType | aiProcess_SplitLargeMeshes |
+                               aiProcess_ValidateDataStructure;
+
+    Assimp::Importer reference;
+    Assimp::Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_IMPORT_SCENE_ARENA, true);
+    for (Assimp::Importer *imp : { &reference, &importer }) {
+        imp->SetPropertyInteger(AI_CONFIG_PP_SLM_TRIANGLE_LIMIT, 2);
+        imp->SetPropertyInteger(AI_CONFIG_PP_SLM_VERTEX_LIMIT, 4);
+    }
+    const aiScene *expected = reference.ReadFileFromMemory(curObjModel, strlen(curObjModel), flags);
+    const aiScene *scene = importer.ReadFileFromMemory(curObjModel, strlen(curObjModel), flags);
+    EXPECT_TRUE(ScenesAreEqual(expected, scene));
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        EXPECT_NE(nullptr, scene->mMeshes[i]->mFaceIndexStorage);
+        EXPECT_NE(0u, scene->mMeshes[i]->mFaceIndexStorageExternal);
+    }
+
+    // a copy owns its indices and outlives the arena
+    aiScene *copy = nullptr;
+    aiCopyScene(scene, &copy);
+    ASSERT_NE(nullptr, copy);
+    importer.FreeScene();
+    EXPECT_TRUE(ScenesAreEqual(expected, copy));
+    for (unsigned int i = 0; i < copy->mNumMeshes; ++i) {
+        EXPECT_EQ(0u, copy->mMeshes[i]->mFaceIndexStorageExternal);
+    }
+    aiFreeScene(copy);
+}
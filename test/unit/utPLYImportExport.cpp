@@ -41,11 +41,18 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UnitTestPCH.h"
 
 #include "AbstractImportExportBase.h"
+#include "SceneComparison.h"
+#include "UTLogStream.h"
+#include "UnitTestFileGenerator.h"
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 #include <assimp/Exporter.hpp>
 #include <assimp/Importer.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <string>
+
 using namespace ::Assimp;
 
 class utPLYImportExport : public AbstractImportExportBase {
@@ -282,3 +289,115 @@ TEST_F(utPLYImportExport, parseInvalidDoubleCustomProperty) {
     const aiScene *scene = importer.ReadFileFromMemory(data, sizeof(data), 0);
     EXPECT_EQ(nullptr, scene);
 }
+
+namespace {
+
+// Append a value to a binary PLY body in the given byte order
+template <typename T>
+void appendBinary(std::string &out, T value, bool bigEndian) {
+    const uint16_t one = 1;
+    const bool hostBigEndian = 0 == *reinterpret_cast<const uint8_t *>(&one);
+    char bytes[sizeof(T)];
+    memcpy(bytes, &value, sizeof(T));
+    if (bigEndian != hostBigEndian) {
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+    out.append(bytes, sizeof(T));
+}
+
+// A vertex element with all kinds of semantics plus a face list, the vertices
+// of binary files take the columnar path, the ascii file is the reference
+std::string makeColumnarTestFile(const char *format, unsigned int numVertices) {
+    const bool binary = 0 != strcmp(format, "ascii");
+    const bool bigEndian = 0 == strcmp(format, "binary_big_endian");
+    std::string out = std::string("ply\nformat ") + format + " 1.0\n" +
+                      "element vertex " + std::to_string(numVertices) + "\n"
+                      "property float x\nproperty float y\nproperty float z\n"
+                      "property float nx\nproperty float ny\nproperty float nz\n"
+                      "property uchar red\nproperty uchar green\nproperty uchar blue\n"
+                      "property ushort alpha\n"
+                      "property float s\nproperty float t\n"
+                      "property int intensity\n"
+                      "element face 1\n"
+                      "property list uchar int vertex_indices\n"
+                      "end_header\n";
+    for (unsigned int i = 0; i < numVertices; ++i) {
+        const float pos[] = { 0.5f * i, -1.0f * i, 0.25f * i };
+        const float normal[] = { 0.0f, 1.0f, -0.5f };
+        const uint8_t color[] = { static_cast<uint8_t>(i * 10), 255, 0 };
+        const uint16_t alpha = static_cast<uint16_t>(i * 1000);
+        const float uv[] = { 0.125f * i, 1.0f - 0.125f * i };
+        const int32_t intensity = -static_cast<int32_t>(i);
+        if (binary) {
+            for (float f : pos) appendBinary(out, f, bigEndian);
+            for (float f : normal) appendBinary(out, f, bigEndian);
+            for (uint8_t c : color) appendBinary(out, c, bigEndian);
+            appendBinary(out, alpha, bigEndian);
+            for (float f : uv) appendBinary(out, f, bigEndian);
+            appendBinary(out, intensity, bigEndian);
+        } else {
+            char line[256];
+            snprintf(line, sizeof(line), "%g %g %g %g %g %g %u %u %u %u %g %g %d\n", pos[0], pos[1], pos[2],
+                    normal[0], normal[1], normal[2], color[0], color[1], color[2], alpha, uv[0], uv[1], intensity);
+            out += line;
+        }
+    }
+    if (binary) {
+        appendBinary(out, static_cast<uint8_t>(3), bigEndian);
+        for (int32_t idx = 0; idx < 3; ++idx) {
+            appendBinary(out, idx, bigEndian);
+        }
+    } else {
+        out += "3 0 1 2\n";
+    }
+    return out;
+}
+
+} // namespace
+
+TEST_F(utPLYImportExport, importBinaryColumnar) {
+    const std::string ascii = makeColumnarTestFile("ascii", 16);
+    Assimp::Importer reference;
+    const aiScene *expected = reference.ReadFileFromMemory(ascii.data(), ascii.size(), aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, expected);
+
+    for (const char *format : { "binary_little_endian", "binary_big_endian" }) {
+        const std::string binary = makeColumnarTestFile(format, 16);
+        ScopedLogCapture log;
+        Assimp::Importer importer;
+        const aiScene *scene = importer.ReadFileFromMemory(binary.data(), binary.size(), aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, scene) << format;
+        EXPECT_TRUE(log.contains("decoding 16 binary vertices column by column")) << format;
+        EXPECT_TRUE(ScenesAreEqual(expected, scene)) << format;
+    }
+}
+
+// Vertices spanning several blocks of the stream buffer
+TEST_F(utPLYImportExport, importBinaryColumnarFromFile) {
+    const unsigned int numVertices = 100000;
+    const std::string binary = makeColumnarTestFile("binary_little_endian", numVertices);
+    ASSERT_GT(binary.size(), 1024u * 1024u);
+
+    char fname[] = { TMP_PATH "plycolumnar.XXXXXX\0" };
+    std::string tmpName;
+    FILE *fs = MakeTmpFile(fname, std::strlen(fname), tmpName);
+    ASSERT_NE(nullptr, fs);
+    EXPECT_EQ(binary.size(), std::fwrite(binary.data(), 1, binary.size(), fs));
+    std::fclose(fs);
+
+    ScopedLogCapture log;
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(tmpName, aiProcess_ValidateDataStructure);
+    std::remove(tmpName.c_str());
+    ASSERT_NE(nullptr, scene);
+    EXPECT_TRUE(log.contains("column by column"));
+    const aiMesh *mesh = scene->mMeshes[0];
+    ASSERT_EQ(numVertices, mesh->mNumVertices);
+    for (unsigned int i : { 0u, 1u, 25574u, 25575u, 51150u, numVertices - 1 }) {
+        EXPECT_EQ(aiVector3D(0.5f * i, -1.0f * i, 0.25f * i), mesh->mVertices[i]);
+        EXPECT_EQ(aiVector3D(0.0f, 1.0f, -0.5f), mesh->mNormals[i]);
+        EXPECT_FLOAT_EQ(static_cast<uint8_t>(i * 10) / 255.0f, mesh->mColors[0][i].r);
+        EXPECT_FLOAT_EQ(static_cast<uint16_t>(i * 1000) / 65535.0f, mesh->mColors[0][i].a);
+        EXPECT_EQ(aiVector3D(0.125f * i, 1.0f - 0.125f * i, 0.0f), mesh->mTextureCoords[0][i]);
+    }
+}
@@ -61,3 +61,35 @@ TEST_F( utProfiler, addRegion_success ) {
     }
     myProfiler.EndRegion( "t1" );
 }
+
+TEST_F( utProfiler, nestedRegions_success ) {
+    Profiler myProfiler;
+    myProfiler.BeginRegion( "outer" );
+    myProfiler.BeginRegion( "inner" );
+    myProfiler.EndRegion( "inner" );
+    myProfiler.BeginRegion( "inner" );
+    myProfiler.EndRegion( "inner" );
+    myProfiler.EndRegion( "outer" );
+
+    const std::vector<Profiler::Region> &regions = myProfiler.GetRegions();
+    ASSERT_EQ( 3u, regions.size() );
+    EXPECT_EQ( "outer", regions[0].mName );
+    EXPECT_EQ( 0u, regions[0].mDepth );
+    EXPECT_EQ( 1u, regions[1].mDepth );
+    EXPECT_EQ( 1u, regions[2].mDepth );
+    for ( const Profiler::Region &region : regions ) {
+        EXPECT_TRUE( region.mFinished );
+        EXPECT_GE( region.mSeconds, 0.0 );
+    }
+    EXPECT_DOUBLE_EQ( regions[1].mSeconds + regions[2].mSeconds, myProfiler.GetSeconds( "inner" ) );
+    EXPECT_GE( myProfiler.GetSeconds( "outer" ), myProfiler.GetSeconds( "inner" ) );
+}
+
+TEST_F( utProfiler, endUnknownRegion_isIgnored ) {
+    Profiler myProfiler;
+    myProfiler.BeginRegion( "t1" );
+    myProfiler.EndRegion( "t2" );
+    ASSERT_EQ( 1u, myProfiler.GetRegions().size() );
+    EXPECT_FALSE( myProfiler.GetRegions()[0].mFinished );
+    EXPECT_EQ( 0.0, myProfiler.GetSeconds( "t1" ) );
+}
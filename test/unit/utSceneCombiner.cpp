@@ -75,3 +75,54 @@ TEST_F(utSceneCombiner, CopySceneWithNullptr_AI_NO_EXCEPTion) {
     EXPECT_NO_THROW(SceneCombiner::CopyScene(nullptr, nullptr));
     EXPECT_NO_THROW(SceneCombiner::CopySceneFlat(nullptr, nullptr));
 }
+
+TEST_F(utSceneCombiner, CopyMesh_ContiguousFaces_Test) {
+    aiMesh src;
+    src.AllocateFaces(2, 3, true);
+    for (unsigned int i = 0; i < 6; ++i) {
+        src.mFaces[i / 3].mIndices[i % 3] = i;
+    }
+    ASSERT_TRUE(src.IsInFaceIndexStorage(src.mFaces[1]));
+
+    aiMesh *ptr = nullptr;
+    SceneCombiner::Copy(&ptr, &src);
+    std::unique_ptr<aiMesh> dest(ptr);
+    ASSERT_NE(nullptr, dest->mFaceIndexStorage);
+    EXPECT_NE(src.mFaceIndexStorage, dest->mFaceIndexStorage);
+    ASSERT_EQ(2u, dest->mNumFaces);
+    for (unsigned int i = 0; i < 6; ++i) {
+        EXPECT_TRUE(dest->IsInFaceIndexStorage(dest->mFaces[i / 3]));
+        EXPECT_EQ(i, dest->mFaces[i / 3].mIndices[i % 3]);
+    }
+}
+
+TEST_F(utSceneCombiner, MergeMeshes_ContiguousFaces_Test) {
+    std::vector<aiMesh *> merge_list;
+    aiMesh *mesh1 = new aiMesh;
+    mesh1->mNumVertices = 3;
+    mesh1->mVertices = new aiVector3D[3];
+    mesh1->AllocateFaces(1, 3, false);
+    merge_list.push_back(mesh1);
+
+    aiMesh *mesh2 = new aiMesh;
+    mesh2->mNumVertices = 3;
+    mesh2->mVertices = new aiVector3D[3];
+    mesh2->AllocateFaces(1, 3, true);
+    merge_list.push_back(mesh2);
+
+    for (aiMesh *mesh : merge_list) {
+        for (unsigned int i = 0; i < 3; ++i) {
+            mesh->mFaces[0].mIndices[i] = i;
+        }
+    }
+
+    aiMesh *ptr = nullptr;
+    SceneCombiner::MergeMeshes(&ptr, 0, merge_list.begin(), merge_list.end());
+    std::unique_ptr<aiMesh> out(ptr);
+    ASSERT_NE(nullptr, out->mFaceIndexStorage);
+    ASSERT_EQ(2u, out->mNumFaces);
+    for (unsigned int i = 0; i < 6; ++i) {
+        EXPECT_TRUE(out->IsInFaceIndexStorage(out->mFaces[i / 3]));
+        EXPECT_EQ(i, out->mFaces[i / 3].mIndices[i % 3]);
+    }
+}
@@ -44,7 +44,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/mesh.h>
 #include <assimp/scene.h>
-#include <ValidateDataStructure.h>
+#include <assimp/Exceptional.h>
+#include "PostProcessing/ValidateDataStructure.h"
 
 using namespace std;
 using namespace Assimp;
@@ -90,6 +91,102 @@ void ValidateDataStructureTest::TearDown()
 
 
 
+// ------------------------------------------------------------------------------------------------
+static aiMesh *CreateTriangle() {
+    aiMesh *mesh = new aiMesh();
+    mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+    mesh->mNumVertices = 3;
+    mesh->mVertices = new aiVector3D[3];
+    mesh->mNumFaces = 1;
+    mesh->mFaces = new aiFace[1];
+    mesh->mFaces[0].mNumIndices = 3;
+    mesh->mFaces[0].mIndices = new unsigned int[3]{ 0, 1, 2 };
+    return mesh;
+}
+
+// ------------------------------------------------------------------------------------------------
+static aiNode *AddChild(aiNode *parent, const char *name) {
+    aiNode *child = new aiNode(name);
+    parent->addChildren(1, &child);
+    return child;
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(ValidateDataStructureTest, validSceneTest) {
+    scene->mNumMeshes = 2;
+    scene->mMeshes = new aiMesh *[2]{ CreateTriangle(), CreateTriangle() };
+
+    // every node may reference the same meshes once
+    for (unsigned int i = 0; i < 3; ++i) {
+        aiNode *node = AddChild(scene->mRootNode, ("node" + std::to_string(i)).c_str());
+        node->mNumMeshes = 2;
+        node->mMeshes = new unsigned int[2]{ 1, 0 };
+    }
+
+    scene->mNumCameras = 1;
+    scene->mCameras = new aiCamera *[1]{ new aiCamera() };
+    scene->mCameras[0]->mName.Set("node2");
+
+    EXPECT_NO_THROW(vds->Execute(scene));
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(ValidateDataStructureTest, nodeMeshReferencedTwiceTest) {
+    scene->mNumMeshes = 1;
+    scene->mMeshes = new aiMesh *[1]{ CreateTriangle() };
+    aiNode *node = AddChild(scene->mRootNode, "node");
+    node->mNumMeshes = 2;
+    node->mMeshes = new unsigned int[2]{ 0, 0 };
+
+    EXPECT_THROW(vds->Execute(scene), DeadlyImportError);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(ValidateDataStructureTest, cameraNameTest) {
+    scene->mNumMeshes = 1;
+    scene->mMeshes = new aiMesh *[1]{ CreateTriangle() };
+    AddChild(scene->mRootNode, "a");
+    AddChild(AddChild(scene->mRootNode, "b"), "b");
+
+    scene->mNumCameras = 2;
+    scene->mCameras = new aiCamera *[2]{ new aiCamera(), new aiCamera() };
+
+    // no corresponding node
+    scene->mCameras[0]->mName.Set("a");
+    scene->mCameras[1]->mName.Set("c");
+    EXPECT_THROW(vds->Execute(scene), DeadlyImportError);
+
+    // more than one node with the same name
+    scene->mCameras[1]->mName.Set("b");
+    EXPECT_THROW(vds->Execute(scene), DeadlyImportError);
+
+    // two cameras with the same name
+    scene->mCameras[1]->mName.Set("a");
+    EXPECT_THROW(vds->Execute(scene), DeadlyImportError);
+
+    scene->mCameras[1]->mName.Set("<test>");
+    EXPECT_NO_THROW(vds->Execute(scene));
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(ValidateDataStructureTest, duplicateBoneNameTest) {
+    aiMesh *mesh = CreateTriangle();
+    mesh->mNumBones = 3;
+    mesh->mBones = new aiBone *[3];
+    for (unsigned int i = 0; i < mesh->mNumBones; ++i) {
+        mesh->mBones[i] = new aiBone();
+        mesh->mBones[i]->mName.Set("bone" + std::to_string(i));
+        mesh->mBones[i]->mNumWeights = 1;
+        mesh->mBones[i]->mWeights = new aiVertexWeight[1]{ aiVertexWeight(i, 1.0f) };
+    }
+    scene->mNumMeshes = 1;
+    scene->mMeshes = new aiMesh *[1]{ mesh };
+    EXPECT_NO_THROW(vds->Execute(scene));
+
+    mesh->mBones[2]->mName.Set("bone0");
+    EXPECT_THROW(vds->Execute(scene), DeadlyImportError);
+}
+
 // ------------------------------------------------------------------------------------------------
 //Template
 //TEST_F(ScenePreprocessorTest, test)
@@ -195,5 +292,3 @@ void ValidateDataStructureTest::TearDown()
 //965: ReportError("aiString::length is too large (%i, maximum is %lu)",
 //974: ReportError("aiString::data is invalid: the terminal zero is at a wrong offset");
 //979: ReportError("aiString::data is invalid. There is no terminal character");
-}
-
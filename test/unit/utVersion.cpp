@@ -65,7 +65,11 @@ TEST_F( utVersion, aiGetVersionPatchTest ) {
 }
 
 TEST_F( utVersion, aiGetCompileFlagsTest ) {
-    EXPECT_NE( aiGetCompileFlags(), 0U );
+#ifdef ASSIMP_BUILD_SINGLETHREADED
+    EXPECT_NE( aiGetCompileFlags() & ASSIMP_CFLAGS_SINGLETHREADED, 0U );
+#else
+    EXPECT_EQ( aiGetCompileFlags() & ASSIMP_CFLAGS_SINGLETHREADED, 0U );
+#endif
 }
 
 TEST_F( utVersion, aiGetVersionRevisionTest ) {
@@ -40,6 +40,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 #include "AbstractImportExportBase.h"
 #include "UnitTestPCH.h"
+#include "SceneComparison.h"
+#include "UTLogStream.h"
 #include "Tools/TestTools.h"
 #include <assimp/commonMetaData.h>
 #include <assimp/postprocess.h>
@@ -53,6 +55,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <rapidjson/schema.h>
 
 #include <array>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
 
 #include <assimp/material.h>
 #include <assimp/GltfMaterial.h>
@@ -694,6 +699,40 @@ TEST_F(utglTF2ImportExport, crash_in_anim_mesh_destructor) {
     ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "glb2", ASSIMP_TEST_MODELS_DIR "/glTF2/glTF-Sample-Models/AnimatedMorphCube-glTF/AnimatedMorphCube_out.glTF"));
 }
 
+TEST_F(utglTF2ImportExport, exportCompactJson) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured.gltf",
+            aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    Assimp::Exporter exporter;
+    ExportProperties props;
+    props.SetPropertyBool(AI_CONFIG_EXPORT_GLTF_COMPACT_JSON, true);
+    ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "gltf2", ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured_compact_out.gltf", 0, &props));
+
+    std::ifstream file(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured_compact_out.gltf");
+    const std::string json((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    ASSERT_FALSE(json.empty());
+    EXPECT_EQ(std::string::npos, json.find('\n'));
+
+    // single precision values are written with the shortest representation
+    EXPECT_EQ(std::string::npos, json.find("0000000"));
+
+    Assimp::Importer reimporter;
+    const aiScene *compact = reimporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured_compact_out.gltf",
+            aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, compact);
+    ASSERT_EQ(scene->mNumMeshes, compact->mNumMeshes);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        const aiMesh *expected = scene->mMeshes[i];
+        const aiMesh *actual = compact->mMeshes[i];
+        ASSERT_EQ(expected->mNumVertices, actual->mNumVertices);
+        for (unsigned int v = 0; v < expected->mNumVertices; ++v) {
+            EXPECT_EQ(expected->mVertices[v], actual->mVertices[v]);
+        }
+    }
+}
+
 TEST_F(utglTF2ImportExport, error_string_preserved) {
     Assimp::Importer importer;
     const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/MissingBin/BoxTextured.gltf",
@@ -921,6 +960,28 @@ TEST_F(utglTF2ImportExport, import_dracoEncoded) {
 #endif
 }
 
+#ifdef ASSIMP_ENABLE_DRACO
+TEST_F(utglTF2ImportExport, import_dracoEncodedParallel) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/draco/2CylinderEngine.gltf",
+            aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    ScopedLogCapture log;
+    Assimp::Importer parallelImporter;
+    parallelImporter.SetPropertyInteger(AI_CONFIG_IMPORT_GLTF_DRACO_THREADS, 4);
+    const aiScene *parallelScene = parallelImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/draco/2CylinderEngine.gltf",
+            aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, parallelScene);
+    EXPECT_TRUE(log.contains("Draco primitives on"));
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    EXPECT_TRUE(log.contains("Draco primitives on 4 threads"));
+#endif
+
+    EXPECT_TRUE(ScenesAreEqual(scene, parallelScene));
+}
+#endif
+
 TEST_F(utglTF2ImportExport, wrongTypes) {
     // Deliberately broken version of the BoxTextured.gltf asset.
     using tup_T = std::tuple<std::string, std::string, std::string, std::string>;
@@ -1056,3 +1117,36 @@ TEST_F(utglTF2ImportExport, testSetIdentityMatrixEpsilon) {
     EXPECT_TRUE(m.IsIdentity(epsilon));
 }
 
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utglTF2ImportExport, importGLBFromMemory) {
+    const char *file = ASSIMP_TEST_MODELS_DIR "/glTF2/2CylinderEngine-glTF-Binary/2CylinderEngine.glb";
+    std::ifstream in(file, std::ios::binary);
+    ASSERT_TRUE(in.good());
+    const std::vector<char> contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    Assimp::Importer reference;
+    const aiScene *expected = reference.ReadFile(file, aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, expected);
+
+    ScopedLogCapture log;
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFileFromMemory(contents.data(), contents.size(), aiProcess_ValidateDataStructure, "glb");
+    ASSERT_NE(nullptr, scene);
+    EXPECT_TRUE(ScenesAreEqual(expected, scene));
+
+    // the buffers reference the memory passed to the importer instead of a copy of it
+    const std::string marker = "bytes of stream memory at ";
+    size_t numViews = 0;
+    for (const std::string &message : log.messages()) {
+        const size_t pos = message.find(marker);
+        if (pos == std::string::npos) {
+            continue;
+        }
+        const uintptr_t address = static_cast<uintptr_t>(std::strtoull(message.c_str() + pos + marker.size(), nullptr, 16));
+        EXPECT_LE(reinterpret_cast<uintptr_t>(contents.data()), address);
+        EXPECT_GT(reinterpret_cast<uintptr_t>(contents.data() + contents.size()), address);
+        ++numViews;
+    }
+    EXPECT_LT(0u, numViews);
+}